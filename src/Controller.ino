@@ -1,10 +1,14 @@
 #include "ESPEasy_common.h"
 #include "ESPEasy_fdwdecl.h"
 #include "ESPEasy_plugindefs.h"
+#include "src/DataStructs/Caches.h"
 #include "src/DataStructs/ControllerSettingsStruct.h"
 #include "src/DataStructs/ESPEasy_EventStruct.h"
+#include "src/DataStructs/TaskFormulaPrograms.h"
+#include "src/Globals/Cache.h"
 #include "src/Globals/CPlugins.h"
 #include "src/Globals/Device.h"
+#include "src/Globals/ExtraTaskSettings.h"
 #include "src/Globals/MQTT.h"
 #include "src/Globals/Plugins.h"
 #include "src/Globals/Protocol.h"
@@ -16,7 +20,7 @@
 void sendData(struct EventStruct *event)
 {
   START_TIMER;
-  checkRAM(F("sendData"));
+  checkRAM(RamProbe::sendData);
   LoadTaskSettings(event->TaskIndex);
 
   if (Settings.UseRules) {
@@ -414,15 +418,14 @@ void SendStatus(EventValueSource::Enum source, const String& status)
 #ifdef USES_MQTT
 bool MQTTpublish(controllerIndex_t controller_idx, const char *topic, const char *payload, bool retained)
 {
-  {
-    MQTT_queue_element dummy_element(MQTT_queue_element(controller_idx, "", "", retained));
-    if (MQTTDelayHandler.queueFull(dummy_element)) {
-      // The queue is full, try to make some room first.
-      addLog(LOG_LEVEL_DEBUG, F("MQTT : Extra processMQTTdelayQueue()"));
-      processMQTTdelayQueue();
-    }
+  // Topic and payload are only copied when added to the queue.
+  const MQTT_queue_element element(controller_idx, topic, payload, retained);
+  if (MQTTDelayHandler.queueFull(element)) {
+    // The queue is full, try to make some room first.
+    addLog(LOG_LEVEL_DEBUG, F("MQTT : Extra processMQTTdelayQueue()"));
+    processMQTTdelayQueue();
   }
-  const bool success = MQTTDelayHandler.addToQueue(MQTT_queue_element(controller_idx, topic, payload, retained));
+  const bool success = MQTTDelayHandler.addToQueue(element);
   scheduleNextMQTTdelayQueue();
   return success;
 }
@@ -437,23 +440,37 @@ void processMQTTdelayQueue() {
 
   if (element == NULL) { return; }
 
-  if (MQTTclient.publish(element->_topic.c_str(), element->_payload.c_str(), element->_retained)) {
-    if (connectionFailures > 0) {
-      --connectionFailures;
-    }
-    MQTTDelayHandler.markProcessed(true);
-  } else {
-    MQTTDelayHandler.markProcessed(false);
+  // Waiting for a full batch is handled when scheduling, so explicit calls
+  // (e.g. to make room in a full queue) always flush.
+  // Publish a burst of messages when batching is enabled.
+  // The messages are written back-to-back on the same connection, without waiting for the next scheduler run.
+  const controllerIndex_t controller_idx = element->controller_idx;
+  unsigned int nrProcessed               = 0;
+  size_t bytesProcessed                  = 0;
+
+  do {
+    ++nrProcessed;
+    bytesProcessed += element->getSize();
+
+    if (MQTTclient.publish(element->_topic, element->_payload, element->_retained)) {
+      if (connectionFailures > 0) {
+        --connectionFailures;
+      }
+      MQTTDelayHandler.markProcessed(true);
+    } else {
+      MQTTDelayHandler.markProcessed(false);
 #ifndef BUILD_NO_DEBUG
 
-    if (loglevelActiveFor(LOG_LEVEL_DEBUG)) {
-      String log = F("MQTT : process MQTT queue not published, ");
-      log += MQTTDelayHandler.sendQueue.size();
-      log += F(" items left in queue");
-      addLog(LOG_LEVEL_DEBUG, log);
-    }
+      if (loglevelActiveFor(LOG_LEVEL_DEBUG)) {
+        String log = F("MQTT : process MQTT queue not published, ");
+        log += MQTTDelayHandler.sendQueue.size();
+        log += F(" items left in queue");
+        addLog(LOG_LEVEL_DEBUG, log);
+      }
 #endif // ifndef BUILD_NO_DEBUG
-  }
+    }
+    element = MQTTDelayHandler.getNext();
+  } while (MQTTDelayHandler.continueBatch(element, controller_idx, nrProcessed, bytesProcessed));
   setIntervalTimerOverride(TIMER_MQTT, 10); // Make sure the MQTT is being processed as soon as possible.
   scheduleNextMQTTdelayQueue();
   STOP_TIMER(MQTT_DELAY_QUEUE);
@@ -491,13 +508,32 @@ void MQTTStatus(const String& status)
 // }
 
 
+/*********************************************************************************************\
+ * Get the compiled value formulas of a task, compile them when not present in the cache.
+ * The cache is cleared when settings are saved.
+\*********************************************************************************************/
+const TaskFormulaPrograms& getTaskFormulaPrograms(taskIndex_t TaskIndex)
+{
+  auto it = Cache.taskFormulaPrograms.find(TaskIndex);
+  if (it != Cache.taskFormulaPrograms.end()) {
+    return it->second;
+  }
+  START_TIMER;
+  LoadTaskSettings(TaskIndex);
+  TaskFormulaPrograms& formulas = Cache.taskFormulaPrograms[TaskIndex];
+  formulas.compile(ExtraTaskSettings);
+  STOP_TIMER(COMPILE_FORMULA_STATS);
+  return formulas;
+}
+
+
 /*********************************************************************************************\
  * send specific sensor task data, effectively calling PluginCall(PLUGIN_READ...)
 \*********************************************************************************************/
 void SensorSendTask(taskIndex_t TaskIndex)
 {
   if (!validTaskIndex(TaskIndex)) return;
-  checkRAM(F("SensorSendTask"));
+  checkRAM(RamProbe::SensorSendTask);
   if (Settings.TaskDeviceEnabled[TaskIndex])
   {
     byte varIndex = TaskIndex * VARS_PER_TASK;
@@ -529,17 +565,14 @@ void SensorSendTask(taskIndex_t TaskIndex)
     if (success)
     {
       if (Device[DeviceIndex].FormulaOption) {
+        const TaskFormulaPrograms& formulas = getTaskFormulaPrograms(TaskIndex);
         START_TIMER;
         for (byte varNr = 0; varNr < VARS_PER_TASK; varNr++)
         {
-          if (ExtraTaskSettings.TaskDeviceFormula[varNr][0] != 0)
+          if (formulas.hasFormula(varNr))
           {
-            String formula = ExtraTaskSettings.TaskDeviceFormula[varNr];
-            formula.replace(F("%pvalue%"), String(preValue[varNr]));
-            formula.replace(F("%value%"), String(UserVar[varIndex + varNr]));
             float result = 0;
-            byte error = Calculate(formula.c_str(), &result);
-            if (error == 0)
+            if (formulas.calculate(varNr, UserVar[varIndex + varNr], preValue[varNr], result) == CALCULATE_OK)
               UserVar[varIndex + varNr] = result;
           }
         }
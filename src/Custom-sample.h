@@ -109,6 +109,8 @@
 
 #define DEFAULT_USE_RULES                       false             // (true|false) Enable Rules?
 #define DEFAULT_RULES_OLDENGINE                 true
+#define DEFAULT_RULES_EVENTS_TIME_BUDGET        20                // Max. time in msec to process queued rules events per 100 msec
+#define DEFAULT_RULES_EVENT_QUEUE_SIZE          64                // Max. number of queued rules events (1 .. 255)
 
 #define DEFAULT_MQTT_RETAIN                     false             // (true|false) Retain MQTT messages?
 #define DEFAULT_MQTT_DELAY                      100               // Time in milliseconds to retain MQTT messages
@@ -147,6 +149,8 @@
 
 // #define USE_SETTINGS_ARCHIVE
 
+// #define USES_TIMING_TRACE  // Record a trace of the timed calls, to be downloaded via /timingtrace
+
 /*
  #######################################################################################################
    Special settings  (rendering settings incompatible with other builds)
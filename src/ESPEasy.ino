@@ -97,10 +97,14 @@
 #include "src/DataStructs/PortStatusStruct.h"
 #include "src/DataStructs/ProtocolStruct.h"
 #include "src/DataStructs/RTCStruct.h"
+#include "src/DataStructs/RulesCompiled.h"
 #include "src/DataStructs/SchedulerTimers.h"
 #include "src/DataStructs/SettingsType.h"
 #include "src/DataStructs/SystemTimerStruct.h"
+#include "src/DataStructs/TaskFormulaPrograms.h"
+#include "src/DataStructs/TemplatePlan.h"
 #include "src/DataStructs/TimingStats.h"
+#include "src/DataStructs/TimingTrace.h"
 
 #include "src/DataStructs/tcp_cleanup.h"
 
@@ -119,6 +123,8 @@
 #include "src/Globals/Settings.h"
 #include "src/Globals/Statistics.h"
 
+#include "src/Static/WebStaticData.h"
+
 #if FEATURE_ADC_VCC
 ADC_MODE(ADC_VCC);
 #endif
@@ -129,8 +135,6 @@ ADC_MODE(ADC_VCC);
 float& getUserVar(unsigned int varIndex) {return UserVar[varIndex]; }
 
 
-//void checkRAM( const __FlashStringHelper* flashString);
-
 #ifdef CORE_POST_2_5_0
 void preinit();
 #endif
@@ -194,7 +198,7 @@ void setup()
 
   resetPluginTaskData();
 
-  checkRAM(F("setup"));
+  checkRAM(RamProbe::setup);
   #if defined(ESP32)
     for(byte x = 0; x < 16; x++)
       ledChannelPin[x] = -1;
@@ -338,7 +342,7 @@ void setup()
   if (Settings.UseSerial && Settings.SerialLogLevel >= LOG_LEVEL_DEBUG_MORE)
     Serial.setDebugOutput(true);
 
-  checkRAM(F("hardwareInit"));
+  checkRAM(RamProbe::hardwareInit);
   hardwareInit();
 
   timermqtt_interval = 250; // Interval for checking MQTT
@@ -399,8 +403,6 @@ void setup()
     rulesProcessing(event); // TD-er: Process events in the setup() now.
   }
 
-  writeDefaultCSS();
-
   UseRTOSMultitasking = Settings.UseRTOSMultitasking;
   #ifdef USE_RTOS_MULTITASKING
     if(UseRTOSMultitasking){
@@ -481,6 +483,9 @@ void updateLoopStats() {
   #ifdef USES_TIMING_STATS
   miscStats[LOOP_STATS].add(usecSince);
   #endif
+  #ifdef USES_TIMING_TRACE
+  timingTrace.add(TIMING_STATS_MISC, LOOP_STATS, lastLoopStart, usecSince);
+  #endif
 
   loop_usec_duration_total += usecSince;
   lastLoopStart = micros();
@@ -741,7 +746,7 @@ void run10TimesPerSecond() {
     CPluginCall(CPlugin::Function::CPLUGIN_TEN_PER_SECOND, 0, dummy);
     STOP_TIMER(CPLUGIN_CALL_10PS);
   }
-  processNextEvent();
+  processEventQueue();
   
   #ifdef USES_C015
   if (WiFiConnected())
@@ -915,7 +920,7 @@ void runEach30Seconds()
 bool runningBackgroundTasks=false;
 void backgroundtasks()
 {
-  //checkRAM(F("backgroundtasks"));
+  //checkRAM(RamProbe::backgroundtasks);
   //always start with a yield
   delay(0);
 /*
@@ -944,6 +949,7 @@ void backgroundtasks()
     #endif
   }
   process_serialWriteBuffer();
+  process_logBuffer();
   if(!UseRTOSMultitasking){
     if (Settings.UseSerial && Serial.available()) {
       String dummy;
@@ -37,7 +37,7 @@
 // these offsets are in blocks, bytes = blocks * 4
 // 64   RTCStruct  max 40 bytes: ( 74 - 64 ) * 4
 // 74   UserVar
-// 122  UserVar checksum:  RTC_BASE_USERVAR + (sizeof(UserVar) / 4)
+// 122  UserVar checksums: RTC_BASE_USERVAR_CHECKSUM, one per RTC_USERVAR_BLOCK_TASKS tasks
 // 128  Cache (C016) metadata  4 blocks
 // 132  Cache (C016) data  6 blocks per sample => max 10 samples
 
@@ -114,18 +114,60 @@ boolean readFromRTC()
 /********************************************************************************************\
    Save values to RTC memory
  \*********************************************************************************************/
+static_assert(TASKS_MAX <= 32, "RTC_UserVar_dirty has one bit per task");
+
+// Mark the values of a task to be written to RTC memory by saveDirtyUserVarToRTC()
+void markUserVarDirtyRTC(taskIndex_t taskIndex)
+{
+  if (validTaskIndex(taskIndex)) {
+    RTC_UserVar_dirty |= (1ul << taskIndex);
+  }
+}
+
 boolean saveUserVarToRTC()
+{
+  for (taskIndex_t task = 0; task < TASKS_MAX; ++task) {
+    markUserVarDirtyRTC(task);
+  }
+  return saveDirtyUserVarToRTC();
+}
+
+// Only write the values of the changed tasks and the checksum of their block.
+boolean saveDirtyUserVarToRTC()
 {
   #if defined(ESP32)
+  RTC_UserVar_dirty = 0;
   return false;
   #else // if defined(ESP32)
 
-  // addLog(LOG_LEVEL_DEBUG, F("RTCMEM: saveUserVarToRTC"));
-  byte    *buffer = (byte *)&UserVar;
-  size_t   size   = sizeof(UserVar);
-  uint32_t sum    = calc_CRC32(buffer, size);
-  boolean  ret    = system_rtc_mem_write(RTC_BASE_USERVAR, buffer, size);
-  ret &= system_rtc_mem_write(RTC_BASE_USERVAR + (size >> 2), (byte *)&sum, 4);
+  if (RTC_UserVar_dirty == 0) {
+    return true;
+  }
+
+  // addLog(LOG_LEVEL_DEBUG, F("RTCMEM: saveDirtyUserVarToRTC"));
+  boolean ret = true;
+
+  for (byte block = 0; block < RTC_USERVAR_NR_BLOCKS; ++block) {
+    const taskIndex_t firstTask = block * RTC_USERVAR_BLOCK_TASKS;
+    const taskIndex_t lastTask  = min(firstTask + RTC_USERVAR_BLOCK_TASKS, TASKS_MAX);
+    bool blockDirty             = false;
+
+    for (taskIndex_t task = firstTask; task < lastTask; ++task) {
+      if (RTC_UserVar_dirty & (1ul << task)) {
+        blockDirty = true;
+        ret       &= system_rtc_mem_write(RTC_BASE_USERVAR + (task * VARS_PER_TASK),
+                                          (byte *)&UserVar[task * VARS_PER_TASK],
+                                          VARS_PER_TASK * sizeof(float));
+      }
+    }
+
+    if (blockDirty) {
+      uint32_t sum = calc_CRC32((byte *)&UserVar[firstTask * VARS_PER_TASK],
+                                (lastTask - firstTask) * VARS_PER_TASK * sizeof(float));
+      ret &= system_rtc_mem_write(RTC_BASE_USERVAR_CHECKSUM + block, (byte *)&sum, 4);
+    }
+  }
+  RTC_UserVar_dirty = 0;
   return ret;
   #endif // if defined(ESP32)
 }
@@ -140,19 +182,30 @@ boolean readUserVarFromRTC()
   #else // if defined(ESP32)
 
   // addLog(LOG_LEVEL_DEBUG, F("RTCMEM: readUserVarFromRTC"));
-  byte    *buffer = (byte *)&UserVar;
-  size_t   size   = sizeof(UserVar);
-  boolean  ret    = system_rtc_mem_read(RTC_BASE_USERVAR, buffer, size);
-  uint32_t sumRAM = calc_CRC32(buffer, size);
-  uint32_t sumRTC = 0;
-  ret &= system_rtc_mem_read(RTC_BASE_USERVAR + (size >> 2), (byte *)&sumRTC, 4);
-
-  if (!ret || (sumRTC != sumRAM))
-  {
-      # ifdef RTC_STRUCT_DEBUG
-    addLog(LOG_LEVEL_ERROR, F("RTC  : Checksum error on reading RTC user var"));
-      # endif // ifdef RTC_STRUCT_DEBUG
-    memset(buffer, 0, size);
+  boolean  ret = system_rtc_mem_read(RTC_BASE_USERVAR, (byte *)&UserVar, sizeof(UserVar));
+  uint32_t sumRTC[RTC_USERVAR_NR_BLOCKS];
+  ret &= system_rtc_mem_read(RTC_BASE_USERVAR_CHECKSUM, (byte *)&sumRTC[0], sizeof(sumRTC));
+  RTC_UserVar_dirty = 0;
+
+  // Only clear the blocks with a checksum error, the other task values can still be used.
+  for (byte block = 0; block < RTC_USERVAR_NR_BLOCKS; ++block) {
+    const taskIndex_t firstTask = block * RTC_USERVAR_BLOCK_TASKS;
+    const taskIndex_t lastTask  = min(firstTask + RTC_USERVAR_BLOCK_TASKS, TASKS_MAX);
+    byte  *buffer               = (byte *)&UserVar[firstTask * VARS_PER_TASK];
+    size_t size                 = (lastTask - firstTask) * VARS_PER_TASK * sizeof(float);
+
+    if (!ret || (sumRTC[block] != calc_CRC32(buffer, size)))
+    {
+        # ifdef RTC_STRUCT_DEBUG
+      addLog(LOG_LEVEL_ERROR, F("RTC  : Checksum error on reading RTC user var"));
+        # endif // ifdef RTC_STRUCT_DEBUG
+      memset(buffer, 0, size);
+
+      // Write the cleared values with a valid checksum on the next save.
+      for (taskIndex_t task = firstTask; task < lastTask; ++task) {
+        markUserVarDirtyRTC(task);
+      }
+    }
   }
   return ret;
   #endif // if defined(ESP32)
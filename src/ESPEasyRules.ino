@@ -6,6 +6,7 @@
 #include "src/Globals/Device.h"
 #include "src/Globals/Plugins.h"
 #include "src/Globals/Plugins_other.h"
+#include "src/Globals/RulesCompiled.h"
 #include "src/Helpers/ESPEasy_time_calc.h"
 
 String EventToFileName(const String& eventName) {
@@ -38,16 +39,21 @@ String FileNameToEvent(const String& fileName) {
   return eventName;
 }
 
-void checkRuleSets() {
-  for (byte x = 0; x < RULESETS_MAX; x++) {
+String getRuleSetFileName(byte rulesSet) {
 #if defined(ESP8266)
-    String fileName = F("rules");
+  String fileName = F("rules");
 #endif // if defined(ESP8266)
 #if defined(ESP32)
-    String fileName = F("/rules");
+  String fileName = F("/rules");
 #endif // if defined(ESP32)
-    fileName += x + 1;
-    fileName += F(".txt");
+  fileName += rulesSet + 1;
+  fileName += F(".txt");
+  return fileName;
+}
+
+void checkRuleSets() {
+  for (byte x = 0; x < RULESETS_MAX; x++) {
+    String fileName = getRuleSetFileName(x);
 
     if (ESPEASY_FS.exists(fileName)) {
       activeRuleSets[x] = true;
@@ -64,6 +70,9 @@ void checkRuleSets() {
       serialPrintln(String(activeRuleSets[x]));
     }
 #endif // ifndef BUILD_NO_DEBUG
+
+    // Rules file may have changed, so compile it again.
+    compileRuleSet(x);
   }
 }
 
@@ -84,6 +93,21 @@ bool processNextEvent() {
   return false;
 }
 
+/********************************************************************************************\
+   Process queued events until the queue is empty or the time budget is used.
+   At least one event is processed per call.
+ \*********************************************************************************************/
+void processEventQueue() {
+  const unsigned long start = millis();
+
+  while (processNextEvent()) {
+    if (timePassedSince(start) >= static_cast<long>(Settings.RulesEventsTimeBudget)) {
+      return;
+    }
+    delay(0);
+  }
+}
+
 
 /********************************************************************************************\
    Rules processing
@@ -93,7 +117,7 @@ void rulesProcessing(String& event) {
     return;
   }
   START_TIMER
-    checkRAM(F("rulesProcessing"));
+    checkRAM(RamProbe::rulesProcessing);
 #ifndef BUILD_NO_DEBUG
   unsigned long timer = millis();
 #endif // ifndef BUILD_NO_DEBUG
@@ -105,18 +129,26 @@ void rulesProcessing(String& event) {
   }
 
   if (Settings.OldRulesEngine()) {
-    for (byte x = 0; x < RULESETS_MAX; x++) {
-#if defined(ESP8266)
-      String fileName = F("rules");
-#endif // if defined(ESP8266)
-#if defined(ESP32)
-      String fileName = F("/rules");
-#endif // if defined(ESP32)
-      fileName += x + 1;
-      fileName += F(".txt");
+    const RulesEventParts eventParts(event);
+    std::vector<uint16_t> candidates;
 
+    for (byte x = 0; x < RULESETS_MAX; x++) {
       if (activeRuleSets[x]) {
-        rulesProcessingFile(fileName, event);
+        RulesCompiledFile& rules = compiledRuleSets[x];
+
+        if (!rules.compileAttempted) {
+          compileRuleSet(x);
+        }
+
+        if (!rules.indexed) {
+          rulesProcessingFile(getRuleSetFileName(x), event);
+        } else if (rules.getTriggerCandidates(eventParts, candidates)) {
+          if (rules.compiled) {
+            rulesProcessingCompiled(rules, event, eventParts, candidates);
+          } else {
+            rulesProcessingFile(getRuleSetFileName(x), event);
+          }
+        }
       }
     }
   } else {
@@ -150,6 +182,10 @@ void rulesProcessing(String& event) {
   backgroundtasks();
 }
 
+// Nesting level of rules processing, shared by the file and the compiled rules processing,
+// as an event may be processed by both, depending on the rules set.
+static byte rulesNestingLevel = 0;
+
 /********************************************************************************************\
    Rules processing
  \*********************************************************************************************/
@@ -157,7 +193,7 @@ String rulesProcessingFile(const String& fileName, String& event) {
   if (!Settings.UseRules || !fileExists(fileName)) {
     return "";
   }
-  checkRAM(F("rulesProcessingFile"));
+  checkRAM(RamProbe::rulesProcessingFile);
 #ifndef BUILD_NO_DEBUG
 
   if (Settings.SerialLogLevel == LOG_LEVEL_DEBUG_DEV) {
@@ -167,14 +203,13 @@ String rulesProcessingFile(const String& fileName, String& event) {
   }
 #endif // ifndef BUILD_NO_DEBUG
 
-  static byte nestingLevel = 0;
-  String log               = "";
+  String log = "";
 
-  nestingLevel++;
+  rulesNestingLevel++;
 
-  if (nestingLevel > RULES_MAX_NESTING_LEVEL) {
+  if (rulesNestingLevel > RULES_MAX_NESTING_LEVEL) {
     addLog(LOG_LEVEL_ERROR, F("EVENT: Error: Nesting level exceeded!"));
-    nestingLevel--;
+    rulesNestingLevel--;
     return log;
   }
 
@@ -184,7 +219,6 @@ String rulesProcessingFile(const String& fileName, String& event) {
   // Try to get the best possible estimate on line length based on earlier parsing of the rules.
   static size_t longestLineSize = RULES_BUFFER_SIZE;
   String line;
-  line.reserve(longestLineSize);
   bool match     = false;
   bool codeBlock = false;
   bool isCommand = false;
@@ -193,102 +227,429 @@ String rulesProcessingFile(const String& fileName, String& event) {
   byte ifBlock     = 0;
   byte fakeIfBlock = 0;
 
-  std::vector<byte> buf;
-  buf.resize(RULES_BUFFER_SIZE);
+  RulesFileLineReader reader(f, longestLineSize);
+
+  while (reader.readLine(line)) {
+    // Line end, parse rule
+    line.trim();
+    check_rules_line_user_errors(line);
+    const size_t lineLength = line.length();
 
-  bool firstNonSpaceRead = false;
-  bool commentFound      = false;
+    if (lineLength > longestLineSize) {
+      longestLineSize = lineLength;
+    }
 
-  while (f.available()) {
-    int len = f.read(&buf[0], RULES_BUFFER_SIZE);
+    if ((lineLength > 0) && !line.startsWith(F("//"))) {
+      // Parse the line and extract the action (if there is any)
+      String action;
+      parseCompleteNonCommentLine(line, event, action, match, codeBlock,
+                                  isCommand, ifBlock, fakeIfBlock);
+
+      if (match) // rule matched for one action or a block of actions
+      {
+        processMatchedRule(action, event, log, isCommand, condition, ifBranche, ifBlock, fakeIfBlock);
+      }
 
-    for (int x = 0; x < len; x++) {
-      int data = buf[x];
+      backgroundtasks();
+    }
+  }
 
-      SPIFFS_CHECK(data >= 0, fileName.c_str());
+  if (f) {
+    f.close();
+  }
 
-      switch (static_cast<char>(data))
+  rulesNestingLevel--;
+  checkRAM(RamProbe::rulesProcessingFile2);
+  return "";
+}
+
+
+/********************************************************************************************\
+   Compile a line of a rules block (or the action of a single line "on ... do") into a node.
+ \*********************************************************************************************/
+void compileRulesLine(RulesCompiledFile& rules, const String& line) {
+  String lcLine = line;
+
+  lcLine.toLowerCase();
+
+  if (lcLine.equals(F("endon"))) {
+    rules.addNode(RulesNode::Type::EndOn, "");
+    return;
+  }
+
+  // Same order of checks as in processMatchedRule()
+  int split = lcLine.indexOf(F("elseif "));
+
+  if (split != -1) {
+    String check = line.substring(split + 7);
+    check.trim();
+    rules.addNode(RulesNode::Type::ElseIf, check);
+  } else if ((split = lcLine.indexOf(F("if "))) != -1) {
+    String check = line.substring(split + 3);
+    check.trim();
+    rules.addNode(RulesNode::Type::If, check);
+  } else if (lcLine.equals(F("else"))) {
+    rules.addNode(RulesNode::Type::Else, "");
+  } else if (lcLine.equals(F("endif"))) {
+    rules.addNode(RulesNode::Type::EndIf, "");
+  } else {
+    rules.addNode(RulesNode::Type::Action, line);
+    return;
+  }
+  RulesNode& node = rules.nodes.back();
+
+  if (!node.dynamic) {
+    // Conditions are evaluated in lower case
+    node.text.toLowerCase();
+  }
+}
+
+void compileRulesTrigger(RulesCompiledFile& rules) {
+  RulesNode& node = rules.nodes.back();
+
+  if (node.dynamic) {
+    // Trigger will be parsed and converted to lower case when matching.
+    rules.addGenericTrigger();
+    return;
+  }
+  node.text.toLowerCase();
+
+  if (node.text.equals(F("*"))) {
+    rules.addGenericTrigger();
+    return;
+  }
+  int  posStart, posEnd;
+  char compare;
+
+  if (!findCompareCondition(node.text, compare, posStart, posEnd)) {
+    node.fastMatch = true;
+    rules.addTrigger(node.text.length());
+    return;
+  }
+  float ruleValue = 0;
+
+  if (validFloatFromString(node.text.substring(posEnd), ruleValue)) {
+    node.setCompare(compare, posStart, ruleValue);
+  }
+  rules.addTrigger(posStart);
+}
+
+/********************************************************************************************\
+   Compile a rules set into nodes which can be executed without reading the file.
+   Return true when the compiled rules can be used.
+ \*********************************************************************************************/
+bool compileRuleSet(byte rulesSet) {
+  if (rulesSet >= RULESETS_MAX) {
+    return false;
+  }
+  RulesCompiledFile& rules = compiledRuleSets[rulesSet];
+
+  rules.clear();
+
+  if (!Settings.UseRules) {
+    // Will be compiled when processing the first event after enabling rules.
+    return false;
+  }
+  rules.compileAttempted = true;
+
+  if (!activeRuleSets[rulesSet]) {
+    return false;
+  }
+  START_TIMER
+  checkRAM(RamProbe::compileRuleSet);
+
+  const String fileName = getRuleSetFileName(rulesSet);
+  fs::File     f        = tryOpenFile(fileName, "r");
+
+  if (!f) {
+    return false;
+  }
+  rules.reserve(f.size());
+
+  RulesFileLineReader reader(f, RULES_BUFFER_SIZE);
+  String line;
+  bool   codeBlock = false;
+
+  while (reader.readLine(line)) {
+    line.trim();
+    check_rules_line_user_errors(line);
+
+    if ((line.length() == 0) || line.startsWith(F("//"))) {
+      continue;
+    }
+    const bool lineStartsWith_on = line.substring(0, 3).equalsIgnoreCase(F("on "));
+
+    if (!codeBlock && !lineStartsWith_on) {
+      // Lines outside an "on ... do" block are never executed.
+      continue;
+    }
+    rules_strip_trailing_comments(line);
+
+    if (codeBlock) {
+      compileRulesLine(rules, line);
+
+      if (rules.nodes.back().type == RulesNode::Type::EndOn) {
+        codeBlock = false;
+      }
+      continue;
+    }
+
+    // Split "on <trigger> do <action>"
+    String lcLine = line;
+    lcLine.toLowerCase();
+    String eventTrigger;
+    String action;
+    const int split = lcLine.indexOf(F(" do"), 3);
+
+    if (split != -1) {
+      eventTrigger = line.substring(3, split);
+      action       = line.substring(split + 4);
+      eventTrigger.trim();
+      action.trim();
+    }
+    rules.addNode(RulesNode::Type::On, eventTrigger);
+    compileRulesTrigger(rules);
+
+    if (action.length() > 0) {
+      // single on/do/action line, no block
+      compileRulesLine(rules, action);
+      rules.addNode(RulesNode::Type::EndOn, "");
+    } else {
+      codeBlock = true;
+    }
+  }
+  f.close();
+
+  rules.finalizeIndex();
+  rules.compiled = true;
+
+  if (FreeMem() < RULES_COMPILED_MIN_FREE_HEAP) {
+    // Not enough memory left, fall back to reading the rules file on each event.
+    // The trigger index is kept to skip reading the file for events without a handler.
+    rules.clearNodes();
+  }
+
+  if (loglevelActiveFor(LOG_LEVEL_INFO)) {
+    String log = F("Rules: Compile ");
+    log += fileName;
+
+    log += F(" triggers: ");
+    log += rules.nrTriggers;
+
+    if (rules.compiled) {
+      log += F(" nodes: ");
+      log += rules.nodes.size();
+    } else {
+      log += F(" nodes skipped, low memory");
+    }
+    log += F(" bytes: ");
+    log += rules.getMemorySize();
+    addLog(LOG_LEVEL_INFO, log);
+  }
+  STOP_TIMER(RULES_COMPILE);
+  return rules.compiled;
+}
+
+bool compiledRuleMatch(const RulesNode& node, const String& event, const RulesEventParts& eventParts) {
+  if (!node.fastMatch || eventParts.special) {
+    String trigger = node.text;
+
+    if (node.dynamic) {
+      trigger = parseTemplate(trigger);
+      trigger.toLowerCase();
+      trigger.trim();
+    }
+
+    if (trigger.equals(F("*"))) { // wildcard, always process
+      return true;
+    }
+    return ruleMatch(event, trigger);
+  }
+
+  // Same checks as in ruleMatch(), using the pre-split trigger.
+  if (eventParts.trimmed.equalsIgnoreCase(node.text)) {
+    return true;
+  }
+
+  if (!eventParts.valueValid) {
+    return false;
+  }
+
+  if (node.compare == 0) {
+    return eventParts.name.equalsIgnoreCase(node.text);
+  }
+
+  if ((eventParts.name.length() != node.nameLength) ||
+      (strncasecmp(eventParts.name.c_str(), node.text.c_str(), node.nameLength) != 0)) {
+    return false;
+  }
+  return compareValues(node.compare, eventParts.value, node.value);
+}
+
+bool compiledRuleCondition(const RulesNode& node, const String& event, byte ifBlock, const __FlashStringHelper *label) {
+  String check = node.text;
+
+  if (node.dynamic || (substitute_eventvalue_CallBack_ptr != nullptr) || (parseTemplate_CallBack_ptr != nullptr)) {
+    substitute_eventvalue(check, event);
+    check = parseTemplate(check);
+    check.toLowerCase();
+    check.trim();
+  }
+  const bool result = conditionMatchExtended(check);
+
+#ifndef BUILD_NO_DEBUG
+
+  if (loglevelActiveFor(LOG_LEVEL_DEBUG)) {
+    String log = F("Lev.");
+    log += String(ifBlock);
+    log += F(": [");
+    log += label;
+    log += check;
+    log += F("]=");
+    log += boolToString(result);
+    addLog(LOG_LEVEL_DEBUG, log);
+  }
+#else // ifndef BUILD_NO_DEBUG
+  // Only used for logging
+  (void)ifBlock;
+  (void)label;
+#endif // ifndef BUILD_NO_DEBUG
+  return result;
+}
+
+/********************************************************************************************\
+   Rules processing using a compiled rules set.
+ \*********************************************************************************************/
+void rulesProcessingCompiled(RulesCompiledFile& rules, const String& event,
+                             const RulesEventParts& eventParts,
+                             const std::vector<uint16_t>& candidates) {
+  if (rulesNestingLevel >= RULES_MAX_NESTING_LEVEL) {
+    addLog(LOG_LEVEL_ERROR, F("EVENT: Error: Nesting level exceeded!"));
+    return;
+  }
+  ++rulesNestingLevel;
+
+  const uint16_t revision = rules.revision;
+
+  for (auto it = candidates.begin(); it != candidates.end() && rules.revision == revision; ++it) {
+    rulesProcessingCompiledBlock(rules, *it, event, eventParts);
+  }
+  --rulesNestingLevel;
+}
+
+/********************************************************************************************\
+   Process a single "on ... do" block of a compiled rules set, starting at the On node.
+ \*********************************************************************************************/
+void rulesProcessingCompiledBlock(RulesCompiledFile& rules, size_t onNodeIndex, const String& event,
+                                  const RulesEventParts& eventParts) {
+  if ((onNodeIndex >= rules.nodes.size()) ||
+      !compiledRuleMatch(rules.nodes[onNodeIndex], event, eventParts)) {
+    return;
+  }
+  const uint16_t revision = rules.revision;
+
+  bool condition[RULES_IF_MAX_NESTING_LEVEL];
+  bool ifBranche[RULES_IF_MAX_NESTING_LEVEL];
+  byte ifBlock     = 0;
+  byte fakeIfBlock = 0;
+
+  // Executing a command may cause the rules to be compiled again.
+  // Therefore check the revision and do not keep a reference to a node after executing a command.
+  for (size_t i = onNodeIndex + 1; i < rules.nodes.size() && rules.revision == revision; ++i) {
+    const RulesNode& node = rules.nodes[i];
+
+    switch (node.type) {
+      case RulesNode::Type::On:
+      case RulesNode::Type::EndOn:
+        // End of block
+        return;
+      case RulesNode::Type::ElseIf:
+
+        if (ifBlock && !fakeIfBlock && ifBranche[ifBlock - 1]) {
+          if (condition[ifBlock - 1]) {
+            ifBranche[ifBlock - 1] = false;
+          } else {
+            condition[ifBlock - 1] = compiledRuleCondition(node, event, ifBlock, F("elseif "));
+          }
+        }
+        break;
+      case RulesNode::Type::If:
       {
-        case '\n':
-        {
-          // Line end, parse rule
-          line.trim();
-          check_rules_line_user_errors(line);
-          const size_t lineLength = line.length();
-
-          if (lineLength > longestLineSize) {
-            longestLineSize = lineLength;
+        const bool isCommand = !fakeIfBlock &&
+                               (!ifBlock || (condition[ifBlock - 1] == ifBranche[ifBlock - 1]));
+
+        if (ifBlock < RULES_IF_MAX_NESTING_LEVEL) {
+          if (isCommand) {
+            ifBlock++;
+            condition[ifBlock - 1] = compiledRuleCondition(node, event, ifBlock, F("if "));
+            ifBranche[ifBlock - 1] = true;
+          } else {
+            fakeIfBlock++;
           }
+        } else {
+          fakeIfBlock++;
 
-          if ((lineLength > 0) && !line.startsWith(F("//"))) {
-            // Parse the line and extract the action (if there is any)
-            String action;
-            parseCompleteNonCommentLine(line, event, log, action, match, codeBlock,
-                                        isCommand, condition, ifBranche, ifBlock,
-                                        fakeIfBlock);
+          if (loglevelActiveFor(LOG_LEVEL_ERROR)) {
+            String log = F("Lev.");
+            log += String(ifBlock);
+            log += F(": Error: IF Nesting level exceeded!");
+            addLog(LOG_LEVEL_ERROR, log);
+          }
+        }
+        break;
+      }
+      case RulesNode::Type::Else:
 
-            if (match) // rule matched for one action or a block of actions
-            {
-              processMatchedRule(action, event, log, match, codeBlock,
-                                 isCommand, condition, ifBranche, ifBlock, fakeIfBlock);
-            }
+        if (!fakeIfBlock && ifBlock) {
+          ifBranche[ifBlock - 1] = false;
+#ifndef BUILD_NO_DEBUG
 
-            backgroundtasks();
+          if (loglevelActiveFor(LOG_LEVEL_DEBUG)) {
+            String log = F("Lev.");
+            log += String(ifBlock);
+            log += F(": [else]=");
+            log += boolToString(condition[ifBlock - 1] == ifBranche[ifBlock - 1]);
+            addLog(LOG_LEVEL_DEBUG, log);
           }
+#endif // ifndef BUILD_NO_DEBUG
+        }
+        break;
+      case RulesNode::Type::EndIf:
 
-          // Prepare for new line
-          line = "";
-          line.reserve(longestLineSize);
-          firstNonSpaceRead = false;
-          commentFound      = false;
-          break;
+        if (fakeIfBlock) {
+          fakeIfBlock--;
         }
-        case '\r': // Just skip this character
-          break;
-        case '\t': // tab
-        case ' ':  // space
-        {
-          // Strip leading spaces.
-          if (firstNonSpaceRead) {
-            line += ' ';
-          }
-          break;
+        else if (ifBlock) {
+          ifBlock--;
         }
-        case '/':
-        {
-          if (!commentFound) {
-            line += '/';
-
-            if (line.endsWith("//")) {
-              // consider the rest of the line a comment
-              commentFound = true;
-            }
-          }
+        break;
+      case RulesNode::Type::Action:
+      {
+        if (fakeIfBlock || (ifBlock && (condition[ifBlock - 1] != ifBranche[ifBlock - 1]))) {
           break;
         }
-        default: // Any other character
-        {
-          firstNonSpaceRead = true;
+        String action = node.text;
 
-          if (!commentFound) {
-            line += char(data);
-          }
-          break;
+        if (node.dynamic || (substitute_eventvalue_CallBack_ptr != nullptr) || (parseTemplate_CallBack_ptr != nullptr)) {
+          substitute_eventvalue(action, event);
+          action = parseTemplate(action);
+          substitute_eventvalue(action, event);
+        }
+
+        if (loglevelActiveFor(LOG_LEVEL_INFO)) {
+          String log = F("ACT  : ");
+          log += action;
+          addLog(LOG_LEVEL_INFO, log);
         }
+
+        ExecuteCommand_all(EventValueSource::Enum::VALUE_SOURCE_RULES, action.c_str());
+        backgroundtasks();
+        break;
       }
     }
   }
-
-  if (f) {
-    f.close();
-  }
-
-  nestingLevel--;
-  checkRAM(F("rulesProcessingFile2"));
-  return "";
 }
 
-
 /********************************************************************************************\
    Strip comment from the line.
    Return true when comment was stripped.
@@ -524,10 +885,9 @@ void substitute_eventvalue(String& line, const String& event) {
   }
 }
 
-void parseCompleteNonCommentLine(String& line, String& event, String& log,
+void parseCompleteNonCommentLine(String& line, String& event,
                                  String& action, bool& match,
                                  bool& codeBlock, bool& isCommand,
-                                 bool condition[], bool ifBranche[],
                                  byte& ifBlock, byte& fakeIfBlock) {
   const bool lineStartsWith_on = line.substring(0, 3).equalsIgnoreCase(F("on "));
 
@@ -630,8 +990,7 @@ void parseCompleteNonCommentLine(String& line, String& event, String& log,
 }
 
 void processMatchedRule(String& action, String& event,
-                        String& log, bool& match, bool& codeBlock,
-                        bool& isCommand, bool condition[], bool ifBranche[],
+                        String& log, bool& isCommand, bool condition[], bool ifBranche[],
                         byte& ifBlock, byte& fakeIfBlock) {
   String lcAction = action;
 
@@ -766,7 +1125,7 @@ void processMatchedRule(String& action, String& event,
    Check if an event matches to a given rule
  \*********************************************************************************************/
 bool ruleMatch(const String& event, const String& rule) {
-  checkRAM(F("ruleMatch"));
+  checkRAM(RamProbe::ruleMatch);
 
   String tmpEvent = event;
   String tmpRule  = rule;
@@ -857,7 +1216,7 @@ bool ruleMatch(const String& event, const String& rule) {
   if (stringMatch) {
     match = compareValues(compare, value, ruleValue);
   }
-  checkRAM(F("ruleMatch2"));
+  checkRAM(RamProbe::ruleMatch2);
   return match;
 }
 
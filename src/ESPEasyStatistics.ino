@@ -1,5 +1,11 @@
 #include "ESPEasy_common.h"
 
+#include "src/DataStructs/Caches.h"
+#include "src/Globals/Cache.h"
+#include "src/Globals/ControllerHTTPClients.h"
+#include "src/Globals/Device.h"
+#include "src/Globals/Protocol.h"
+
 #ifdef USES_TIMING_STATS
 
 /*
@@ -55,9 +61,49 @@ void stream_json_timing_stats(const TimingStats& stats, long timeSinceLastReset)
   json_number(F("min"),   String(minVal));
   json_number(F("max"),   String(maxVal));
   json_number(F("avg"),   String(stats.getAvg()));
+  json_number(F("p50"),   String(stats.getPercentile(50)));
+  json_number(F("p90"),   String(stats.getPercentile(90)));
+  json_number(F("p99"),   String(stats.getPercentile(99)));
+
+  if (stats.hasBytes()) {
+    json_number(F("bytes-per-sec"), String(stats.getBytesPerSec()));
+  }
   json_prop(F("unit"), F("usec"));
 }
 
+// Description and function name of an entry in pluginStats, controllerStats or miscStats
+void getTimingStatsDescription(byte kind, int key, String& description, String& function) {
+  switch (kind) {
+    case TIMING_STATS_PLUGIN:
+    {
+      const deviceIndex_t deviceIndex = static_cast<deviceIndex_t>(key / 256);
+
+      if (validDeviceIndex(deviceIndex)) {
+        description  = F("P_");
+        description += Device[deviceIndex].Number;
+        description += '_';
+        description += getPluginNameFromDeviceIndex(deviceIndex);
+      }
+      function = getPluginFunctionName(key % 256);
+      break;
+    }
+    case TIMING_STATS_CONTROLLER:
+    {
+      const int ProtocolIndex = key / 256;
+      description  = F("C_");
+      description += Protocol[ProtocolIndex].Number;
+      description += '_';
+      description += getCPluginNameFromProtocolIndex(ProtocolIndex);
+      function     = getCPluginCFunctionName(static_cast<CPlugin::Function>(key % 256));
+      break;
+    }
+    default:
+      description = getMiscStatsName(key);
+      function    = String();
+      break;
+  }
+}
+
 void jsonStatistics(bool clearStats) {
   bool firstPlugin     = true;
   int  currentPluginId = -1;
@@ -159,6 +205,20 @@ void jsonStatistics(bool clearStats) {
       json_open(false, to_internal_string(getMiscStatsName(x.first), '-'));
       {
         stream_json_timing_stats(x.second, timeSinceLastReset);
+
+        if (x.first == LOAD_TASK_SETTINGS) {
+          json_number(F("cache-hit"),  String(Cache.extraTaskSettings.hits));
+          json_number(F("cache-miss"), String(Cache.extraTaskSettings.misses));
+        }
+
+        if ((x.first >= C001_DELAY_QUEUE) && (x.first <= C020_DELAY_QUEUE)) {
+          auto it = controllerHTTPClients.find(x.first - C001_DELAY_QUEUE + 1);
+
+          if (it != controllerHTTPClients.end()) {
+            json_number(F("connect"), String(it->second.connects));
+            json_number(F("reuse"),   String(it->second.reuses));
+          }
+        }
       }
       json_close(false);
       json_close();     // close first function element
@@ -170,8 +230,32 @@ void jsonStatistics(bool clearStats) {
 
   json_close(true);   // Close misc list
 
+
+  json_open(true, F("worst"));
+
+  for (byte i = 0; i < timingStatsWorst.size(); ++i) {
+    const TimingStatsWorstEntry& entry = timingStatsWorst[i];
+    String description;
+    String function;
+    getTimingStatsDescription(entry.kind, entry.key, description, function);
+    json_open();
+    json_prop(F("name"), description);
+    json_prop(F("function"), function);
+    json_number(F("duration"),  String(entry.duration));
+    json_number(F("timestamp"), String(entry.timestamp));
+    json_number(F("age"),       String(timePassedSince(entry.timestamp)));
+    json_close();
+  }
+  json_close(true);   // Close worst list
+
   if (clearStats) {
     timingstats_last_reset = millis();
+    timingStatsWorst.reset();
+
+    for (auto& x: controllerHTTPClients) {
+      x.second.connects = 0;
+      x.second.reuses   = 0;
+    }
   }
 }
 
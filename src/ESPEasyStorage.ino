@@ -1,3 +1,4 @@
+#include "src/DataStructs/Caches.h"
 #include "src/Globals/Cache.h"
 #include "src/Globals/CRCValues.h"
 #include "src/Globals/ResetFactoryDefaultPref.h"
@@ -37,7 +38,7 @@ void flashCount()
 
 String flashGuard()
 {
-  checkRAM(F("flashGuard"));
+  checkRAM(RamProbe::flashGuard);
 
   if (RTC.flashDayCounter > MAX_FLASHWRITES_PER_DAY)
   {
@@ -112,7 +113,7 @@ bool tryDeleteFile(const String& fname) {
  \*********************************************************************************************/
 String BuildFixes()
 {
-  checkRAM(F("BuildFixes"));
+  checkRAM(RamProbe::BuildFixes);
   serialPrintln(F("\nBuild changed!"));
 
   if (Settings.Build < 145)
@@ -196,7 +197,7 @@ String BuildFixes()
  \*********************************************************************************************/
 void fileSystemCheck()
 {
-  checkRAM(F("fileSystemCheck"));
+  checkRAM(RamProbe::fileSystemCheck);
   addLog(LOG_LEVEL_INFO, F("FS   : Mounting..."));
 
   if (ESPEASY_FS.begin())
@@ -267,7 +268,7 @@ bool GarbageCollection() {
  \*********************************************************************************************/
 String SaveSettings(void)
 {
-  checkRAM(F("SaveSettings"));
+  checkRAM(RamProbe::SaveSettings);
   MD5Builder md5;
   uint8_t    tmp_md5[16] = { 0 };
   String     err;
@@ -346,7 +347,7 @@ void afterloadSettings() {
  \*********************************************************************************************/
 String LoadSettings()
 {
-  checkRAM(F("LoadSettings"));
+  checkRAM(RamProbe::LoadSettings);
   String  err;
   uint8_t calculatedMd5[16];
   MD5Builder md5;
@@ -357,6 +358,7 @@ String LoadSettings()
     return err;
   }
   Settings.validate();
+  Cache.pluginCallbacks.invalidate();
 
   // FIXME @TD-er: As discussed in #1292, the CRC for the settings is now disabled.
 
@@ -622,7 +624,7 @@ String SaveStringArray(SettingsType::Enum settingsType, int index, const String
  \*********************************************************************************************/
 String SaveTaskSettings(taskIndex_t TaskIndex)
 {
-  checkRAM(F("SaveTaskSettings"));
+  checkRAM(RamProbe::SaveTaskSettings);
 
   if (ExtraTaskSettings.TaskIndex != TaskIndex) {
     return F("SaveTaskSettings taskIndex does not match");
@@ -632,6 +634,9 @@ String SaveTaskSettings(taskIndex_t TaskIndex)
                           (byte *)&ExtraTaskSettings,
                           sizeof(struct ExtraTaskSettingsStruct));
 
+  // Saving already clears all caches, but make sure the cached copy will be reloaded.
+  Cache.extraTaskSettings.invalidate(TaskIndex);
+
   if (err.length() == 0) {
     err = checkTaskSettings(TaskIndex);
   }
@@ -650,7 +655,11 @@ String LoadTaskSettings(taskIndex_t TaskIndex)
   if (!validTaskIndex(TaskIndex)) {
     return String(); // Un-initialized task index.
   }
-  checkRAM(F("LoadTaskSettings"));
+  checkRAM(RamProbe::LoadTaskSettings);
+
+  if (Cache.extraTaskSettings.get(TaskIndex, ExtraTaskSettings)) {
+    return String();
+  }
 
   START_TIMER
   ExtraTaskSettings.clear();
@@ -671,6 +680,10 @@ String LoadTaskSettings(taskIndex_t TaskIndex)
     PluginCall(PLUGIN_GET_DEVICEVALUENAMES, &TempEvent, tmp);
   }
   ExtraTaskSettings.validate();
+
+  if (result.length() == 0) {
+    Cache.extraTaskSettings.store(ExtraTaskSettings);
+  }
   STOP_TIMER(LOAD_TASK_SETTINGS);
 
   return result;
@@ -681,7 +694,7 @@ String LoadTaskSettings(taskIndex_t TaskIndex)
  \*********************************************************************************************/
 String SaveCustomTaskSettings(taskIndex_t TaskIndex, byte *memAddress, int datasize)
 {
-  checkRAM(F("SaveCustomTaskSettings"));
+  checkRAM(RamProbe::SaveCustomTaskSettings);
   return SaveToFile(SettingsType::CustomTaskSettings_Type, TaskIndex, memAddress, datasize);
 }
 
@@ -691,7 +704,7 @@ String SaveCustomTaskSettings(taskIndex_t TaskIndex, byte *memAddress, int datas
  \*********************************************************************************************/
 String SaveCustomTaskSettings(taskIndex_t TaskIndex, String strings[], uint16_t nrStrings, uint16_t maxStringLength)
 {
-  checkRAM(F("SaveCustomTaskSettings"));
+  checkRAM(RamProbe::SaveCustomTaskSettings);
   return SaveStringArray(
     SettingsType::CustomTaskSettings_Type, TaskIndex,
     strings, nrStrings, maxStringLength);
@@ -720,7 +733,7 @@ String ClearCustomTaskSettings(taskIndex_t TaskIndex)
 String LoadCustomTaskSettings(taskIndex_t TaskIndex, byte *memAddress, int datasize)
 {
   START_TIMER;
-  checkRAM(F("LoadCustomTaskSettings"));
+  checkRAM(RamProbe::LoadCustomTaskSettings);
   String result = LoadFromFile(SettingsType::CustomTaskSettings_Type, TaskIndex, memAddress, datasize);
   STOP_TIMER(LOAD_CUSTOM_TASK_STATS);
   return result;
@@ -733,7 +746,7 @@ String LoadCustomTaskSettings(taskIndex_t TaskIndex, byte *memAddress, int datas
 String LoadCustomTaskSettings(taskIndex_t TaskIndex, String strings[], uint16_t nrStrings, uint16_t maxStringLength)
 {
   START_TIMER;
-  checkRAM(F("LoadCustomTaskSettings"));
+  checkRAM(RamProbe::LoadCustomTaskSettings);
   String result = LoadStringArray(SettingsType::CustomTaskSettings_Type,
                            TaskIndex,
                            strings, nrStrings, maxStringLength);
@@ -746,7 +759,7 @@ String LoadCustomTaskSettings(taskIndex_t TaskIndex, String strings[], uint16_t
  \*********************************************************************************************/
 String SaveControllerSettings(controllerIndex_t ControllerIndex, ControllerSettingsStruct& controller_settings)
 {
-  checkRAM(F("SaveControllerSettings"));
+  checkRAM(RamProbe::SaveControllerSettings);
   controller_settings.validate(); // Make sure the saved controller settings have proper values.
   return SaveToFile(SettingsType::ControllerSettings_Type, ControllerIndex,
                     (byte *)&controller_settings, sizeof(controller_settings));
@@ -756,7 +769,7 @@ String SaveControllerSettings(controllerIndex_t ControllerIndex, ControllerSetti
    Load Controller settings to file system
  \*********************************************************************************************/
 String LoadControllerSettings(controllerIndex_t ControllerIndex, ControllerSettingsStruct& controller_settings) {
-  checkRAM(F("LoadControllerSettings"));
+  checkRAM(RamProbe::LoadControllerSettings);
   String result =
     LoadFromFile(SettingsType::ControllerSettings_Type, ControllerIndex,
                  (byte *)&controller_settings, sizeof(controller_settings));
@@ -769,7 +782,7 @@ String LoadControllerSettings(controllerIndex_t ControllerIndex, ControllerSetti
  \*********************************************************************************************/
 String ClearCustomControllerSettings(controllerIndex_t ControllerIndex)
 {
-  checkRAM(F("ClearCustomControllerSettings"));
+  checkRAM(RamProbe::ClearCustomControllerSettings);
 
   // addLog(LOG_LEVEL_DEBUG, F("Clearing custom controller settings"));
   return ClearInFile(SettingsType::CustomControllerSettings_Type, ControllerIndex);
@@ -780,7 +793,7 @@ String ClearCustomControllerSettings(controllerIndex_t ControllerIndex)
  \*********************************************************************************************/
 String SaveCustomControllerSettings(controllerIndex_t ControllerIndex, byte *memAddress, int datasize)
 {
-  checkRAM(F("SaveCustomControllerSettings"));
+  checkRAM(RamProbe::SaveCustomControllerSettings);
   return SaveToFile(SettingsType::CustomControllerSettings_Type, ControllerIndex, memAddress, datasize);
 }
 
@@ -789,7 +802,7 @@ String SaveCustomControllerSettings(controllerIndex_t ControllerIndex, byte *mem
  \*********************************************************************************************/
 String LoadCustomControllerSettings(controllerIndex_t ControllerIndex, byte *memAddress, int datasize)
 {
-  checkRAM(F("LoadCustomControllerSettings"));
+  checkRAM(RamProbe::LoadCustomControllerSettings);
   return LoadFromFile(SettingsType::CustomControllerSettings_Type, ControllerIndex, memAddress, datasize);
 }
 
@@ -798,7 +811,7 @@ String LoadCustomControllerSettings(controllerIndex_t ControllerIndex, byte *mem
  \*********************************************************************************************/
 String SaveNotificationSettings(int NotificationIndex, byte *memAddress, int datasize)
 {
-  checkRAM(F("SaveNotificationSettings"));
+  checkRAM(RamProbe::SaveNotificationSettings);
   return SaveToFile(SettingsType::NotificationSettings_Type, NotificationIndex, memAddress, datasize);
 }
 
@@ -807,7 +820,7 @@ String SaveNotificationSettings(int NotificationIndex, byte *memAddress, int dat
  \*********************************************************************************************/
 String LoadNotificationSettings(int NotificationIndex, byte *memAddress, int datasize)
 {
-  checkRAM(F("LoadNotificationSettings"));
+  checkRAM(RamProbe::LoadNotificationSettings);
   return LoadFromFile(SettingsType::NotificationSettings_Type, NotificationIndex, memAddress, datasize);
 }
 
@@ -816,7 +829,7 @@ String LoadNotificationSettings(int NotificationIndex, byte *memAddress, int dat
  \*********************************************************************************************/
 String InitFile(const String& fname, int datasize)
 {
-  checkRAM(F("InitFile"));
+  checkRAM(RamProbe::InitFile);
   FLASH_GUARD();
 
   fs::File f = tryOpenFile(fname, "w");
@@ -868,7 +881,7 @@ String doSaveToFile(const char *fname, int index, const byte *memAddress, int da
     return log;
   }
   START_TIMER;
-  checkRAM(F("SaveToFile"));
+  checkRAM(RamProbe::SaveToFile);
   FLASH_GUARD();
 
   if (loglevelActiveFor(LOG_LEVEL_INFO)) {
@@ -877,33 +890,13 @@ String doSaveToFile(const char *fname, int index, const byte *memAddress, int da
     addLog(LOG_LEVEL_INFO, log);
   }
   delay(1);
-  unsigned long timer = millis() + 50;
-  fs::File f          = tryOpenFile(fname, mode);
+  fs::File f = tryOpenFile(fname, mode);
 
   if (f) {
     clearAllCaches();
-    SPIFFS_CHECK(f,                          fname);
-    SPIFFS_CHECK(f.seek(index, fs::SeekSet), fname);
-    const byte *pointerToByteToSave = memAddress;
-
-    for (int x = 0; x < datasize; x++)
-    {
-      // See https://github.com/esp8266/Arduino/commit/b1da9eda467cc935307d553692fdde2e670db258#r32622483
-      uint8_t byteToSave = *pointerToByteToSave;
-      SPIFFS_CHECK(f.write(&byteToSave, 1), fname);
-      pointerToByteToSave++;
-
-      if (x % 256 == 0) {
-        // one page written, do some background tasks
-        timer = millis() + 50;
-        delay(0);
-      }
-
-      if (timeOutReached(timer)) {
-        timer += 50;
-        delay(0);
-      }
-    }
+    SPIFFS_CHECK(f,                                      fname);
+    SPIFFS_CHECK(f.seek(index, fs::SeekSet),             fname);
+    SPIFFS_CHECK(writeFilePages(f, memAddress, datasize), fname);
     f.close();
 
     if (loglevelActiveFor(LOG_LEVEL_INFO)) {
@@ -918,7 +911,7 @@ String doSaveToFile(const char *fname, int index, const byte *memAddress, int da
     addLog(LOG_LEVEL_ERROR, log);
     return log;
   }
-  STOP_TIMER(SAVEFILE_STATS);
+  STOP_TIMER_BYTES(SAVEFILE_STATS, datasize);
 
   if (loglevelActiveFor(LOG_LEVEL_INFO)) {
     String log = F("SaveToFile: free stack after: ");
@@ -930,6 +923,44 @@ String doSaveToFile(const char *fname, int index, const byte *memAddress, int da
   return String();
 }
 
+/********************************************************************************************\
+   Write data to an open file in chunks of a file system page.
+   When memAddress is nullptr, the area is filled with zeroes.
+   Return false when not all data could be written.
+ \*********************************************************************************************/
+bool writeFilePages(fs::File& f, const byte *memAddress, int datasize)
+{
+  // Data is copied into a page buffer, as the file system should not write directly
+  // from the source memory.
+  // See https://github.com/esp8266/Arduino/commit/b1da9eda467cc935307d553692fdde2e670db258#r32622483
+  uint8_t page[FILE_WRITE_PAGE_SIZE];
+
+  if (memAddress == nullptr) {
+    // Zero page is reused for all writes.
+    memset(page, 0, sizeof(page));
+  }
+
+  for (int pos = 0; pos < datasize; pos += FILE_WRITE_PAGE_SIZE) {
+    int chunkSize = datasize - pos;
+
+    if (chunkSize > FILE_WRITE_PAGE_SIZE) {
+      chunkSize = FILE_WRITE_PAGE_SIZE;
+    }
+
+    if (memAddress != nullptr) {
+      memcpy(page, memAddress + pos, chunkSize);
+    }
+
+    if (f.write(page, chunkSize) != static_cast<size_t>(chunkSize)) {
+      return false;
+    }
+
+    // one page written, do some background tasks
+    delay(0);
+  }
+  return true;
+}
+
 /********************************************************************************************\
    Clear a certain area in a file (set to 0)
  \*********************************************************************************************/
@@ -943,22 +974,18 @@ String ClearInFile(const char *fname, int index, int datasize)
     return log;
   }
 
-  checkRAM(F("ClearInFile"));
+  START_TIMER;
+  checkRAM(RamProbe::ClearInFile);
   FLASH_GUARD();
 
   fs::File f = tryOpenFile(fname, "r+");
 
   if (f) {
-    SPIFFS_CHECK(f,                          fname);
+    SPIFFS_CHECK(f,                                   fname);
 
-    SPIFFS_CHECK(f.seek(index, fs::SeekSet), fname);
+    SPIFFS_CHECK(f.seek(index, fs::SeekSet),          fname);
 
-    for (int x = 0; x < datasize; x++)
-    {
-      // See https://github.com/esp8266/Arduino/commit/b1da9eda467cc935307d553692fdde2e670db258#r32622483
-      uint8_t zero_value = 0;
-      SPIFFS_CHECK(f.write(&zero_value, 1), fname);
-    }
+    SPIFFS_CHECK(writeFilePages(f, nullptr, datasize), fname);
     f.close();
   } else {
     String log = F("ClearInFile: ");
@@ -967,6 +994,7 @@ String ClearInFile(const char *fname, int index, int datasize)
     addLog(LOG_LEVEL_ERROR, log);
     return log;
   }
+  STOP_TIMER_BYTES(SAVEFILE_STATS, datasize);
 
   // OK
   return String();
@@ -987,7 +1015,7 @@ String LoadFromFile(const char *fname, int offset, byte *memAddress, int datasiz
   delay(1);
   START_TIMER;
 
-  checkRAM(F("LoadFromFile"));
+  checkRAM(RamProbe::LoadFromFile);
   fs::File f = tryOpenFile(fname, "r");
   SPIFFS_CHECK(f,                            fname);
   SPIFFS_CHECK(f.seek(offset, fs::SeekSet),  fname);
@@ -1084,7 +1112,7 @@ String ClearInFile(SettingsType::Enum settingsType, int index) {
  \*********************************************************************************************/
 int SpiffsSectors()
 {
-  checkRAM(F("SpiffsSectors"));
+  checkRAM(RamProbe::SpiffsSectors);
   #if defined(ESP8266)
     # ifdef CORE_POST_2_6_0
   uint32_t _sectorStart = ((uint32_t)&_FS_start - 0x40200000) / SPI_FLASH_SEC_SIZE;
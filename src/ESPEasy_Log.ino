@@ -55,7 +55,7 @@ void addToLog(byte loglevel, const String& string)
 
 void addToLog(byte logLevel, const __FlashStringHelper* flashString)
 {
-    checkRAM(F("addToLog"));
+    checkRAM(RamProbe::addToLog);
     String s(flashString);
     addToLog(logLevel, s.c_str());
 }
@@ -163,31 +163,150 @@ bool loglevelActive(byte logLevel, byte logLevelSettings) {
 
 void addToLog(byte logLevel, const char *line)
 {
-  if (loglevelActiveFor(LOG_TO_SERIAL, logLevel)) {
-    addToSerialBuffer(String(millis()).c_str());
-    addToSerialBuffer(" : ");
-    String loglevelDisplayString = getLogLevelDisplayString(logLevel);
-    while (loglevelDisplayString.length() < 6) {
-      loglevelDisplayString += ' ';
+  // Only store the record, the text is formatted when a destination reads it.
+  byte destinations = 0;
+  for (byte destination = LOG_TO_SERIAL; destination <= LOG_TO_SDCARD; ++destination) {
+    if (loglevelActiveFor(destination, logLevel)) {
+      destinations |= (1 << (destination - 1));
     }
-    addToSerialBuffer(loglevelDisplayString.c_str());
-    addToSerialBuffer(": ");
-    addToSerialBuffer(line);
-    addNewlineToSerialBuffer();
   }
-  if (loglevelActiveFor(LOG_TO_SYSLOG, logLevel)) {
-    syslog(logLevel, line);
+  if (destinations == 0) {
+    return;
+  }
+  const size_t linelength = strlen(line);
+
+  if (!LogStruct::fits(linelength)) {
+    // Too long for the log buffer, write it straight through.
+    // Only the web log has to read it from the log buffer, clipped.
+    destinations = addToLog_direct(logLevel, destinations, line, linelength);
+  }
+
+  if (Logging.mustOverwriteUnread(LOG_TO_SERIAL, linelength)) {
+    // Send the pending lines first, instead of overwriting them (e.g. burst of lines during setup)
+    flush_serialLog();
+  }
+  Logging.add(logLevel, destinations, line);
+}
+
+/********************************************************************************************\
+  Write a log line to the destinations which do not need the log buffer.
+  Return the destinations left.
+  \*********************************************************************************************/
+byte addToLog_direct(byte logLevel, byte destinations, const char *line, size_t linelength)
+{
+  if (destinations & (1 << (LOG_TO_SERIAL - 1))) {
+    // Keep the order with the buffered lines.
+    flush_serialLog();
+    char prefix[32];
+    const int prefixLength = formatSerialLogPrefix(prefix, sizeof(prefix), millis(), logLevel);
+    serialWriteDirect(prefix, prefixLength);
+    serialWriteDirect(line, linelength);
+    serialWriteDirect("\r\n", 2);
   }
-  if (loglevelActiveFor(LOG_TO_WEBLOG, logLevel)) {
-    Logging.add(logLevel, line);
+
+  if (destinations & (1 << (LOG_TO_SYSLOG - 1))) {
+    syslog(logLevel, line);
   }
 
 #ifdef FEATURE_SD
-  if (loglevelActiveFor(LOG_TO_SDCARD, logLevel)) {
+  if (destinations & (1 << (LOG_TO_SDCARD - 1))) {
+    process_logBuffer();
     File logFile = SD.open("log.dat", FILE_WRITE);
     if (logFile)
       logFile.println(line);
     logFile.close();
   }
+#endif
+  return destinations & (1 << (LOG_TO_WEBLOG - 1));
+}
+
+// Format the "millis : Level : " prefix of a serial log line.
+int formatSerialLogPrefix(char *prefix, size_t size, uint32_t timestamp, byte logLevel) {
+  String loglevelDisplayString = getLogLevelDisplayString(logLevel);
+  return snprintf_P(prefix, size, PSTR("%lu : %-6s: "),
+                    static_cast<unsigned long>(timestamp), loglevelDisplayString.c_str());
+}
+
+/********************************************************************************************\
+  Format the buffered log records for the serial port
+  \*********************************************************************************************/
+void process_serialLog() {
+  LogRecord record;
+  while (Logging.peekNext(LOG_TO_SERIAL, record)) {
+    char prefix[32];
+    const int prefixLength = formatSerialLogPrefix(prefix, sizeof(prefix), record.timestamp, record.loglevel);
+    const size_t lineSize  = prefixLength + record.length + 2u;
+
+    // Only add complete lines, keep the record in the log buffer until there is room.
+    // A line larger than the serial write buffer is written directly, once the buffer is empty.
+    const bool direct = lineSize > SERIAL_WRITE_BUFFER_SIZE;
+    if (direct ? !serialWriteBuffer.empty() : (serialWriteBuffer.getFree() < lineSize)) {
+      return;
+    }
+    Logging.getNext(LOG_TO_SERIAL, record);
+    const char *data;
+    size_t offset = 0;
+    size_t partSize;
+
+    if (direct) {
+      serialWriteDirect(prefix, prefixLength);
+      while ((partSize = Logging.getMessagePart(record, offset, data)) > 0) {
+        serialWriteDirect(data, partSize);
+        offset += partSize;
+      }
+      serialWriteDirect("\r\n", 2);
+    } else {
+      serialWriteBuffer.add(prefix, prefixLength);
+      while ((partSize = Logging.getMessagePart(record, offset, data)) > 0) {
+        serialWriteBuffer.add(data, partSize);
+        offset += partSize;
+      }
+      serialWriteBuffer.add("\r\n", 2);
+    }
+  }
+}
+
+/********************************************************************************************\
+  Send all buffered log records to the serial port, wait until they are written
+  \*********************************************************************************************/
+void flush_serialLog() {
+  do {
+    process_serialLog();
+
+    if (!flush_serialWriteBuffer()) {
+      return;
+    }
+  } while (!Logging.isEmpty(LOG_TO_SERIAL));
+}
+
+/********************************************************************************************\
+  Send the buffered log records to syslog and SD card
+  \*********************************************************************************************/
+void process_logBuffer() {
+  LogRecord record;
+  while (Logging.getNext(LOG_TO_SYSLOG, record)) {
+    // Copy the text, syslog() may add log lines itself.
+    const String message = Logging.getMessage(record);
+    syslog(record.loglevel, message.c_str());
+  }
+
+#ifdef FEATURE_SD
+  if (!Logging.isEmpty(LOG_TO_SDCARD)) {
+    File logFile = SD.open("log.dat", FILE_WRITE);
+    while (Logging.getNext(LOG_TO_SDCARD, record)) {
+      if (logFile) {
+        const char *data;
+        size_t offset = 0;
+        size_t partSize;
+
+        while ((partSize = Logging.getMessagePart(record, offset, data)) > 0) {
+          logFile.write(reinterpret_cast<const uint8_t *>(data), partSize);
+          offset += partSize;
+        }
+        logFile.println();
+      }
+    }
+    logFile.close();
+  }
 #endif
 }
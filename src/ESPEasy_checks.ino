@@ -3,6 +3,7 @@
 #include "src/DataStructs/NodeStruct.h"
 #include "src/DataStructs/CRCStruct.h"
 #include "src/DataStructs/SettingsStruct.h"
+#include "src/DataStructs/StorageLayout.h"
 
 // ********************************************************************************
 // Check struct sizes at compile time
@@ -38,18 +39,19 @@ void run_compiletime_checks() {
   check_size<SecurityStruct,                        593u>();
   const unsigned int SettingsStructSize = (252 + 82 * TASKS_MAX);
   check_size<SettingsStruct,                        SettingsStructSize>();
-  check_size<ControllerSettingsStruct,              820u>();
+  check_size<ControllerSettingsStruct,              828u>();
+  static_assert(sizeof(ControllerSettingsStruct) <= DAT_CONTROLLER_SIZE, "ControllerSettingsStruct does not fit in its settings block");
   #ifdef USES_NOTIFIER
   check_size<NotificationSettingsStruct,            996u>();
   #endif
   check_size<ExtraTaskSettingsStruct,               472u>();
   check_size<EventStruct,                           96u>(); // Is not stored
 
-  // LogStruct is mainly dependent on the number of lines.
+  // LogStruct is mainly dependent on the size of the record buffer.
   // Has to be round up to multiple of 4.
-  const unsigned int LogStructSize = ((12u + 17 * LOG_STRUCT_MESSAGE_LINES) + 3) & ~3;
+  const unsigned int LogStructSize = ((44u + LOG_STRUCT_ARENA_SIZE) + 3) & ~3;
   check_size<LogStruct,                             LogStructSize>(); // Is not stored
-  check_size<DeviceStruct,                          7u>();
+  check_size<DeviceStruct,                          10u>();
   check_size<ProtocolStruct,                        6u>();
   #ifdef USES_NOTIFIER
   check_size<NotificationStruct,                    3u>();
@@ -135,6 +135,7 @@ String formatIP(const IPAddress& ip);
 String toString(float value, byte decimals);
 String boolToString(bool value);
 bool isInt(const String& tBuf);
+bool validFloatFromString(const String& tBuf, float& result);
 unsigned long hexToUL(const String& input_c);
 unsigned long hexToUL(const String& input_c, size_t nrHexDecimals);
 unsigned long hexToUL(const String& input_c, size_t startpos, size_t nrHexDecimals);
@@ -150,6 +151,7 @@ void setLogLevelFor(byte destination, byte logLevel);
 uint16_t getPortFromKey(uint32_t key);
 
 void initRTC();
+void markUserVarDirtyRTC(taskIndex_t taskIndex);
 void deepSleepStart(int dsdelay);
 bool setControllerEnableStatus(controllerIndex_t controllerIndex, bool enabled);
 bool setTaskEnableStatus(taskIndex_t taskIndex, bool enabled);
@@ -188,6 +190,7 @@ taskIndex_t parseCommandArgumentTaskIndex(const String& string, unsigned int arg
 String describeAllowedIPrange();
 void clearAccessBlock();
 String rulesProcessingFile(const String& fileName, String& event);
+bool findCompareCondition(const String& check, char& compare, int& posStart, int& posEnd);
 int Calculate(const char *input, float* result);
 bool SourceNeedsStatusUpdate(EventValueSource::Enum eventSource);
 void SendStatus(EventValueSource::Enum source, const String& status);
@@ -4,8 +4,10 @@
 #include "src/DataStructs/NodeStruct.h"
 #include "src/DataStructs/PinMode.h"
 #include "src/DataStructs/RTCStruct.h"
+#include "src/DataStructs/TemplatePlan.h"
 
 #include "src/Globals/CRCValues.h"
+#include "src/Globals/Calculate.h"
 #include "src/Globals/Cache.h"
 #include "src/Globals/Device.h"
 #include "src/Globals/CPlugins.h"
@@ -15,6 +17,8 @@
 #include "src/Globals/ResetFactoryDefaultPref.h"
 #include "src/Globals/Services.h"
 #include "src/Globals/Settings.h"
+#include "src/Helpers/StringConverter.h"
+#include "src/Helpers/SystemVariables.h"
 
 
 #ifdef ESP32
@@ -393,7 +397,7 @@ bool readyForSleep()
 
 void prepare_deepSleep(int dsdelay)
 {
-  checkRAM(F("prepare_deepSleep"));
+  checkRAM(RamProbe::prepare_deepSleep);
 
   if (!isDeepSleepEnabled())
   {
@@ -464,7 +468,7 @@ void deepSleepStart(int dsdelay)
 
 bool remoteConfig(struct EventStruct *event, const String& string)
 {
-  checkRAM(F("remoteConfig"));
+  checkRAM(RamProbe::remoteConfig);
   bool success = false;
   String  command = parseString(string, 1);
 
@@ -685,7 +689,7 @@ bool hasPinState(byte plugin, byte index)
   \*********************************************************************************************/
 String getPinStateJSON(bool search, uint32_t key, const String& log, int16_t noSearchValue)
 {
-  checkRAM(F("getPinStateJSON"));
+  checkRAM(RamProbe::getPinStateJSON);
   printToWebJSON = true;
   byte mode = PIN_MODE_INPUT;
   int16_t value = noSearchValue;
@@ -885,7 +889,7 @@ int parseCommandArgumentInt(const String& string, unsigned int argc)
   \*********************************************************************************************/
 void parseCommandString(struct EventStruct *event, const String& string)
 {
-  checkRAM(F("parseCommandString"));
+  checkRAM(RamProbe::parseCommandString);
   event->Par1 = parseCommandArgumentInt(string, 1);
   event->Par2 = parseCommandArgumentInt(string, 2);
   event->Par3 = parseCommandArgumentInt(string, 3);
@@ -901,7 +905,7 @@ void parseCommandString(struct EventStruct *event, const String& string)
 bool setControllerEnableStatus(controllerIndex_t controllerIndex, bool enabled)
 {
   if (!validControllerIndex(controllerIndex)) return false;
-  checkRAM(F("setControllerEnableStatus"));
+  checkRAM(RamProbe::setControllerEnableStatus);
   // Only enable controller if it has a protocol configured
   if (Settings.Protocol[controllerIndex] != 0 || !enabled) {
     Settings.ControllerEnabled[controllerIndex] = enabled;
@@ -916,10 +920,11 @@ bool setControllerEnableStatus(controllerIndex_t controllerIndex, bool enabled)
 bool setTaskEnableStatus(taskIndex_t taskIndex, bool enabled)
 {
   if (!validTaskIndex(taskIndex)) return false;
-  checkRAM(F("setTaskEnableStatus"));
+  checkRAM(RamProbe::setTaskEnableStatus);
   // Only enable task if it has a Plugin configured
   if (validPluginID(Settings.TaskDeviceNumber[taskIndex]) || !enabled) {
     Settings.TaskDeviceEnabled[taskIndex] = enabled;
+    Cache.pluginCallbacks.invalidate();
     if (enabled) {
       schedule_task_device_timer(taskIndex, millis() + 10);
     }
@@ -935,8 +940,9 @@ bool setTaskEnableStatus(taskIndex_t taskIndex, bool enabled)
 void taskClear(taskIndex_t taskIndex, bool save)
 {
   if (!validTaskIndex(taskIndex)) return;
-  checkRAM(F("taskClear"));
+  checkRAM(RamProbe::taskClear);
   Settings.clearTask(taskIndex);
+  Cache.pluginCallbacks.invalidate();
   ExtraTaskSettings.clear(); // Invalidate any cached values.
   ExtraTaskSettings.TaskIndex = taskIndex;
   if (save) {
@@ -1096,7 +1102,7 @@ void dump (uint32_t addr) { //Seems already included in core 2.4 ...
 #endif
 
 uint32_t progMemMD5check(){
-    checkRAM(F("progMemMD5check"));
+    checkRAM(RamProbe::progMemMD5check);
     #define BufSize 10
     uint32_t calcBuffer[BufSize];
     CRCValues.numberOfCRCBytes = 0;
@@ -1145,7 +1151,7 @@ void ResetFactory()
 {
   const GpioFactorySettingsStruct gpio_settings(ResetFactoryDefaultPreference.getDeviceModel());
 
-  checkRAM(F("ResetFactory"));
+  checkRAM(RamProbe::ResetFactory);
   // Direct Serial is allowed here, since this is only an emergency task.
   serialPrint(F("RESET: Resetting factory defaults... using "));
   serialPrint(getDeviceModelString(ResetFactoryDefaultPreference.getDeviceModel()));
@@ -1341,7 +1347,7 @@ void ResetFactory()
 
   SaveSettings();
 
-  checkRAM(F("ResetFactory2"));
+  checkRAM(RamProbe::ResetFactory2);
   serialPrintln(F("RESET: Succesful, rebooting. (you might need to press the reset button if you've justed flashed the firmware)"));
   //NOTE: this is a known ESP8266 bug, not our fault. :)
   delay(1000);
@@ -1605,6 +1611,7 @@ void prepareShutdown()
   runPeriodicalMQTT(); // Flush outstanding MQTT messages
 #endif // USES_MQTT
   process_serialWriteBuffer();
+  process_logBuffer();
   flushAndDisconnectAllClients();
   saveUserVarToRTC();
   ESPEASY_FS.end();
@@ -1658,119 +1665,80 @@ String parseTemplate_padded(String& tmpString, byte minimal_lineSize)
 
 String parseTemplate_padded(String& tmpString, byte minimal_lineSize, bool useURLencode)
 {
-  checkRAM(F("parseTemplate_padded"));
+  return parseTemplate_padded(tmpString, minimal_lineSize, useURLencode, false);
+}
+
+// usePlanCache: Keep the template plan in the cache, for templates which are rendered repeatedly,
+// like controller and plugin format templates.
+// Rules and commands must not use it, as each action string would evict a plan which is reused.
+String parseTemplate_padded(String& tmpString, byte minimal_lineSize, bool useURLencode, bool usePlanCache)
+{
+  // Nesting level of rendering a cached template plan.
+  // A nested call (e.g. from a PLUGIN_REQUEST) must not alter the template plan cache.
+  static uint8_t templatePlanNesting = 0;
+
+  checkRAM(RamProbe::parseTemplate_padded);
   START_TIMER
 
   // Keep current loaded taskSettings to restore at the end.
   byte   currentTaskIndex = ExtraTaskSettings.TaskIndex;
   String newString;
-  newString.reserve(minimal_lineSize); // Our best guess of the new size.
 
+  bool hasConversions    = true;
+  bool hasStringCommands = true;
 
-  if (parseTemplate_CallBack_ptr != nullptr)
-     parseTemplate_CallBack_ptr(tmpString, useURLencode);
-  parseSystemVariables(tmpString, useURLencode);
-  
+  // The callback alters the template, so the template can only be cached without callback.
+  const TemplatePlan *plan = nullptr;
 
-  int startpos = 0;
-  int lastStartpos = 0;
-  int endpos = 0;
-  String deviceName, valueName, format;
+  if (usePlanCache && (parseTemplate_CallBack_ptr == nullptr) && (templatePlanNesting == 0)) {
+    plan = &getTemplatePlan(tmpString);
 
-  while (findNextDevValNameInString(tmpString, startpos, endpos, deviceName, valueName, format)) {
-    // First copy all upto the start of the [...#...] part to be replaced.
-    newString += tmpString.substring(lastStartpos, startpos);
-    
-    // deviceName is lower case, so we can compare literal string (no need for equalsIgnoreCase)
-    if (deviceName.equals(F("plugin")))
-    {
-      // Handle a plugin request.
-      // For example: "[Plugin#GPIO#Pinstate#N]"
-      // The command is stored in valueName & format
-      String command;
-      command.reserve(valueName.length() + format.length() + 1);
-      command  = valueName;
-      command += '#';
-      command += format;
-      command.replace('#', ',');
-
-      if (PluginCall(PLUGIN_REQUEST, 0, command))
-      {
-        // Do not call transformValue here.
-        // The "format" is not empty so must not call the formatter function.
-        newString += command;
-      }
+    if (plan->legacy) {
+      plan = nullptr;
     }
-    else if (deviceName.equals(F("var")) || deviceName.equals(F("int"))) 
-    {
-      // Address an internal variable either as float or as int
-      // For example: Let,10,[VAR#9]
-      int varNum;
-
-      if (validIntFromString(valueName, varNum)) {
-        if ((varNum > 0) && (varNum <= CUSTOM_VARS_MAX)) {
-          unsigned char nr_decimals = 2;
-          if (deviceName.equals(F("int"))) {
-            nr_decimals = 0;
-          } else if (format.length() != 0)
-          {
-            // There is some formatting here, so do not throw away decimals
-            nr_decimals = 6;
-          }
-          String value = String(customFloatVar[varNum - 1], nr_decimals);
-          value.trim();
-          transformValue(newString, minimal_lineSize, value, format, tmpString);
-        }
-      }
-    }
-    else 
-    {
-      // Address a value from a plugin.
-      // For example: "[bme#temp]"
-      // If value name is unknown, run a PLUGIN_GET_CONFIG command.
-      // For example: "[<taskname>#getLevel]"
-      taskIndex_t taskIndex = findTaskIndexByName(deviceName);
-
-      if (validTaskIndex(taskIndex) && Settings.TaskDeviceEnabled[taskIndex]) {
-        byte valueNr = findDeviceValueIndexByName(valueName, taskIndex);
-
-        if (valueNr != VARS_PER_TASK) {
-          // here we know the task and value, so find the uservar
-          // Try to format and transform the values
-          bool   isvalid;
-          String value = formatUserVar(taskIndex, valueNr, isvalid);
-
-          if (isvalid) {
-            transformValue(newString, minimal_lineSize, value, format, tmpString);
-          }
-        } else {
-          // try if this is a get config request
-          struct EventStruct TempEvent;
-          TempEvent.TaskIndex = taskIndex;
-          String tmpName = valueName;
+  }
 
-          if (PluginCall(PLUGIN_GET_CONFIG, &TempEvent, tmpName))
-          {
-            transformValue(newString, minimal_lineSize, tmpName, format, tmpString);
-          }                  
-        }
-      }
-    }
-    
+  if (plan != nullptr) {
+    // Our best guess of the new size.
+    newString.reserve(max(static_cast<size_t>(minimal_lineSize), plan->literalLength + 8 * plan->segments.size()));
+    hasConversions    = plan->hasConversions;
+    hasStringCommands = plan->hasStringCommands;
 
-    // Conversion is done (or impossible) for the found "[...#...]"
-    // Continue with the next one.
-    lastStartpos = endpos + 1;
-    startpos     = endpos + 1;
+    ++templatePlanNesting;
+    renderTemplatePlan(*plan, newString, minimal_lineSize, useURLencode, tmpString);
+    --templatePlanNesting;
+  } else {
+    newString.reserve(minimal_lineSize); // Our best guess of the new size.
+
+    if (parseTemplate_CallBack_ptr != nullptr)
+       parseTemplate_CallBack_ptr(tmpString, useURLencode);
+    parseSystemVariables(tmpString, useURLencode);
+
+    int startpos = 0;
+    int lastStartpos = 0;
+    int endpos = 0;
+    String deviceName, valueName, format;
+
+    while (findNextDevValNameInString(tmpString, startpos, endpos, deviceName, valueName, format)) {
+      // First copy all upto the start of the [...#...] part to be replaced.
+      newString += tmpString.substring(lastStartpos, startpos);
+
+      parseTemplate_devVal(newString, minimal_lineSize, deviceName, valueName, format, tmpString);
 
-    // This may have taken some time, so call delay()
-    delay(0);
+      // Conversion is done (or impossible) for the found "[...#...]"
+      // Continue with the next one.
+      lastStartpos = endpos + 1;
+      startpos     = endpos + 1;
+
+      // This may have taken some time, so call delay()
+      delay(0);
+    }
+
+    // Copy the rest of the string (or all if no replacements were done)
+    newString += tmpString.substring(lastStartpos);
   }
-  
-  // Copy the rest of the string (or all if no replacements were done)
-  newString += tmpString.substring(lastStartpos);
 
-  checkRAM(F("parseTemplate2"));
+  checkRAM(RamProbe::parseTemplate2);
 
   // Restore previous loaded taskSettings
   if (currentTaskIndex != 255)
@@ -1778,10 +1746,14 @@ String parseTemplate_padded(String& tmpString, byte minimal_lineSize, bool useUR
     LoadTaskSettings(currentTaskIndex);
   }
 
-  parseStandardConversions(newString, useURLencode);
+  if (hasConversions) {
+    parseStandardConversions(newString, useURLencode);
+  }
 
   // process other markups as well
-  parse_string_commands(newString); 
+  if (hasStringCommands) {
+    parse_string_commands(newString);
+  }
 
   // padding spaces
   while (newString.length() < minimal_lineSize) {
@@ -1789,10 +1761,234 @@ String parseTemplate_padded(String& tmpString, byte minimal_lineSize, bool useUR
   }
 
   STOP_TIMER(PARSE_TEMPLATE_PADDED);
-  checkRAM(F("parseTemplate3"));
+  checkRAM(RamProbe::parseTemplate3);
   return newString;
 }
 
+// Replace a single [deviceName#valueName#format] and append the result to newString.
+// deviceName and valueName must be lower case.
+void parseTemplate_devVal(String& newString, byte minimal_lineSize, const String& deviceName, const String& valueName, const String& format, const String& tmpString)
+{
+  // deviceName is lower case, so we can compare literal string (no need for equalsIgnoreCase)
+  if (deviceName.equals(F("plugin")))
+  {
+    // Handle a plugin request.
+    // For example: "[Plugin#GPIO#Pinstate#N]"
+    // The command is stored in valueName & format
+    String command;
+    command.reserve(valueName.length() + format.length() + 1);
+    command  = valueName;
+    command += '#';
+    command += format;
+    command.replace('#', ',');
+
+    if (PluginCall(PLUGIN_REQUEST, 0, command))
+    {
+      // Do not call transformValue here.
+      // The "format" is not empty so must not call the formatter function.
+      newString += command;
+    }
+  }
+  else if (deviceName.equals(F("var")) || deviceName.equals(F("int"))) 
+  {
+    // Address an internal variable either as float or as int
+    // For example: Let,10,[VAR#9]
+    int varNum;
+
+    if (validIntFromString(valueName, varNum)) {
+      if ((varNum > 0) && (varNum <= CUSTOM_VARS_MAX)) {
+        transformCustomVar(newString, minimal_lineSize, varNum - 1, deviceName.equals(F("int")), format, tmpString);
+      }
+    }
+  }
+  else 
+  {
+    // Address a value from a plugin.
+    // For example: "[bme#temp]"
+    // If value name is unknown, run a PLUGIN_GET_CONFIG command.
+    // For example: "[<taskname>#getLevel]"
+    taskIndex_t taskIndex = findTaskIndexByName(deviceName);
+
+    if (validTaskIndex(taskIndex) && Settings.TaskDeviceEnabled[taskIndex]) {
+      byte valueNr = findDeviceValueIndexByName(valueName, taskIndex);
+
+      if (valueNr != VARS_PER_TASK) {
+        // here we know the task and value, so find the uservar
+        transformTaskValue(newString, minimal_lineSize, taskIndex, valueNr, format, tmpString);
+      } else {
+        // try if this is a get config request
+        struct EventStruct TempEvent;
+        TempEvent.TaskIndex = taskIndex;
+        String tmpName = valueName;
+
+        if (PluginCall(PLUGIN_GET_CONFIG, &TempEvent, tmpName))
+        {
+          String tmpFormat = format;
+          transformValue(newString, minimal_lineSize, tmpName, tmpFormat, tmpString);
+        }                  
+      }
+    }
+  }
+}
+
+// Append the formatted and transformed task value to newString.
+void transformTaskValue(String& newString, byte minimal_lineSize, taskIndex_t taskIndex, byte valueNr, const String& format, const String& tmpString)
+{
+  // Try to format and transform the values
+  bool   isvalid;
+  String value = formatUserVar(taskIndex, valueNr, isvalid);
+
+  if (isvalid) {
+    String tmpFormat = format;
+    transformValue(newString, minimal_lineSize, value, tmpFormat, tmpString);
+  }
+}
+
+// Append the formatted and transformed custom variable (0-based index) to newString.
+void transformCustomVar(String& newString, byte minimal_lineSize, byte varIndex, bool asInt, const String& format, const String& tmpString)
+{
+  unsigned char nr_decimals = 2;
+  if (asInt) {
+    nr_decimals = 0;
+  } else if (format.length() != 0)
+  {
+    // There is some formatting here, so do not throw away decimals
+    nr_decimals = 6;
+  }
+  String value = String(customFloatVar[varIndex], nr_decimals);
+  value.trim();
+  String tmpFormat = format;
+  transformValue(newString, minimal_lineSize, value, tmpFormat, tmpString);
+}
+
+/********************************************************************************************\
+   Template plans
+   Split a template once into literal text and typed placeholders, to render it without parsing.
+ \*********************************************************************************************/
+TemplatePlan& getTemplatePlan(const String& tmpString)
+{
+  TemplatePlan *plan = Cache.templatePlans.find(tmpString);
+
+  if (plan != nullptr) {
+    return *plan;
+  }
+  START_TIMER;
+  TemplatePlan& newPlan = Cache.templatePlans.insert(tmpString);
+  compileTemplatePlan(tmpString, newPlan);
+  STOP_TIMER(COMPILE_TEMPLATE_PLAN);
+  return newPlan;
+}
+
+void compileTemplatePlan(const String& tmpString, TemplatePlan& plan)
+{
+  int startpos = 0;
+  int lastStartpos = 0;
+  int endpos = 0;
+  String deviceName, valueName, format;
+
+  while (findNextDevValNameInString(tmpString, startpos, endpos, deviceName, valueName, format)) {
+    // System variables are replaced before the [...#...] markers are parsed,
+    // so markers containing a system variable must be parsed every time.
+    for (int i = startpos; i < endpos; ++i) {
+      if (tmpString[i] == '%') {
+        plan.clear();
+        plan.legacy = true;
+        return;
+      }
+    }
+    plan.addText(tmpString.substring(lastStartpos, startpos));
+
+    int varNum;
+    if (deviceName.equals(F("var")) || deviceName.equals(F("int"))) {
+      if (validIntFromString(valueName, varNum) && (varNum > 0) && (varNum <= CUSTOM_VARS_MAX)) {
+        TemplateSegment segment(TemplateSegment::Type::Variable);
+        segment.index  = varNum - 1;
+        segment.asInt  = deviceName.equals(F("int"));
+        segment.format = format;
+        plan.addSegment(std::move(segment));
+      }
+    } else {
+      TemplateSegment segment(TemplateSegment::Type::DevVal);
+
+      if (!deviceName.equals(F("plugin"))) {
+        const taskIndex_t taskIndex = findTaskIndexByName(deviceName);
+
+        if (validTaskIndex(taskIndex) && Settings.TaskDeviceEnabled[taskIndex]) {
+          const byte valueNr = findDeviceValueIndexByName(valueName, taskIndex);
+
+          if (valueNr != VARS_PER_TASK) {
+            segment.type      = TemplateSegment::Type::TaskValue;
+            segment.taskIndex = taskIndex;
+            segment.index     = valueNr;
+          }
+        }
+      }
+
+      if (segment.type == TemplateSegment::Type::DevVal) {
+        // Plugin requests, config requests and tasks which are not (yet) present.
+        segment.text      = deviceName;
+        segment.valueName = valueName;
+      }
+      segment.format = format;
+      plan.addSegment(std::move(segment));
+    }
+
+    lastStartpos = endpos + 1;
+    startpos     = endpos + 1;
+  }
+  plan.addText(tmpString.substring(lastStartpos));
+  plan.segments.shrink_to_fit();
+}
+
+// Append a system variable value to newString.
+void appendTemplateValue(String& newString, const String& value, bool useURLencode)
+{
+  if (useURLencode) {
+    newString += URLEncode(value.c_str());
+  } else {
+    newString += value;
+  }
+}
+
+void renderTemplatePlan(const TemplatePlan& plan, String& newString, byte minimal_lineSize, bool useURLencode, const String& tmpString)
+{
+  for (auto it = plan.segments.begin(); it != plan.segments.end(); ++it) {
+    switch (it->type) {
+      case TemplateSegment::Type::Literal:
+        newString += it->text;
+        break;
+      case TemplateSegment::Type::SystemVariable:
+        appendTemplateValue(newString, SystemVariables::getSystemVariableValue(static_cast<SystemVariables::Enum>(it->index)), useURLencode);
+        break;
+      case TemplateSegment::Type::SunTime:
+        appendTemplateValue(newString,
+                            (it->index == SystemVariables::Enum::SUNRISE) ?
+                            node_time.getSunriseTimeString(':', it->offset) :
+                            node_time.getSunsetTimeString(':', it->offset),
+                            useURLencode);
+        break;
+      case TemplateSegment::Type::CustomVar:
+        appendTemplateValue(newString, String(customFloatVar[it->index]), useURLencode);
+        break;
+      case TemplateSegment::Type::TaskValue:
+
+        if (Settings.TaskDeviceEnabled[it->taskIndex]) {
+          transformTaskValue(newString, minimal_lineSize, it->taskIndex, it->index, it->format, tmpString);
+        }
+        break;
+      case TemplateSegment::Type::Variable:
+        transformCustomVar(newString, minimal_lineSize, it->index, it->asInt, it->format, tmpString);
+        break;
+      case TemplateSegment::Type::DevVal:
+        parseTemplate_devVal(newString, minimal_lineSize, it->text, it->valueName, it->format, tmpString);
+
+        // This may have taken some time, so call delay()
+        delay(0);
+        break;
+    }
+  }
+}
+
 // Find the first (enabled) task with given name
 // Return INVALID_TASK_INDEX when not found, else return taskIndex
 taskIndex_t findTaskIndexByName(const String& deviceName)
@@ -1924,7 +2120,7 @@ void transformValue(
   // FIXME TD-er: This function does append to newString and uses its length to perform right aling.
   // Is this the way it is intended to use?
   
-  checkRAM(F("transformValue"));
+  checkRAM(RamProbe::transformValue);
 
   // start changes by giig1967g - 2018-04-20
   // Syntax: [task#value#transformation#justification]
@@ -2194,318 +2390,19 @@ void transformValue(
     }
 #endif
   }
-  checkRAM(F("transformValue2"));
+  checkRAM(RamProbe::transformValue2);
 }
 
 /********************************************************************************************\
   Calculate function for simple expressions
+  See src/Helpers/Calculate.h for the supported operators.
   \*********************************************************************************************/
-#define CALCULATE_OK                            0
-#define CALCULATE_ERROR_STACK_OVERFLOW          1
-#define CALCULATE_ERROR_BAD_OPERATOR            2
-#define CALCULATE_ERROR_PARENTHESES_MISMATCHED  3
-#define CALCULATE_ERROR_UNKNOWN_TOKEN           4
-#define STACK_SIZE 10 // was 50
-#define TOKEN_MAX 20
-
-float globalstack[STACK_SIZE];
-float *sp = globalstack - 1;
-float *sp_max = &globalstack[STACK_SIZE - 1];
-
-#define is_operator(c)  (c == '+' || c == '-' || c == '*' || c == '/' || c == '^' || c == '%')
-#define is_unary_operator(c)  (c == '!')
-
-int push(float value)
-{
-  if (sp != sp_max) // Full
-  {
-    *(++sp) = value;
-    return 0;
-  }
-  else
-    return CALCULATE_ERROR_STACK_OVERFLOW;
-}
-
-float pop()
-{
-  if (sp != (globalstack - 1)) // empty
-    return *(sp--);
-  else
-    return 0.0;
-}
-
-float apply_operator(char op, float first, float second)
-{
-  switch (op)
-  {
-    case '+':
-      return first + second;
-    case '-':
-      return first - second;
-    case '*':
-      return first * second;
-    case '/':
-      return first / second;
-    case '%':
-      return static_cast<int>(round(first)) % static_cast<int>(round(second));
-    case '^':
-      return pow(first, second);
-    default:
-      return 0;
-  }
-}
-
-float apply_unary_operator(char op, float first)
-{
-  switch (op)
-  {
-    case '!':
-      return (round(first) == 0) ? 1 : 0;
-    default:
-      return 0;
-  }
-}
-
-char *next_token(char *linep)
-{
-  while (isspace(*(linep++)));
-  while (*linep && !isspace(*(linep++)));
-  return linep;
-}
-
-int RPNCalculate(char* token)
-{
-  if (token[0] == 0)
-    return 0; // geen moeite doen voor een lege string
-
-  if (is_operator(token[0]) && token[1] == 0)
-  {
-    float second = pop();
-    float first = pop();
-
-    if (push(apply_operator(token[0], first, second)))
-      return CALCULATE_ERROR_STACK_OVERFLOW;
-  } else if (is_unary_operator(token[0]) && token[1] == 0)
-  {
-    float first = pop();
-
-    if (push(apply_unary_operator(token[0], first)))
-      return CALCULATE_ERROR_STACK_OVERFLOW;
-
-  } else // Als er nog een is, dan deze ophalen
-    if (push(atof(token))) // is het een waarde, dan op de stack plaatsen
-      return CALCULATE_ERROR_STACK_OVERFLOW;
-
-  return 0;
-}
-
-// operators
-// precedence   operators         associativity
-// 3            !                 right to left
-// 2            * / %             left to right
-// 1            + - ^             left to right
-int op_preced(const char c)
-{
-  switch (c)
-  {
-    case '!':
-      return 4;
-    case '^':
-      return 3;
-    case '*':
-    case '/':
-    case '%':
-      return 2;
-    case '+':
-    case '-':
-      return 1;
-  }
-  return 0;
-}
-
-bool op_left_assoc(const char c)
-{
-  switch (c)
-  {
-    case '^':
-    case '*':
-    case '/':
-    case '+':
-    case '-':
-    case '%':
-      return true;     // left to right
-    case '!':
-      return false;    // right to left
-  }
-  return false;
-}
-
-unsigned int op_arg_count(const char c)
-{
-  switch (c)
-  {
-    case '^':
-    case '*':
-    case '/':
-    case '+':
-    case '-':
-    case '%':
-      return 2;
-    case '!':
-      return 1;
-  }
-  return 0;
-}
-
-
 int Calculate(const char *input, float* result)
 {
-  #define TOKEN_LENGTH 25
-  checkRAM(F("Calculate"));
-  const char *strpos = input, *strend = input + strlen(input);
-  char token[TOKEN_LENGTH];
-  char c, oc, *TokenPos = token;
-  char stack[32];       // operator stack
-  unsigned int sl = 0;  // stack length
-  char     sc;          // used for record stack element
-  int error = 0;
-
-  //*sp=0; // bug, it stops calculating after 50 times
-  sp = globalstack - 1;
-  oc=c=0;
-
-  if (input[0] == '=') {
-    ++strpos;
-    c = *strpos;
-  }
-
-  while (strpos < strend)
-  {
-	  if ((TokenPos - &token[0]) >= (TOKEN_LENGTH - 1)) return CALCULATE_ERROR_STACK_OVERFLOW;
-    // read one token from the input stream
-    oc = c;
-    c = *strpos;
-    if (c != ' ')
-    {
-      // If the token is a number (identifier), then add it to the token queue.
-      if ((c >= '0' && c <= '9') || c == '.' || (c == '-' && is_operator(oc)))
-      {
-        *TokenPos = c;
-        ++TokenPos;
-      }
-
-      // If the token is an operator, op1, then:
-      else if (is_operator(c) || is_unary_operator(c))
-      {
-        *(TokenPos) = 0;
-        error = RPNCalculate(token);
-        TokenPos = token;
-        if (error)return error;
-        while (sl > 0 && sl < 31)
-        {
-          sc = stack[sl - 1];
-          // While there is an operator token, op2, at the top of the stack
-          // op1 is left-associative and its precedence is less than or equal to that of op2,
-          // or op1 has precedence less than that of op2,
-          // The differing operator priority decides pop / push
-          // If 2 operators have equal priority then associativity decides.
-          if (is_operator(sc) && ((op_left_assoc(c) && (op_preced(c) <= op_preced(sc))) || (op_preced(c) < op_preced(sc))))
-          {
-            // Pop op2 off the stack, onto the token queue;
-            *TokenPos = sc;
-            ++TokenPos;
-            *(TokenPos) = 0;
-            error = RPNCalculate(token);
-            TokenPos = token;
-            if (error)return error;
-            sl--;
-          }
-          else
-            break;
-        }
-        // push op1 onto the stack.
-        stack[sl] = c;
-        ++sl;
-      }
-      // If the token is a left parenthesis, then push it onto the stack.
-      else if (c == '(')
-      {
-		if (sl >= 32) return CALCULATE_ERROR_STACK_OVERFLOW;
-        stack[sl] = c;
-        ++sl;
-      }
-      // If the token is a right parenthesis:
-      else if (c == ')')
-      {
-        bool pe = false;
-        // Until the token at the top of the stack is a left parenthesis,
-        // pop operators off the stack onto the token queue
-        while (sl > 0)
-        {
-          *(TokenPos) = 0;
-          error = RPNCalculate(token);
-          TokenPos = token;
-          if (error)return error;
-          if (sl > 32) return CALCULATE_ERROR_STACK_OVERFLOW;
-          sc = stack[sl - 1];
-          if (sc == '(')
-          {
-            pe = true;
-            break;
-          }
-          else
-          {
-            *TokenPos = sc;
-            ++TokenPos;
-            sl--;
-          }
-        }
-        // If the stack runs out without finding a left parenthesis, then there are mismatched parentheses.
-        if (!pe)
-          return CALCULATE_ERROR_PARENTHESES_MISMATCHED;
-
-        // Pop the left parenthesis from the stack, but not onto the token queue.
-        sl--;
-
-        // If the token at the top of the stack is a function token, pop it onto the token queue.
-		// FIXME TD-er: This sc value is never used, it is re-assigned a new value before it is being checked.
-        if (sl > 0 && sl < 32)
-          sc = stack[sl - 1];
-
-      }
-      else
-        return CALCULATE_ERROR_UNKNOWN_TOKEN;
-    }
-    ++strpos;
-  }
-  // When there are no more tokens to read:
-  // While there are still operator tokens in the stack:
-  while (sl > 0)
-  {
-    sc = stack[sl - 1];
-    if (sc == '(' || sc == ')')
-      return CALCULATE_ERROR_PARENTHESES_MISMATCHED;
-
-    *(TokenPos) = 0;
-    error = RPNCalculate(token);
-    TokenPos = token;
-    if (error)return error;
-    *TokenPos = sc;
-    ++TokenPos;
-    --sl;
-  }
-
-  *(TokenPos) = 0;
-  error = RPNCalculate(token);
-  TokenPos = token;
-  if (error)
-  {
-    *result = 0;
-    return error;
-  }
-  *result = *sp;
-  checkRAM(F("Calculate2"));
-  return CALCULATE_OK;
+  checkRAM(RamProbe::Calculate);
+  const int returnCode = calculateCache.calculate(input, *result);
+  checkRAM(RamProbe::Calculate2);
+  return returnCode;
 }
 
 int CalculateParam(const char *TmpStr) {
@@ -2634,7 +2531,7 @@ void tone_espEasy(uint8_t _pin, unsigned int frequency, unsigned long duration)
   \*********************************************************************************************/
 void play_rtttl(uint8_t _pin, const char *p )
 {
-  checkRAM(F("play_rtttl"));
+  checkRAM(RamProbe::play_rtttl);
   #define OCTAVE_OFFSET 0
   // FIXME: Absolutely no error checking in here
 
@@ -2783,7 +2680,7 @@ void play_rtttl(uint8_t _pin, const char *p )
       delay(duration/10);
     }
   }
- checkRAM(F("play_rtttl2"));
+ checkRAM(RamProbe::play_rtttl2);
 }
 
 //#endif
@@ -2822,7 +2719,7 @@ bool OTA_possible(uint32_t& maxSketchSize, bool& use2step) {
 
 void ArduinoOTAInit()
 {
-  checkRAM(F("ArduinoOTAInit"));
+  checkRAM(RamProbe::ArduinoOTAInit);
 
   ArduinoOTA.setPort(ARDUINO_OTA_PORT);
   ArduinoOTA.setHostname(Settings.getHostname().c_str());
@@ -110,6 +110,8 @@ void handle_schedule() {
     // No id ready to run right now.
     // Events are not that important to run immediately.
     // Make sure normal scheduled jobs run at higher priority.
+    // Task values changed by the jobs run since the last idle call are written to RTC at once.
+    saveDirtyUserVarToRTC();
     backgroundtasks();
     process_system_event_queue();
     last_system_event_run = millis();
@@ -46,47 +46,53 @@ void serial()
 
 void addToSerialBuffer(const char *line) {
   process_serialWriteBuffer(); // Try to make some room first.
-  const size_t line_length = strlen(line);
-  int roomLeft             = getMaxFreeBlock();
-
-  if (roomLeft < 1000) {
-    roomLeft = 0;                              // Do not append to buffer.
-  } else if (roomLeft < 4000) {
-    roomLeft = 128 - serialWriteBuffer.size(); // 1 buffer.
-  } else {
-    roomLeft -= 4000;                          // leave some free for normal use.
-  }
-
-  if (roomLeft > 0) {
-    size_t pos = 0;
-
-    while (pos < line_length && pos < static_cast<size_t>(roomLeft)) {
-      serialWriteBuffer.push_back(line[pos]);
-      ++pos;
-    }
-  }
+  serialWriteBuffer.add(line);
 }
 
 void addNewlineToSerialBuffer() {
   process_serialWriteBuffer(); // Try to make some room first.
-  serialWriteBuffer.push_back('\r');
-  serialWriteBuffer.push_back('\n');
+  serialWriteBuffer.add("\r\n", 2);
 }
 
 void process_serialWriteBuffer() {
-  if (serialWriteBuffer.size() == 0) { return; }
+  // Log lines are added first, to keep the order with other serial output.
+  process_serialLog();
+
+  if (serialWriteBuffer.empty()) { return; }
   size_t snip = Serial.availableForWrite();
 
-  if (snip > 0) {
-    size_t bytes_to_write = serialWriteBuffer.size();
+  // Write the data in blocks, at most what fits in the serial TX buffer.
+  while (snip > 0 && !serialWriteBuffer.empty()) {
+    const char *data;
+    size_t bytes_to_write = serialWriteBuffer.getContiguous(data);
 
     if (snip < bytes_to_write) { bytes_to_write = snip; }
+    const size_t written = Serial.write(reinterpret_cast<const uint8_t *>(data), bytes_to_write);
 
-    for (size_t i = 0; i < bytes_to_write; ++i) {
-      const char c = serialWriteBuffer.front();
-      Serial.write(c);
-      serialWriteBuffer.pop_front();
-    }
+    if (written == 0) { return; }
+    serialWriteBuffer.consume(written);
+    snip -= written;
+  }
+}
+
+// Write all buffered data, wait until it is accepted by Serial.
+// Return false when Serial did not accept the data.
+bool flush_serialWriteBuffer() {
+  while (!serialWriteBuffer.empty()) {
+    const char  *data;
+    const size_t bytes_to_write = serialWriteBuffer.getContiguous(data);
+    const size_t written        = Serial.write(reinterpret_cast<const uint8_t *>(data), bytes_to_write);
+
+    if (written == 0) { return false; }
+    serialWriteBuffer.consume(written);
+  }
+  return true;
+}
+
+// Write data without buffering, after the data already buffered.
+void serialWriteDirect(const char *data, size_t length) {
+  if (flush_serialWriteBuffer()) {
+    Serial.write(reinterpret_cast<const uint8_t *>(data), length);
   }
 }
 
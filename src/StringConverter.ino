@@ -623,7 +623,7 @@ void parseSpecialCharacters(String& s, boolean useURLencode)
    replace other system variables like %sysname%, %systime%, %ip%
  \*********************************************************************************************/
 void parseControllerVariables(String& s, struct EventStruct *event, boolean useURLencode) {
-  s = parseTemplate(s, useURLencode);
+  s = parseTemplate_padded(s, 0, useURLencode, true);
   parseEventVariables(s, event, useURLencode);
 }
 
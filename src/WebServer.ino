@@ -40,7 +40,7 @@ void sendHeadandTail(const String& tmplName, boolean Tail = false, boolean reboo
     // TODO TD-er: Should send data directly to TXBuffer instead of using large strings.
     getWebPageTemplateDefault(tmplName, pageTemplate);
   }
-  checkRAM(F("sendWebPage"));
+  checkRAM(RamProbe::sendWebPage);
 
   // web activity timer
   lastWeb = millis();
@@ -210,6 +210,7 @@ void WebServerInit()
   web_server.on(F("/settingsarchive"), handle_settingsarchive);
   #endif
   web_server.on(F("/favicon.ico"),   handle_favicon);
+  registerWebStaticFiles();
   #ifdef WEBSERVER_FILELIST
   web_server.on(F("/filelist"),      handle_filelist);
   #endif
@@ -255,6 +256,9 @@ void WebServerInit()
 #ifdef WEBSERVER_TIMINGSTATS
   web_server.on(F("/timingstats"),       handle_timingstats);
 #endif // WEBSERVER_TIMINGSTATS
+#ifdef USES_TIMING_TRACE
+  web_server.on(F("/timingtrace"),       handle_timingtrace);
+#endif // USES_TIMING_TRACE
 #ifdef WEBSERVER_TOOLS
   web_server.on(F("/tools"),             handle_tools);
 #endif
@@ -281,6 +285,10 @@ void WebServerInit()
 
   web_server.onNotFound(handleNotFound);
 
+  // Needed to reply "304 Not Modified" on requests for static files.
+  const char *headerKeys[] = { "If-None-Match" };
+  web_server.collectHeaders(headerKeys, 1);
+
   #if defined(ESP8266) || defined(ESP32) 
   {
     # ifndef NO_HTTP_UPDATER
@@ -578,18 +586,15 @@ void getWebPageTemplateVar(const String& varName)
 
   else if (varName == F("css"))
   {
-    if (ESPEASY_FS.exists(F("esp.css"))) // now css is written in writeDefaultCSS() to FS and always present
-    // if (0) //TODO
+    if (ESPEASY_FS.exists(F("esp.css"))) // custom CSS on the file system replaces the default CSS
     {
       addHtml(F("<link rel=\"stylesheet\" type=\"text/css\" href=\"esp.css\">"));
     }
     else
     {
-      addHtml(F("<style>"));
-
-      // Send CSS per chunk to avoid sending either too short or too large strings.
-      TXBuffer += DATA_ESPEASY_DEFAULT_MIN_CSS;
-      addHtml(F("</style>"));
+      addHtml(F("<link rel=\"stylesheet\" type=\"text/css\" href=\""));
+      addHtmlStaticFileURL(WEB_STATIC_ESPEASY_DEFAULT_MIN_CSS);
+      addHtml(F("\">"));
     }
   }
 
@@ -621,32 +626,6 @@ void getWebPageTemplateVar(const String& varName)
   }
 }
 
-void writeDefaultCSS(void)
-{
-  return; // TODO
-
-  if (!ESPEASY_FS.exists(F("esp.css")))
-  {
-    String defaultCSS;
-
-    fs::File f = tryOpenFile(F("esp.css"), "w");
-
-    if (f)
-    {
-      if (loglevelActiveFor(LOG_LEVEL_INFO)) {
-        String log = F("CSS  : Writing default CSS file to FS (");
-        log += defaultCSS.length();
-        log += F(" bytes)");
-        addLog(LOG_LEVEL_INFO, log);
-      }
-      defaultCSS = PGMT(DATA_ESPEASY_DEFAULT_MIN_CSS);
-      f.write((const unsigned char *)defaultCSS.c_str(), defaultCSS.length()); // note: content must be in RAM - a write of F("XXX") does
-                                                                               // not work
-      f.close();
-    }
-  }
-}
-
 // ********************************************************************************
 // Functions to stream JSON directly to TXBuffer
 // FIXME TD-er: replace stream_xxx_json_object* into this code.
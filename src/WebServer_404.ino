@@ -4,7 +4,7 @@
 // Web Interface handle other requests
 // ********************************************************************************
 void handleNotFound() {
-  checkRAM(F("handleNotFound"));
+  checkRAM(RamProbe::handleNotFound);
 
   if (wifiSetup)
   {
@@ -6,7 +6,7 @@
 // Web Interface config page
 // ********************************************************************************
 void handle_advanced() {
-  checkRAM(F("handle_advanced"));
+  checkRAM(RamProbe::handle_advanced);
 
   if (!isLoggedIn()) { return; }
   navMenuIndex = MENU_INDEX_TOOLS;
@@ -70,6 +70,10 @@ void handle_advanced() {
     Settings.Latitude  = getFormItemFloat(F("latitude"));
     Settings.Longitude = getFormItemFloat(F("longitude"));
     Settings.OldRulesEngine(isFormItemChecked(F("oldrulesengine")));
+    Settings.RulesEventsTimeBudget = getFormItemInt(F("rulesbudget"), Settings.RulesEventsTimeBudget);
+    Settings.RulesEventQueueSize   = getFormItemInt(F("rulesqueuesize"), Settings.RulesEventQueueSize);
+    Settings.RulesEventQueueDropNewest(isFormItemChecked(F("rulesdropnewest")));
+    Settings.CoalesceRulesEvents(isFormItemChecked(F("rulescoalesce")));
     Settings.TolerantLastArgParse(isFormItemChecked(F("tolerantargparse")));
     Settings.SendToHttp_ack(isFormItemChecked(F("sendtohttp_ack")));
     Settings.ForceWiFi_bg_mode(isFormItemChecked(getInternalLabel(LabelType::FORCE_WIFI_BG)));
@@ -96,6 +100,14 @@ void handle_advanced() {
 
   addFormCheckBox(F("Rules"),      F("userules"),       Settings.UseRules);
   addFormCheckBox(F("Old Engine"), F("oldrulesengine"), Settings.OldRulesEngine());
+  addFormNumericBox(F("Event Processing Time"), F("rulesbudget"), Settings.RulesEventsTimeBudget, 1, 100);
+  addUnit(F("ms"));
+  addFormNote(F("Max. time per 100 msec to process queued events"));
+  addFormNumericBox(F("Event Queue Size"), F("rulesqueuesize"), Settings.RulesEventQueueSize, 1, 255);
+  addFormCheckBox(F("Drop New Events When Full"), F("rulesdropnewest"), Settings.RulesEventQueueDropNewest());
+  addFormNote(F("When unchecked, the oldest queued event is dropped"));
+  addFormCheckBox(F("Combine Pending Events"), F("rulescoalesce"), Settings.CoalesceRulesEvents());
+  addFormNote(F("Only process the newest value of queued events with the same name"));
   addFormCheckBox(F("Tolerant last parameter"), F("tolerantargparse"), Settings.TolerantLastArgParse());
   addFormNote(F("Perform less strict parsing on last argument of some commands (e.g. publish and sendToHttp)"));
   addFormCheckBox(F("SendToHTTP wait for ack"), F("sendtohttp_ack"), Settings.SendToHttp_ack());
@@ -5,7 +5,7 @@
 // Web Interface config page
 // ********************************************************************************
 void handle_config() {
-  checkRAM(F("handle_config"));
+  checkRAM(RamProbe::handle_config);
 
   if (!isLoggedIn()) { return; }
 
@@ -7,7 +7,7 @@
 // Web Interface control page (no password!)
 // ********************************************************************************
 void handle_control() {
-  checkRAM(F("handle_control"));
+  checkRAM(RamProbe::handle_control);
 
   if (!clientIPallowed()) { return; }
 
@@ -6,7 +6,7 @@
 // Web Interface controller page
 // ********************************************************************************
 void handle_controllers() {
-  checkRAM(F("handle_controllers"));
+  checkRAM(RamProbe::handle_controllers);
 
   if (!isLoggedIn()) { return; }
   navMenuIndex = MENU_INDEX_CONTROLLERS;
@@ -279,6 +279,11 @@ void handle_controllers_ControllerSettingsPage(controllerIndex_t controllerindex
         addControllerParameterForm(ControllerSettings, controllerindex, ControllerSettingsStruct::CONTROLLER_MAX_QUEUE_DEPTH);
         addControllerParameterForm(ControllerSettings, controllerindex, ControllerSettingsStruct::CONTROLLER_MAX_RETRIES);
         addControllerParameterForm(ControllerSettings, controllerindex, ControllerSettingsStruct::CONTROLLER_FULL_QUEUE_ACTION);
+
+        if (!Protocol[ProtocolIndex].usesHTTP) {
+          addControllerParameterForm(ControllerSettings, controllerindex, ControllerSettingsStruct::CONTROLLER_MAX_BATCH_SIZE);
+          addControllerParameterForm(ControllerSettings, controllerindex, ControllerSettingsStruct::CONTROLLER_BATCH_FLUSH_DELAY);
+        }
       }
 
       if (Protocol[ProtocolIndex].usesCheckReply) {
@@ -8,7 +8,7 @@
 // ********************************************************************************
 boolean handle_custom(String path) {
   // path is a deepcopy, since it will be changed.
-  checkRAM(F("handle_custom"));
+  checkRAM(RamProbe::handle_custom);
 
   if (!clientIPallowed()) { return false; }
 
@@ -8,7 +8,7 @@
 
 
 void handle_devices() {
-  checkRAM(F("handle_devices"));
+  checkRAM(RamProbe::handle_devices);
 
   if (!isLoggedIn()) { return; }
   navMenuIndex = MENU_INDEX_DEVICES;
@@ -148,7 +148,7 @@ void handle_devices() {
     handle_devices_TaskSettingsPage(taskIndex, page);
   }
 
-  checkRAM(F("handle_devices"));
+  checkRAM(RamProbe::handle_devices);
 # ifndef BUILD_NO_DEBUG
 
   if (loglevelActiveFor(LOG_LEVEL_DEBUG_DEV)) {
@@ -299,9 +299,7 @@ void handle_devices_CopySubmittedSettings(taskIndex_t taskIndex, pluginID_t task
 // ********************************************************************************
 void handle_devicess_ShowAllTasksTable(byte page)
 {
-  html_add_script(true);
-  TXBuffer += DATA_UPDATE_SENSOR_VALUES_DEVICE_PAGE_JS;
-  html_add_script_end();
+  html_add_script_file(WEB_STATIC_UPDATE_SENSOR_VALUES_DEVICE_PAGE_MIN_JS, true);
   html_table_class_multirow();
   html_TR();
   html_table_header("", 70);
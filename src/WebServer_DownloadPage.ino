@@ -6,7 +6,7 @@
 // ********************************************************************************
 void handle_download()
 {
-  checkRAM(F("handle_download"));
+  checkRAM(RamProbe::handle_download);
 
   if (!isLoggedIn()) { return; }
   navMenuIndex = MENU_INDEX_TOOLS;
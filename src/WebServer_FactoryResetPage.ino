@@ -6,7 +6,7 @@
 // Web Interface Factory Reset
 // ********************************************************************************
 void handle_factoryreset() {
-  checkRAM(F("handle_factoryreset"));
+  checkRAM(RamProbe::handle_factoryreset);
 
   if (!isLoggedIn()) { return; }
   navMenuIndex = MENU_INDEX_TOOLS;
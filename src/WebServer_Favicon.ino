@@ -3,7 +3,7 @@
 
 void handle_favicon() {
   #ifdef WEBSERVER_FAVICON
-  checkRAM(F("handle_favicon"));
+  checkRAM(RamProbe::handle_favicon);
   web_server.send_P(200, PSTR("image/x-icon"), favicon_8b_ico, favicon_8b_ico_len);
   #else // ifdef WEBSERVER_FAVICON
   handleNotFound();
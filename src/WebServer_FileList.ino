@@ -5,7 +5,7 @@
 // Web Interface file list
 // ********************************************************************************
 void handle_filelist_json() {
-  checkRAM(F("handle_filelist"));
+  checkRAM(RamProbe::handle_filelist);
 
   if (!clientIPallowed()) { return; }
   navMenuIndex = MENU_INDEX_TOOLS;
@@ -18,9 +18,7 @@ void handle_filelist_json() {
 
     // flashCount();
     # endif // if defined(ESP32)
-    # if defined(ESP8266)
     checkRuleSets();
-    # endif // if defined(ESP8266)
   }
 
   const int pageSize = 25;
@@ -111,7 +109,7 @@ void handle_filelist_json() {
 
 #ifdef WEBSERVER_FILELIST
 void handle_filelist() {
-  checkRAM(F("handle_filelist"));
+  checkRAM(RamProbe::handle_filelist);
 
   if (!clientIPallowed()) { return; }
   navMenuIndex = MENU_INDEX_TOOLS;
@@ -295,7 +293,7 @@ void handle_filelist_buttons(int start_prev, int start_next, bool cacheFilesPres
 // ********************************************************************************
 #ifdef FEATURE_SD
 void handle_SDfilelist() {
-  checkRAM(F("handle_SDfilelist"));
+  checkRAM(RamProbe::handle_SDfilelist);
 
   if (!clientIPallowed()) { return; }
   navMenuIndex = MENU_INDEX_TOOLS;
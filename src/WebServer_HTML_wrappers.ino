@@ -237,6 +237,25 @@ void html_add_script_end() {
   addHtml(F("</script>"));
 }
 
+// Add a script served from PROGMEM by handle_static_file(), instead of inlining it.
+void html_add_script_file(const WebStaticFile& file, bool defer) {
+  addHtml(F("<script"));
+
+  if (defer) {
+    addHtml(F(" defer"));
+  }
+  addHtml(F(" type='text/JavaScript' src='"));
+  addHtmlStaticFileURL(file);
+  addHtml(F("'></script>"));
+}
+
+// URL of a static file, with the hash of its content as version to allow long caching.
+void addHtmlStaticFileURL(const WebStaticFile& file) {
+  TXBuffer += file.url;
+  addHtml(F("?v="));
+  TXBuffer += file.hash;
+}
+
 // if there is an error-string, add it to the html code with correct formatting
 void addHtmlError(const String& error) {
   if (error.length() > 0)
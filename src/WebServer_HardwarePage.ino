@@ -4,7 +4,7 @@
 // Web Interface hardware page
 // ********************************************************************************
 void handle_hardware() {
-  checkRAM(F("handle_hardware"));
+  checkRAM(RamProbe::handle_hardware);
 
   if (!isLoggedIn()) { return; }
   navMenuIndex = MENU_INDEX_HARDWARE;
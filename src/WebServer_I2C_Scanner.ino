@@ -6,7 +6,7 @@
 // Web Interface I2C scanner
 // ********************************************************************************
 void handle_i2cscanner_json() {
-  checkRAM(F("handle_i2cscanner"));
+  checkRAM(RamProbe::handle_i2cscanner);
 
   if (!isLoggedIn()) { return; }
   navMenuIndex = MENU_INDEX_TOOLS;
@@ -177,7 +177,7 @@ String getKnownI2Cdevice(byte address) {
 }
 
 void handle_i2cscanner() {
-  checkRAM(F("handle_i2cscanner"));
+  checkRAM(RamProbe::handle_i2cscanner);
 
   if (!isLoggedIn()) { return; }
   navMenuIndex = MENU_INDEX_TOOLS;
@@ -4,7 +4,7 @@
 // ********************************************************************************
 bool loadFromFS(boolean spiffs, String path) {
   // path is a deepcopy, since it will be changed here.
-  checkRAM(F("loadFromFS"));
+  checkRAM(RamProbe::loadFromFS);
 
   if (!isLoggedIn()) { return false; }
 
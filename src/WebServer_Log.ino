@@ -21,9 +21,7 @@ void handle_log() {
   addCheckBox(F("autoscroll"), true);
   addHtml(F("<BR></body>"));
 
-  html_add_script(true);
-  TXBuffer += DATA_FETCH_AND_PARSE_LOG_JS;
-  html_add_script_end();
+  html_add_script_file(WEB_STATIC_FETCH_AND_PARSE_LOG_MIN_JS, true);
 
   #else // ifdef WEBSERVER_LOG
   addHtml(F("Not included in build"));
@@ -61,15 +59,19 @@ void handle_log_JSON() {
   int  nrEntries               = 0;
   unsigned long firstTimeStamp = 0;
   unsigned long lastTimeStamp  = 0;
+  size_t logSize               = 0; // Size of the entries in the log buffer, except the first
 
   while (logLinesAvailable) {
-    String reply = Logging.get_logjson_formatted(logLinesAvailable, lastTimeStamp);
+    size_t recordSize = 0;
+    String reply      = Logging.get_logjson_formatted(logLinesAvailable, lastTimeStamp, recordSize);
 
     if (reply.length() > 0) {
       addHtml(reply);
 
       if (nrEntries == 0) {
         firstTimeStamp = lastTimeStamp;
+      } else {
+        logSize += recordSize;
       }
       ++nrEntries;
     }
@@ -83,9 +85,9 @@ void handle_log_JSON() {
 
   if ((nrEntries > 2) && (logTimeSpan > 1)) {
     // May need to lower the TTL for refresh when time needed
-    // to fill half the log is lower than current TTL
-    newOptimum = logTimeSpan * (LOG_STRUCT_MESSAGE_LINES / 2);
-    newOptimum = newOptimum / (nrEntries - 1);
+    // to fill half the log buffer is lower than current TTL
+    newOptimum = logTimeSpan * (LOG_STRUCT_ARENA_SIZE / 2);
+    newOptimum = newOptimum / logSize;
   }
 
   if (newOptimum < refreshSuggestion) { refreshSuggestion = newOptimum; }
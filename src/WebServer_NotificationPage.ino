@@ -10,7 +10,7 @@
 
 
 void handle_notifications() {
-  checkRAM(F("handle_notifications"));
+  checkRAM(RamProbe::handle_notifications);
 
   if (!isLoggedIn()) { return; }
   navMenuIndex = MENU_INDEX_NOTIFICATIONS;
@@ -5,7 +5,7 @@
 // Web Interface pin state list
 // ********************************************************************************
 void handle_pinstates_json() {
-  checkRAM(F("handle_pinstates"));
+  checkRAM(RamProbe::handle_pinstates);
 
   if (!isLoggedIn()) { return; }
   navMenuIndex = MENU_INDEX_TOOLS;
@@ -75,7 +75,7 @@ void handle_pinstates_json() {
 #ifdef WEBSERVER_PINSTATES
 
 void handle_pinstates() {
-  checkRAM(F("handle_pinstates"));
+  checkRAM(RamProbe::handle_pinstates);
 
   if (!isLoggedIn()) { return; }
   navMenuIndex = MENU_INDEX_TOOLS;
@@ -7,7 +7,7 @@
 // Web Interface root page
 // ********************************************************************************
 void handle_root() {
-  checkRAM(F("handle_root"));
+  checkRAM(RamProbe::handle_root);
 
   // if Wifi setup, launch setup wizard
   if (wifiSetup)
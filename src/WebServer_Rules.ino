@@ -6,7 +6,7 @@
 // Web Interface rules page
 // ********************************************************************************
 void handle_rules() {
-  checkRAM(F("handle_rules"));
+  checkRAM(RamProbe::handle_rules);
 
   if (!isLoggedIn() || !Settings.UseRules) { return; }
   navMenuIndex = MENU_INDEX_RULES;
@@ -133,7 +133,7 @@ void handle_rules_new() {
     handle_rules();
     return;
   }
-  checkRAM(F("handle_rules"));
+  checkRAM(RamProbe::handle_rules);
   navMenuIndex = 5;
   TXBuffer.startStream();
   sendHeadandTail(F("TmplStd"), _HEAD);
@@ -269,7 +269,7 @@ void handle_rules_new() {
   // TXBuffer += F("<BR><BR>");
   sendHeadandTail(F("TmplStd"), _TAIL);
   TXBuffer.endStream();
-  checkRAM(F("handle_rules"));
+  checkRAM(RamProbe::handle_rules);
 }
 
 void handle_rules_backup() {
@@ -285,7 +285,7 @@ void handle_rules_backup() {
   if (!isLoggedIn() || !Settings.UseRules) { return; }
 
   if (!clientIPallowed()) { return; }
-  checkRAM(F("handle_rules_backup"));
+  checkRAM(RamProbe::handle_rules_backup);
   String directory = web_server.arg(F("directory"));
   String fileName  = web_server.arg(F("fileName"));
   String error;
@@ -326,7 +326,7 @@ void handle_rules_backup() {
     TXBuffer.endStream();
   }
 
-  checkRAM(F("handle_rules_backup"));
+  checkRAM(RamProbe::handle_rules_backup);
 }
 
 void handle_rules_delete() {
@@ -339,7 +339,7 @@ void handle_rules_delete() {
     Goto_Rules_Root();
     return;
   }
-  checkRAM(F("handle_rules_delete"));
+  checkRAM(RamProbe::handle_rules_delete);
   String fileName = web_server.arg(F("fileName"));
   fileName = fileName.substring(0, fileName.length() - 4);
   bool removed = false;
@@ -369,7 +369,7 @@ void handle_rules_delete() {
     sendHeadandTail(F("TmplMsg"), _TAIL);
     TXBuffer.endStream();
   }
-  checkRAM(F("handle_rules_delete"));
+  checkRAM(RamProbe::handle_rules_delete);
 }
 
 bool handle_rules_edit(const String& originalUri)
@@ -381,7 +381,7 @@ bool handle_rules_edit(String originalUri, bool isAddNew) {
   // originalUri is passed via deepcopy, since it will be converted to lower case.
   if (!isLoggedIn() || !Settings.UseRules) { return false; }
   originalUri.toLowerCase();
-  checkRAM(F("handle_rules"));
+  checkRAM(RamProbe::handle_rules);
   bool handle = false;
 
   #ifdef WEBSERVER_RULES_DEBUG
@@ -527,7 +527,7 @@ bool handle_rules_edit(String originalUri, bool isAddNew) {
     TXBuffer.endStream();
   }
 
-  checkRAM(F("handle_rules"));
+  checkRAM(RamProbe::handle_rules);
   return handle;
 }
 
@@ -6,7 +6,7 @@
 // Web Interface to manage archived settings
 // ********************************************************************************
 void handle_settingsarchive() {
-  checkRAM(F("handle_settingsarchive"));
+  checkRAM(RamProbe::handle_settingsarchive);
 
   if (!isLoggedIn()) { return; }
   navMenuIndex = MENU_INDEX_TOOLS;
@@ -9,7 +9,7 @@
 #define HANDLE_SETUP_CONNECTING_STAGE 1
 
 void handle_setup() {
-  checkRAM(F("handle_setup"));
+  checkRAM(RamProbe::handle_setup);
 
   // Do not check client IP range allowed.
   TXBuffer.startStream();
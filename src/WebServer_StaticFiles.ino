@@ -0,0 +1,40 @@
+#include "src/Static/WebStaticData.h"
+
+// ********************************************************************************
+// Web Interface static files (CSS, JavaScript), stored gzip compressed in PROGMEM
+// ********************************************************************************
+void registerWebStaticFiles() {
+  for (const WebStaticFile *file : webStaticFiles) {
+    web_server.on(FPSTR(file->url), HTTP_GET, [file]() {
+      handle_static_file(*file);
+    });
+  }
+}
+
+void handle_static_file(const WebStaticFile& file) {
+  checkRAM(RamProbe::handle_static_file);
+
+  const String hash(FPSTR(file.hash));
+  String etag;
+
+  etag.reserve(hash.length() + 2);
+  etag += '"';
+  etag += hash;
+  etag += '"';
+  web_server.sendHeader(F("ETag"), etag);
+
+  if (web_server.arg(F("v")).equals(hash)) {
+    // Pages refer to the file with the hash of its content as version,
+    // so a new build uses a new URL when the file has changed.
+    web_server.sendHeader(F("Cache-Control"), F("max-age=31536000, public, immutable"));
+  } else {
+    web_server.sendHeader(F("Cache-Control"), F("no-cache"));
+  }
+
+  if (web_server.header(F("If-None-Match")).indexOf(etag) >= 0) {
+    web_server.send(304);
+    return;
+  }
+  web_server.sendHeader(F("Content-Encoding"), F("gzip"));
+  web_server.send_P(200, file.contentType, reinterpret_cast<const char *>(file.data), file.length);
+}
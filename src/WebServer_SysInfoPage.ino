@@ -13,7 +13,7 @@
 // Web Interface sysinfo page
 // ********************************************************************************
 void handle_sysinfo_json() {
-  checkRAM(F("handle_sysinfo"));
+  checkRAM(RamProbe::handle_sysinfo);
 
   if (!isLoggedIn()) { return; }
   TXBuffer.startJsonStream();
@@ -31,10 +31,10 @@ void handle_sysinfo_json() {
   json_open(false, F("mem"));
   json_number(F("free"),    String(freeMem));
   json_number(F("low_ram"), String(lowestRAM));
-  json_prop(F("low_ram_fn"), String(lowestRAMfunction));
+  json_prop(F("low_ram_fn"), lowestRAMfunction.toString());
   json_number(F("stack"),     String(getCurrentFreeStack()));
   json_number(F("low_stack"), String(lowestFreeStack));
-  json_prop(F("low_stack_fn"), lowestFreeStackfunction);
+  json_prop(F("low_stack_fn"), lowestFreeStackfunction.toString());
   json_close();
   json_open(false, F("boot"));
   json_prop(F("last_cause"), getLastBootCauseString());
@@ -188,7 +188,7 @@ void handle_sysinfo_json() {
 #ifdef WEBSERVER_SYSINFO
 
 void handle_sysinfo() {
-  checkRAM(F("handle_sysinfo"));
+  checkRAM(RamProbe::handle_sysinfo);
 
   if (!isLoggedIn()) { return; }
   navMenuIndex = MENU_INDEX_TOOLS;
@@ -212,9 +212,7 @@ void handle_sysinfo() {
   addCopyButton(F("copyText"), F("\\n"), F("Copy info to clipboard"));
 
   TXBuffer += githublogo;
-  html_add_script(false);
-  TXBuffer += DATA_GITHUB_CLIPBOARD_JS;
-  html_add_script_end();
+  html_add_script_file(WEB_STATIC_GITHUB_CLIPBOARD_MIN_JS, false);
   # else // ifdef WEBSERVER_GITHUB_COPY
   addFormHeader(F("System Info"));
 
@@ -278,7 +276,7 @@ void handle_sysinfo_basicInfo() {
     html += " (";
     html += lowestRAM;
     html += F(" - ");
-    html += lowestRAMfunction;
+    html += lowestRAMfunction.toString();
     html += ')';
     addHtml(html);
   }
@@ -290,10 +288,21 @@ void handle_sysinfo_basicInfo() {
     html += " (";
     html += lowestFreeStack;
     html += F(" - ");
-    html += lowestFreeStackfunction;
+    html += lowestFreeStackfunction.toString();
     html += ')';
     addHtml(html);
   }
+  addRowLabel(F("Last Web Page"));
+  {
+    // Stats of the previous page, this page is still being streamed.
+    String html;
+    html.reserve(48);
+    html += TXBuffer.lastStreamBytes;
+    html += F(" bytes (");
+    html += String(TXBuffer.getBytesPerMsec(), 1);
+    html += F(" bytes/ms)");
+    addHtml(html);
+  }
 # ifdef CORE_POST_2_5_0
   addRowLabelValue(LabelType::HEAP_MAX_FREE_BLOCK);
   addRowLabelValue(LabelType::HEAP_FRAGMENTATION);
@@ -436,6 +445,17 @@ void handle_sysinfo_SystemStatus() {
     # ifdef FEATURE_SD
   addRowLabelValue(LabelType::SD_LOG_LEVEL);
     # endif // ifdef FEATURE_SD
+
+  addRowLabel(F("Serial Dropped"));
+  {
+    String html;
+    html.reserve(48);
+    html += serialWriteBuffer.droppedBytes;
+    html += F(" bytes, ");
+    html += Logging.getDropped(LOG_TO_SERIAL);
+    html += F(" log lines");
+    addHtml(html);
+  }
 }
 
 void handle_sysinfo_ESP_Board() {
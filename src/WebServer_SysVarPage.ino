@@ -13,7 +13,7 @@ void addSysVar_enum_html(SystemVariables::Enum enumval) {
 
 
 void handle_sysvars() {
-  checkRAM(F("handle_sysvars"));
+  checkRAM(RamProbe::handle_sysvars);
 
   if (!isLoggedIn()) { return; }
   TXBuffer.startStream();
@@ -2,11 +2,15 @@
 
 
 #if defined(WEBSERVER_TIMINGSTATS) && defined(USES_TIMING_STATS)
+#include "src/DataStructs/Caches.h"
+#include "src/Globals/Cache.h"
+#include "src/Globals/ControllerHTTPClients.h"
+#include "src/DataStructs/TimingTrace.h"
 #include "src/Globals/Device.h"
 
 
 void handle_timingstats() {
-  checkRAM(F("handle_timingstats"));
+  checkRAM(RamProbe::handle_timingstats);
   navMenuIndex = MENU_INDEX_TOOLS;
   TXBuffer.startStream();
   sendHeadandTail_stdtemplate(_HEAD);
@@ -18,11 +22,24 @@ void handle_timingstats() {
   html_table_header(F("call/sec"));
   html_table_header(F("min (ms)"));
   html_table_header(F("Avg (ms)"));
+  html_table_header(F("P50 (ms)"));
+  html_table_header(F("P90 (ms)"));
+  html_table_header(F("P99 (ms)"));
   html_table_header(F("max (ms)"));
 
   long timeSinceLastReset = stream_timing_statistics(true);
   html_end_table();
 
+  html_table_class_multirow();
+  html_TR();
+  html_table_header(F("Slowest calls"));
+  html_table_header(F("Function"));
+  html_table_header(F("Time"));
+  html_table_header(F("Duration (ms)"));
+  stream_html_timing_stats_worst();
+  timingStatsWorst.reset();
+  html_end_table();
+
   html_table_class_normal();
   const float timespan = timeSinceLastReset / 1000.0;
   addFormHeader(F("Statistics"));
@@ -33,6 +50,18 @@ void handle_timingstats() {
   addRowLabel(F("Time span"));
   addHtml(String(timespan));
   addHtml(F(" sec"));
+  # ifdef USES_TIMING_TRACE
+  addRowLabel(F("Trace"));
+
+  if (timingTrace.isRecording()) {
+    addButton(F("timingtrace?stop=1"), F("Stop"));
+  } else {
+    addButton(F("timingtrace?start=1"), F("Start"));
+  }
+  addButton(F("timingtrace"), F("Download"));
+  addHtml(String(timingTrace.size()));
+  addHtml(F(" events"));
+  # endif // ifdef USES_TIMING_TRACE
   html_end_table();
 
   sendHeadandTail_stdtemplate(_TAIL);
@@ -66,9 +95,38 @@ void stream_html_timing_stats(const TimingStats& stats, long timeSinceLastReset)
   html_TD();
   format_using_threshhold(stats.getAvg());
   html_TD();
+  format_using_threshhold(stats.getPercentile(50));
+  html_TD();
+  format_using_threshhold(stats.getPercentile(90));
+  html_TD();
+  format_using_threshhold(stats.getPercentile(99));
+  html_TD();
   format_using_threshhold(maxVal);
 }
 
+void stream_html_timing_stats_worst() {
+  for (byte i = 0; i < timingStatsWorst.size(); ++i) {
+    const TimingStatsWorstEntry& entry = timingStatsWorst[i];
+
+    if (entry.duration > TIMING_STATS_THRESHOLD) {
+      html_TR_TD_highlight();
+    } else {
+      html_TR_TD();
+    }
+    String description;
+    String function;
+    getTimingStatsDescription(entry.kind, entry.key, description, function);
+    addHtml(description);
+    html_TD();
+    addHtml(function);
+    html_TD();
+    struct tm callTime = node_time.addSeconds(node_time.tm, -1 * static_cast<int>(timePassedSince(entry.timestamp) / 1000), false);
+    addHtml(ESPEasy_time::getTimeString(callTime, ':', false, true));
+    html_TD();
+    format_using_threshhold(entry.duration);
+  }
+}
+
 long stream_timing_statistics(bool clearStats) {
   long timeSinceLastReset = timePassedSince(timingstats_last_reset);
 
@@ -136,6 +194,52 @@ long stream_timing_statistics(bool clearStats) {
       }
       addHtml(getMiscStatsName(x.first));
       html_TD();
+
+      if (x.second.hasBytes()) {
+        // Show throughput, e.g. of file writes
+        addHtml(String(x.second.getBytesPerSec() / 1024.0, 1));
+        addHtml(F(" kB/s"));
+      }
+
+      if (x.first == LOAD_TASK_SETTINGS) {
+        // Loads served from the task settings cache are not timed.
+        String html;
+        html.reserve(32);
+        html += F("cache hit: ");
+        html += Cache.extraTaskSettings.hits;
+        html += F(" miss: ");
+        html += Cache.extraTaskSettings.misses;
+        addHtml(html);
+      }
+
+      if (x.first == RULES_EVENT_QUEUE_WAIT) {
+        String html;
+        html.reserve(64);
+        html += F("depth: ");
+        html += eventQueue.size();
+        html += F(" max: ");
+        html += eventQueue.maxDepth;
+        html += F(" dropped: ");
+        html += eventQueue.dropped;
+        html += F(" combined: ");
+        html += eventQueue.coalesced;
+        addHtml(html);
+      }
+
+      if ((x.first >= C001_DELAY_QUEUE) && (x.first <= C020_DELAY_QUEUE)) {
+        // Requests sent via a new or an already open (keep-alive) connection.
+        auto it = controllerHTTPClients.find(x.first - C001_DELAY_QUEUE + 1);
+
+        if (it != controllerHTTPClients.end()) {
+          String html;
+          html.reserve(32);
+          html += F("connect: ");
+          html += it->second.connects;
+          html += F(" reuse: ");
+          html += it->second.reuses;
+          addHtml(html);
+        }
+      }
       stream_html_timing_stats(x.second, timeSinceLastReset);
 
       if (clearStats) { x.second.reset(); }
@@ -143,9 +247,97 @@ long stream_timing_statistics(bool clearStats) {
   }
 
   if (clearStats) {
-    timingstats_last_reset = millis();
+    timingstats_last_reset         = millis();
+    Cache.extraTaskSettings.hits   = 0;
+    Cache.extraTaskSettings.misses = 0;
+    eventQueue.resetStats();
+
+    for (auto& x: controllerHTTPClients) {
+      x.second.connects = 0;
+      x.second.reuses   = 0;
+    }
   }
   return timeSinceLastReset;
 }
 
+# ifdef USES_TIMING_TRACE
+
+// ********************************************************************************
+// Trace of the timed calls in Chrome trace event format, to be opened in a trace viewer
+// (e.g. chrome://tracing or ui.perfetto.dev)
+// /timingtrace?start=1 : Clear the trace and start recording
+// /timingtrace?stop=1  : Stop recording
+// /timingtrace         : Download the recorded events
+// ********************************************************************************
+void handle_timingtrace() {
+  if (!isLoggedIn()) { return; }
+
+  if (web_server.hasArg(F("start")) || web_server.hasArg(F("stop"))) {
+    timingTrace.clear();
+    timingTrace.setRecording(web_server.hasArg(F("start")));
+    web_server.sendHeader(F("Location"), F("/timingstats"), true);
+    web_server.send(302, F("text/plain"), F(""));
+    return;
+  }
+
+  // Do not record the calls made while streaming the trace.
+  const bool recording = timingTrace.isRecording();
+  timingTrace.setRecording(false);
+
+  // Events are ordered by the end of the call, so look for the earliest start.
+  uint32_t firstStart = 0;
+
+  for (uint16_t i = 0; i < timingTrace.size(); ++i) {
+    const uint32_t start = timingTrace[i].start;
+
+    if ((i == 0) || (static_cast<int32_t>(start - firstStart) < 0)) {
+      firstStart = start;
+    }
+  }
+
+  web_server.sendHeader(F("Content-Disposition"), F("attachment; filename=timingtrace.json"));
+  TXBuffer.startJsonStream();
+  addHtml(F("{\"traceEvents\":["));
+
+  String description;
+  String function;
+  String html;
+  html.reserve(128);
+
+  for (uint16_t i = 0; i < timingTrace.size(); ++i) {
+    const TimingTraceEvent& event = timingTrace[i];
+    getTimingStatsDescription(event.kind, event.key, description, function);
+
+    html = (i == 0) ? F("\n{\"name\":\"") : F(",\n{\"name\":\"");
+    html += description;
+
+    if (function.length() > 0) {
+      html += ' ';
+      html += function;
+    }
+    html += F("\",\"cat\":\"");
+
+    switch (event.kind) {
+      case TIMING_STATS_PLUGIN:     html += F("plugin"); break;
+      case TIMING_STATS_CONTROLLER: html += F("controller"); break;
+      default:                      html += F("misc"); break;
+    }
+    html += F("\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":");
+    html += event.start - firstStart;
+    html += F(",\"dur\":");
+    html += event.duration;
+    html += '}';
+    addHtml(html);
+  }
+  html  = F("\n],\"displayTimeUnit\":\"ms\",\"otherData\":{\"overwritten\":");
+  html += timingTrace.overwritten;
+  html += F("}}\n");
+  addHtml(html);
+  TXBuffer.endStream();
+
+  timingTrace.setRecording(recording);
+}
+
+# endif // ifdef USES_TIMING_TRACE
+
 #endif // WEBSERVER_TIMINGSTATS
@@ -23,7 +23,7 @@ void handle_upload() {
 // Web Interface upload page
 // ********************************************************************************
 void handle_upload_post() {
-  checkRAM(F("handle_upload_post"));
+  checkRAM(RamProbe::handle_upload_post);
 
   if (!isLoggedIn()) { return; }
 
@@ -56,7 +56,7 @@ void handle_upload_post() {
 
 #ifdef WEBSERVER_NEW_UI
 void handle_upload_json() {
-  checkRAM(F("handle_upload_post"));
+  checkRAM(RamProbe::handle_upload_post);
   uint8_t result = uploadResult;
 
   if (!isLoggedIn()) { result = 255; }
@@ -76,7 +76,7 @@ void handle_upload_json() {
 // ********************************************************************************
 fs::File uploadFile;
 void handleFileUpload() {
-  checkRAM(F("handleFileUpload"));
+  checkRAM(RamProbe::handleFileUpload);
 
   if (!isLoggedIn()) { return; }
 
@@ -156,6 +156,9 @@ void handleFileUpload() {
   {
     if (uploadFile) { uploadFile.close(); }
 
+    // Uploaded file may be a rules file
+    checkRuleSets();
+
     if (loglevelActiveFor(LOG_LEVEL_INFO)) {
       String log = F("Upload: END, Size: ");
       log += upload.totalSize;
@@ -6,7 +6,7 @@
 // Web Interface Wifi scanner
 // ********************************************************************************
 void handle_wifiscanner_json() {
-  checkRAM(F("handle_wifiscanner"));
+  checkRAM(RamProbe::handle_wifiscanner);
 
   if (!isLoggedIn()) { return; }
   navMenuIndex = MENU_INDEX_TOOLS;
@@ -60,7 +60,7 @@ void handle_wifiscanner_json() {
 #ifdef WEBSERVER_WIFI_SCANNER
 
 void handle_wifiscanner() {
-  checkRAM(F("handle_wifiscanner"));
+  checkRAM(RamProbe::handle_wifiscanner);
 
   if (!isLoggedIn()) { return; }
 
@@ -4,7 +4,7 @@
 // Web Interface login page
 // ********************************************************************************
 void handle_login() {
-  checkRAM(F("handle_login"));
+  checkRAM(RamProbe::handle_login);
 
   if (!clientIPallowed()) { return; }
   TXBuffer.startStream();
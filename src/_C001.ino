@@ -17,6 +17,7 @@ bool CPlugin_001(CPlugin::Function function, struct EventStruct *event, String&
     case CPlugin::Function::CPLUGIN_PROTOCOL_ADD:
       {
         Protocol[++protocolCount].Number = CPLUGIN_ID_001;
+        Protocol[protocolCount].usesHTTP = true;
         Protocol[protocolCount].usesMQTT = false;
         Protocol[protocolCount].usesAccount = true;
         Protocol[protocolCount].usesPassword = true;
@@ -127,17 +128,13 @@ bool do_process_c001_delay_queue(int controller_number, const C001_queue_element
 // *INDENT-ON*
 
 bool do_process_c001_delay_queue(int controller_number, const C001_queue_element& element, ControllerSettingsStruct& ControllerSettings) {
-  WiFiClient client;
-  if (!try_connect_host(controller_number, client, ControllerSettings))
-    return false;
-
   // This will send the request to the server
   String request = create_http_request_auth(controller_number, element.controller_idx, ControllerSettings, F("GET"), element.txt);
 
 #ifndef BUILD_NO_DEBUG
   addLog(LOG_LEVEL_DEBUG, element.txt);
 #endif
-  return send_via_http(controller_number, client, request, ControllerSettings.MustCheckReply);
+  return send_via_http(controller_number, ControllerSettings, request, ControllerSettings.MustCheckReply);
 }
 
 #endif
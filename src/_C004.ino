@@ -16,6 +16,7 @@ bool CPlugin_004(CPlugin::Function function, struct EventStruct *event, String&
     case CPlugin::Function::CPLUGIN_PROTOCOL_ADD:
       {
         Protocol[++protocolCount].Number = CPLUGIN_ID_004;
+        Protocol[protocolCount].usesHTTP = true;
         Protocol[protocolCount].usesMQTT = false;
         Protocol[protocolCount].usesAccount = true;
         Protocol[protocolCount].usesPassword = true;
@@ -83,10 +84,6 @@ bool do_process_c004_delay_queue(int controller_number, const C004_queue_element
 // *INDENT-ON*
 
 bool do_process_c004_delay_queue(int controller_number, const C004_queue_element& element, ControllerSettingsStruct& ControllerSettings) {
-  WiFiClient client;
-  if (!try_connect_host(controller_number, client, ControllerSettings))
-    return false;
-
   String postDataStr = F("api_key=");
   postDataStr += getControllerPass(element.controller_idx, ControllerSettings); // used for API key
 
@@ -113,9 +110,10 @@ bool do_process_c004_delay_queue(int controller_number, const C004_queue_element
     F("/update"), // uri
     "",           // auth_header
     F("Content-Type: application/x-www-form-urlencoded\r\n"),
-    postDataStr.length());
+    postDataStr.length(),
+    true);        // keep_alive
   postStr += postDataStr;
 
-  return send_via_http(controller_number, client, postStr, ControllerSettings.MustCheckReply);
+  return send_via_http(controller_number, ControllerSettings, postStr, ControllerSettings.MustCheckReply);
 }
 #endif
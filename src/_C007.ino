@@ -16,6 +16,7 @@ bool CPlugin_007(CPlugin::Function function, struct EventStruct *event, String&
     case CPlugin::Function::CPLUGIN_PROTOCOL_ADD:
       {
         Protocol[++protocolCount].Number = CPLUGIN_ID_007;
+        Protocol[protocolCount].usesHTTP = true;
         Protocol[protocolCount].usesMQTT = false;
         Protocol[protocolCount].usesAccount = false;
         Protocol[protocolCount].usesPassword = true;
@@ -75,10 +76,6 @@ bool do_process_c007_delay_queue(int controller_number, const C007_queue_element
 // *INDENT-ON*
 
 bool do_process_c007_delay_queue(int controller_number, const C007_queue_element& element, ControllerSettingsStruct& ControllerSettings) {
-  WiFiClient client;
-  if (!try_connect_host(controller_number, client, ControllerSettings))
-    return false;
-
   String url = F("/emoncms/input/post.json?node=");
   url += Settings.Unit;
   url += F("&json=");
@@ -97,7 +94,7 @@ bool do_process_c007_delay_queue(int controller_number, const C007_queue_element
   if (Settings.SerialLogLevel >= LOG_LEVEL_DEBUG_MORE)
     serialPrintln(url);
 
-  return send_via_http(controller_number, client,
+  return send_via_http(controller_number, ControllerSettings,
     create_http_get_request(controller_number, ControllerSettings, url),
     ControllerSettings.MustCheckReply);
 }
@@ -17,6 +17,7 @@ bool CPlugin_008(CPlugin::Function function, struct EventStruct *event, String&
     case CPlugin::Function::CPLUGIN_PROTOCOL_ADD:
       {
         Protocol[++protocolCount].Number = CPLUGIN_ID_008;
+        Protocol[protocolCount].usesHTTP = true;
         Protocol[protocolCount].usesMQTT = false;
         Protocol[protocolCount].usesTemplate = true;
         Protocol[protocolCount].usesAccount = true;
@@ -112,12 +113,8 @@ bool do_process_c008_delay_queue(int controller_number, const C008_queue_element
       return true;
   }
 
-  WiFiClient client;
-  if (!try_connect_host(controller_number, client, ControllerSettings))
-    return false;
-
   String request = create_http_request_auth(controller_number, element.controller_idx, ControllerSettings, F("GET"), element.txt[element.valuesSent]);
-  return element.checkDone(send_via_http(controller_number, client, request, ControllerSettings.MustCheckReply));
+  return element.checkDone(send_via_http(controller_number, ControllerSettings, request, ControllerSettings.MustCheckReply));
 }
 
 #endif
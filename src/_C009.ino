@@ -40,6 +40,7 @@ bool CPlugin_009(CPlugin::Function function, struct EventStruct *event, String&
     case CPlugin::Function::CPLUGIN_PROTOCOL_ADD:
       {
         Protocol[++protocolCount].Number = CPLUGIN_ID_009;
+        Protocol[protocolCount].usesHTTP = true;
         Protocol[protocolCount].usesMQTT = false;
         Protocol[protocolCount].usesTemplate = false;
         Protocol[protocolCount].usesAccount = true;
@@ -97,10 +98,6 @@ bool do_process_c009_delay_queue(int controller_number, const C009_queue_element
 // *INDENT-ON*
 
 bool do_process_c009_delay_queue(int controller_number, const C009_queue_element& element, ControllerSettingsStruct& ControllerSettings) {
-  WiFiClient client;
-  if (!try_connect_host(controller_number, client, ControllerSettings))
-    return false;
-
   LoadTaskSettings(element.TaskIndex);
   String jsonString;
   {
@@ -152,6 +149,6 @@ bool do_process_c009_delay_queue(int controller_number, const C009_queue_element
       F("POST"), F("/ESPEasy"), jsonString.length());
   request += jsonString;
 
-  return send_via_http(controller_number, client, request, ControllerSettings.MustCheckReply);
+  return send_via_http(controller_number, ControllerSettings, request, ControllerSettings.MustCheckReply);
 }
 #endif
@@ -38,6 +38,7 @@ bool CPlugin_011(CPlugin::Function function, struct EventStruct *event, String&
     case CPlugin::Function::CPLUGIN_PROTOCOL_ADD:
       {
         Protocol[++protocolCount].Number = CPLUGIN_ID_011;
+        Protocol[protocolCount].usesHTTP = true;
         Protocol[protocolCount].usesMQTT = false;
         Protocol[protocolCount].usesAccount = true;
         Protocol[protocolCount].usesPassword = true;
@@ -142,11 +143,7 @@ bool do_process_c011_delay_queue(int controller_number, const C011_queue_element
 // *INDENT-ON*
 
 bool do_process_c011_delay_queue(int controller_number, const C011_queue_element& element, ControllerSettingsStruct& ControllerSettings) {
-  WiFiClient client;
-  if (!try_connect_host(controller_number, client, ControllerSettings))
-    return false;
-
-  return send_via_http(controller_number, client, element.txt, ControllerSettings.MustCheckReply);
+  return send_via_http(controller_number, ControllerSettings, element.txt, ControllerSettings.MustCheckReply);
 }
 
 //********************************************************************************
@@ -165,8 +162,7 @@ boolean Create_schedule_HTTP_C011(struct EventStruct *event)
   LoadCustomControllerSettings(event->ControllerIndex,(byte*)&customConfig, sizeof(customConfig));
   customConfig.zero_last();
 
-  WiFiClient client;
-  if (!try_connect_host(controller_number, client, ControllerSettings))
+  if (!connect_controller_http_client(controller_number, ControllerSettings))
     return false;
 
   if (ExtraTaskSettings.TaskIndex != event->TaskIndex) {
@@ -11,6 +11,7 @@
 #include "src/DataStructs/ESPEasyLimits.h"
 #include "src/DataStructs/TimingStats.h"
 
+#include "src/Globals/ControllerHTTPClients.h"
 #include "src/Globals/Settings.h"
 #include "src/Globals/SecuritySettings.h"
 #include "src/Globals/ESPEasyWiFiEvent.h"
@@ -136,7 +137,7 @@ String do_create_http_request(
   const String& hostportString,
   const String& method, const String& uri,
   const String& auth_header, const String& additional_options,
-  int content_length) {
+  int content_length, bool keep_alive) {
   int estimated_size = hostportString.length() + method.length()
                        + uri.length() + auth_header.length()
                        + additional_options.length()
@@ -170,7 +171,11 @@ String do_create_http_request(
   request += "\r\n";
   request += additional_options;
   request += get_user_agent_request_header_field();
-  request += F("Connection: close\r\n");
+
+  if (!keep_alive) {
+    // Blocking requests read the reply until the server closes the connection.
+    request += F("Connection: close\r\n");
+  }
   request += "\r\n";
 #ifndef BUILD_NO_DEBUG
   addLog(LOG_LEVEL_DEBUG, request);
@@ -183,8 +188,9 @@ String do_create_http_request(
   const String& method, const String& uri) {
   return do_create_http_request(hostportString, method, uri,
                                 "", // auth_header
-                                "", // additional_options
-                                -1  // content_length
+                                "",   // additional_options
+                                -1,   // content_length
+                                false // keep_alive
                                 );
 }
 
@@ -200,7 +206,8 @@ String do_create_http_request(
     uri,
     "", // auth_header
     "", // additional_options
-    content_length);
+    content_length,
+    true); // keep_alive, sent via the persistent ControllerHTTPClient
 }
 
 String create_http_request_auth(
@@ -215,7 +222,8 @@ String create_http_request_auth(
     uri,
     get_auth_header(controller_index, ControllerSettings),
     "", // additional_options
-    content_length);
+    content_length,
+    true); // keep_alive, sent via the persistent ControllerHTTPClient
 }
 
 String create_http_get_request(int controller_number, ControllerSettingsStruct& ControllerSettings,
@@ -315,6 +323,42 @@ bool client_available(WiFiClient& client) {
   return (client.available() != 0) || (client.connected() != 0);
 }
 
+// Check the status line of a HTTP reply, e.g. "HTTP/1.1 200 OK"
+// Return true on success (2xx).
+bool check_http_status_line(const String& logIdentifier, const String& line, const String& postStr) {
+  if (!line.startsWith(F("HTTP/1.")) || (line.length() < 10)) {
+    return false;
+  }
+
+  if (line[9] == '2')
+  {
+    // Leave this debug info in the build, regardless of the
+    // BUILD_NO_DEBUG flags.
+    if (loglevelActiveFor(LOG_LEVEL_DEBUG)) {
+      String log = F("HTTP : ");
+      log += logIdentifier;
+      log += F(" Success! ");
+      log += line;
+      addLog(LOG_LEVEL_DEBUG, log);
+    }
+    return true;
+  }
+
+  if (line[9] == '4') {
+    if (loglevelActiveFor(LOG_LEVEL_ERROR)) {
+      String log = F("HTTP : ");
+      log += logIdentifier;
+      log += F(" Error: ");
+      log += line;
+      addLog(LOG_LEVEL_ERROR, log);
+    }
+#ifndef BUILD_NO_DEBUG
+    addLog(LOG_LEVEL_DEBUG_MORE, postStr);
+#endif // ifndef BUILD_NO_DEBUG
+  }
+  return false;
+}
+
 bool send_via_http(const String& logIdentifier, WiFiClient& client, const String& postStr, bool must_check_reply) {
   bool success = !must_check_reply;
 
@@ -380,30 +424,8 @@ bool send_via_http(const String& logIdentifier, WiFiClient& client, const String
       }
 #endif // ifndef BUILD_NO_DEBUG
 
-      if (line.startsWith(F("HTTP/1.1 2")))
-      {
+      if (check_http_status_line(logIdentifier, line, postStr)) {
         success = true;
-
-        // Leave this debug info in the build, regardless of the
-        // BUILD_NO_DEBUG flags.
-        if (loglevelActiveFor(LOG_LEVEL_DEBUG)) {
-          String log = F("HTTP : ");
-          log += logIdentifier;
-          log += F(" Success! ");
-          log += line;
-          addLog(LOG_LEVEL_DEBUG, log);
-        }
-      } else if (line.startsWith(F("HTTP/1.1 4"))) {
-        if (loglevelActiveFor(LOG_LEVEL_ERROR)) {
-          String log = F("HTTP : ");
-          log += logIdentifier;
-          log += F(" Error: ");
-          log += line;
-          addLog(LOG_LEVEL_ERROR, log);
-        }
-#ifndef BUILD_NO_DEBUG
-        addLog(LOG_LEVEL_DEBUG_MORE, postStr);
-#endif // ifndef BUILD_NO_DEBUG
       }
       delay(0);
     }
@@ -428,6 +450,59 @@ bool send_via_http(int controller_number, WiFiClient& client, const String& post
 }
 
 
+bool connect_controller_http_client(int controller_number, ControllerSettingsStruct& ControllerSettings) {
+  ControllerHTTPClient& http = controllerHTTPClients[controller_number];
+
+  if (http.busy()) {
+    // Connection is in use by a request
+    return true;
+  }
+  return http.open(controller_number, ControllerSettings);
+}
+
+bool send_via_http(int controller_number, ControllerSettingsStruct& ControllerSettings, const String& postStr, bool must_check_reply) {
+  ControllerHTTPClient& http = controllerHTTPClients[controller_number];
+
+  switch (http.state) {
+    case ControllerHTTPClient::State::Done:
+      // Result of the request started by the previous call.
+      return http.collect();
+    case ControllerHTTPClient::State::Idle:
+      http.begin(postStr, must_check_reply);
+
+    // fall through
+    case ControllerHTTPClient::State::Connecting:
+      http.connect(controller_number, ControllerSettings);
+
+      if (!http.busy()) {
+        // Could not connect
+        return http.collect();
+      }
+      break;
+    default:
+      break;
+  }
+  return false;
+}
+
+bool controller_http_request_busy(int controller_number) {
+  auto it = controllerHTTPClients.find(controller_number);
+
+  if (it == controllerHTTPClients.end()) {
+    return false;
+  }
+  return it->second.busy();
+}
+
+bool poll_controller_http_request(int controller_number) {
+  auto it = controllerHTTPClients.find(controller_number);
+
+  if (it == controllerHTTPClients.end()) {
+    return false;
+  }
+  return it->second.poll(controller_number);
+}
+
 String getControllerUser(controllerIndex_t controller_idx, const ControllerSettingsStruct& ControllerSettings)
 {
   if (!validControllerIndex(controller_idx)) return "";
@@ -29,7 +29,7 @@ String do_create_http_request(
   const String& hostportString,
   const String& method, const String& uri,
   const String& auth_header, const String& additional_options,
-  int content_length);
+  int content_length, bool keep_alive);
 
 String do_create_http_request(
   const String& hostportString,
@@ -70,10 +70,28 @@ bool try_connect_host(int controller_number, WiFiClient& client, ControllerSetti
 //      https://github.com/esp8266/Arduino/pull/1829
 bool client_available(WiFiClient& client);
 
+// Check the status line of a HTTP reply, e.g. "HTTP/1.1 200 OK"
+bool check_http_status_line(const String& logIdentifier, const String& line, const String& postStr);
+
 bool send_via_http(const String& logIdentifier, WiFiClient& client, const String& postStr, bool must_check_reply);
 
 bool send_via_http(int controller_number, WiFiClient& client, const String& postStr, bool must_check_reply);
 
+// Open the persistent connection of the controller, unless it is still open to the same host.
+bool connect_controller_http_client(int controller_number, ControllerSettingsStruct& ControllerSettings);
+
+// Send via the persistent connection of the controller, which is kept open when the server allows it.
+// The request is processed asynchronously by the controller delay queue (see DEFINE_Cxxx_DELAY_QUEUE_MACRO):
+// - First call starts the request and returns false, poll_controller_http_request() must be called until it returns false.
+// - Next call returns the result of the request, or reconnects when the server closed the reused connection.
+bool send_via_http(int controller_number, ControllerSettingsStruct& ControllerSettings, const String& postStr, bool must_check_reply);
+
+// A request of the controller is in progress.
+bool controller_http_request_busy(int controller_number);
+
+// Perform the next step of the request of the controller, return true while it is waiting for the server.
+bool poll_controller_http_request(int controller_number);
+
 String getControllerUser(controllerIndex_t controller_idx, const ControllerSettingsStruct& ControllerSettings);
 String getControllerPass(controllerIndex_t controller_idx, const ControllerSettingsStruct& ControllerSettings);
 void setControllerUser(controllerIndex_t controller_idx, const ControllerSettingsStruct& ControllerSettings, const String& value);
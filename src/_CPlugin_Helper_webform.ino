@@ -34,6 +34,8 @@ String getControllerParameterName(protocolIndex_t ProtocolIndex, ControllerSetti
     case ControllerSettingsStruct::CONTROLLER_MAX_QUEUE_DEPTH:          name = F("Max Queue Depth");        break;
     case ControllerSettingsStruct::CONTROLLER_MAX_RETRIES:              name = F("Max Retries");            break;
     case ControllerSettingsStruct::CONTROLLER_FULL_QUEUE_ACTION:        name = F("Full Queue Action");      break;
+    case ControllerSettingsStruct::CONTROLLER_MAX_BATCH_SIZE:           name = F("Max Batch Size");         break;
+    case ControllerSettingsStruct::CONTROLLER_BATCH_FLUSH_DELAY:        name = F("Batch Flush Delay");      break;
     case ControllerSettingsStruct::CONTROLLER_CHECK_REPLY:              name = F("Check Reply");            break;
 
     case ControllerSettingsStruct::CONTROLLER_CLIENT_ID:                name = F("Controller Client ID");   break;
@@ -166,6 +168,19 @@ void addControllerParameterForm(const ControllerSettingsStruct& ControllerSettin
       addFormSelector(displayName, internalName, 2, options, NULL, NULL, ControllerSettings.DeleteOldest, false);
       break;
     }
+    case ControllerSettingsStruct::CONTROLLER_MAX_BATCH_SIZE:
+    {
+      addFormNumericBox(displayName, internalName, ControllerSettings.MaxBatchSize, 0, CONTROLLER_DELAY_QUEUE_BATCH_MAX);
+      addFormNote(F("Max. number of queued messages sent at once, 0 = no batching"));
+      break;
+    }
+    case ControllerSettingsStruct::CONTROLLER_BATCH_FLUSH_DELAY:
+    {
+      addFormNumericBox(displayName, internalName, ControllerSettings.BatchFlushDelay, 0, CONTROLLER_DELAY_QUEUE_BATCH_FLUSH_MAX);
+      addUnit(F("ms"));
+      addFormNote(F("Max. time to wait for a full batch"));
+      break;
+    }
     case ControllerSettingsStruct::CONTROLLER_CHECK_REPLY:
     {
       String options[2];
@@ -280,6 +295,12 @@ void saveControllerParameterForm(ControllerSettingsStruct& ControllerSettings, c
     case ControllerSettingsStruct::CONTROLLER_FULL_QUEUE_ACTION:
       ControllerSettings.DeleteOldest = getFormItemInt(internalName, ControllerSettings.DeleteOldest);
       break;
+    case ControllerSettingsStruct::CONTROLLER_MAX_BATCH_SIZE:
+      ControllerSettings.MaxBatchSize = getFormItemInt(internalName, ControllerSettings.MaxBatchSize);
+      break;
+    case ControllerSettingsStruct::CONTROLLER_BATCH_FLUSH_DELAY:
+      ControllerSettings.BatchFlushDelay = getFormItemInt(internalName, ControllerSettings.BatchFlushDelay);
+      break;
     case ControllerSettingsStruct::CONTROLLER_CHECK_REPLY:
       ControllerSettings.MustCheckReply = getFormItemInt(internalName, ControllerSettings.MustCheckReply);
       break;
@@ -127,6 +127,7 @@ boolean Plugin_001(byte function, struct EventStruct *event, String& string)
       Device[deviceCount].TimerOption        = true;
       Device[deviceCount].TimerOptional      = true;
       Device[deviceCount].GlobalSyncOption   = true;
+      Device[deviceCount].Callbacks          = PLUGIN_CALLBACK_TEN_PER_SECOND | PLUGIN_CALLBACK_WRITE | PLUGIN_CALLBACK_REQUEST;
       break;
     }
 
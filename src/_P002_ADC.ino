@@ -108,6 +108,7 @@ boolean Plugin_002(byte function, struct EventStruct *event, String& string)
       Device[deviceCount].SendDataOption     = true;
       Device[deviceCount].TimerOption        = true;
       Device[deviceCount].GlobalSyncOption   = true;
+      Device[deviceCount].Callbacks          = PLUGIN_CALLBACK_TEN_PER_SECOND;
       break;
     }
 
@@ -50,6 +50,7 @@ boolean Plugin_003(byte function, struct EventStruct *event, String& string)
       Device[deviceCount].SendDataOption     = true;
       Device[deviceCount].TimerOption        = true;
       Device[deviceCount].GlobalSyncOption   = true;
+      Device[deviceCount].Callbacks          = PLUGIN_CALLBACK_WRITE;
       break;
     }
 
@@ -31,6 +31,7 @@ boolean Plugin_007(byte function, struct EventStruct *event, String& string)
         Device[deviceCount].SendDataOption = true;
         Device[deviceCount].TimerOption = true;
         Device[deviceCount].GlobalSyncOption = true;
+        Device[deviceCount].Callbacks = PLUGIN_CALLBACK_NONE;
         break;
       }
 
@@ -39,6 +39,7 @@ boolean Plugin_008(byte function, struct EventStruct *event, String& string)
         Device[deviceCount].SendDataOption = true;
         Device[deviceCount].TimerOption = false;
         Device[deviceCount].GlobalSyncOption = true;
+        Device[deviceCount].Callbacks = PLUGIN_CALLBACK_ONCE_A_SECOND;
         break;
       }
 
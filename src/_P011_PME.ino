@@ -31,6 +31,7 @@ boolean Plugin_011(byte function, struct EventStruct *event, String& string)
         Device[deviceCount].ValueCount = 1;
         Device[deviceCount].SendDataOption = true;
         Device[deviceCount].TimerOption = true;
+        Device[deviceCount].Callbacks = PLUGIN_CALLBACK_WRITE;
         break;
       }
 
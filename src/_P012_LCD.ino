@@ -46,6 +46,7 @@ boolean Plugin_012(byte function, struct EventStruct *event, String& string)
         Device[deviceCount].ValueCount = 0;
         Device[deviceCount].SendDataOption = false;
         Device[deviceCount].TimerOption = true;
+        Device[deviceCount].Callbacks = PLUGIN_CALLBACK_TEN_PER_SECOND | PLUGIN_CALLBACK_ONCE_A_SECOND | PLUGIN_CALLBACK_WRITE;
         break;
       }
 
@@ -287,7 +288,7 @@ boolean Plugin_012(byte function, struct EventStruct *event, String& string)
 // Perform some specific changes for LCD display
 // https://www.letscontrolit.com/forum/viewtopic.php?t=2368
 String P012_parseTemplate(String &tmpString, byte lineSize) {
-  String result = parseTemplate_padded(tmpString, lineSize);
+  String result = parseTemplate_padded(tmpString, lineSize, false, true);
   const char degree[3] = {0xc2, 0xb0, 0};  // Unicode degree symbol
   const char degree_lcd[2] = {0xdf, 0};  // P012_LCD degree symbol
   result.replace(degree, degree_lcd);
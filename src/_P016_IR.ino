@@ -119,6 +119,7 @@ boolean Plugin_016(byte function, struct EventStruct *event, String &string)
     Device[deviceCount].SendDataOption = true;
     Device[deviceCount].TimerOption = false;
     Device[deviceCount].GlobalSyncOption = true;
+    Device[deviceCount].Callbacks = PLUGIN_CALLBACK_TEN_PER_SECOND;
     break;
   }
 
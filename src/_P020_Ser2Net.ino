@@ -31,6 +31,7 @@ boolean Plugin_020(byte function, struct EventStruct *event, String& string)
       Device[deviceCount].Type        = DEVICE_TYPE_SINGLE;
       Device[deviceCount].Custom      = true;
       Device[deviceCount].TimerOption = false;
+      Device[deviceCount].Callbacks = PLUGIN_CALLBACK_TEN_PER_SECOND | PLUGIN_CALLBACK_WRITE | PLUGIN_CALLBACK_SERIAL_IN;
       break;
     }
 
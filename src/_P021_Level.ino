@@ -30,6 +30,7 @@ boolean Plugin_021(byte function, struct EventStruct *event, String& string)
         Device[deviceCount].ValueCount = 1;
         Device[deviceCount].SendDataOption = true;
         Device[deviceCount].TimerOption = false;
+        Device[deviceCount].Callbacks = PLUGIN_CALLBACK_TEN_PER_SECOND;
         break;
       }
 
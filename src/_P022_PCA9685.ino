@@ -109,6 +109,7 @@ boolean Plugin_022(byte function, struct EventStruct *event, String& string)
       Device[deviceCount].ValueCount         = 0;
       Device[deviceCount].Custom             = true;
       Device[deviceCount].TimerOption        = false;
+      Device[deviceCount].Callbacks          = PLUGIN_CALLBACK_WRITE;
       break;
     }
 
@@ -62,6 +62,7 @@ boolean Plugin_023(byte function, struct EventStruct *event, String& string)
         Device[deviceCount].ValueCount = 0;
         Device[deviceCount].SendDataOption = false;
         Device[deviceCount].TimerOption = true;
+        Device[deviceCount].Callbacks = PLUGIN_CALLBACK_TEN_PER_SECOND | PLUGIN_CALLBACK_ONCE_A_SECOND | PLUGIN_CALLBACK_WRITE;
         break;
       }
 
@@ -390,7 +391,7 @@ const char Plugin_023_myFont_Size[] PROGMEM = {
 
 // Perform some specific changes for OLED display
 String P023_parseTemplate(String &tmpString, byte lineSize) {
-  String result = parseTemplate_padded(tmpString, lineSize);
+  String result = parseTemplate_padded(tmpString, lineSize, false, true);
   const char degree[3] = {0xc2, 0xb0, 0};  // Unicode degree symbol
   const char degree_oled[2] = {0x7F, 0};  // P023_OLED degree symbol
   result.replace(degree, degree_oled);
@@ -52,6 +52,7 @@ boolean Plugin_026(byte function, struct EventStruct *event, String& string)
       Device[deviceCount].SendDataOption = true;
       Device[deviceCount].TimerOption    = true;
       Device[deviceCount].FormulaOption  = true;
+      Device[deviceCount].Callbacks      = PLUGIN_CALLBACK_NONE;
       break;
     }
 
@@ -68,6 +68,7 @@ boolean Plugin_035(byte function, struct EventStruct *event, String &command)
         Device[++deviceCount].Number = PLUGIN_ID_035;
         Device[deviceCount].Type = DEVICE_TYPE_SINGLE;
         Device[deviceCount].SendDataOption = false;
+        Device[deviceCount].Callbacks = PLUGIN_CALLBACK_WRITE;
         break;
       }
 
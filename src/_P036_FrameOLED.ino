@@ -280,6 +280,7 @@ boolean Plugin_036(uint8_t function, struct EventStruct *event, String& string)
         Device[deviceCount].ValueCount = 0;
         Device[deviceCount].SendDataOption = false;
         Device[deviceCount].TimerOption = true;
+        Device[deviceCount].Callbacks = PLUGIN_CALLBACK_TEN_PER_SECOND | PLUGIN_CALLBACK_ONCE_A_SECOND | PLUGIN_CALLBACK_WRITE;
         break;
       }
 
@@ -820,7 +821,7 @@ void P36_setContrast(uint8_t OLED_contrast) {
 
 // Perform some specific changes for OLED display
 String P36_parseTemplate(String &tmpString, uint8_t lineSize) {
-  String result = parseTemplate_padded(tmpString, lineSize);
+  String result = parseTemplate_padded(tmpString, lineSize, false, true);
   // OLED lib uses this routine to convert UTF8 to extended ASCII
   // http://playground.arduino.cc/Main/Utf8ascii
   // Attempt to display euro sign (FIXME)
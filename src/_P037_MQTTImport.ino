@@ -12,6 +12,7 @@
 #include "src/Globals/CPlugins.h"
 #include "src/Globals/Plugins.h"
 #include "_Plugin_Helper.h"
+#include "src/PluginStructs/P037_SubscriptionTrie.h"
 
 #define PLUGIN_037
 #define PLUGIN_ID_037         37
@@ -22,8 +23,6 @@
 #define PLUGIN_VALUENAME3_037 "Value3"
 #define PLUGIN_VALUENAME4_037 "Value4"
 
-#define PLUGIN_IMPORT 37		// This is a 'private' function used only by this import module
-
 // Declare a Wifi client for this plugin only
 
 // TODO TD-er: These must be kept in some vector to allow multiple instances of MQTT import.
@@ -34,6 +33,9 @@ bool MQTTclient_037_connected = false;
 #endif //USES_MQTT
 int reconnectCount = 0;
 
+// Subscriptions of all MQTT import tasks, to find the task values set by an incoming message.
+P037_SubscriptionTrie P037_subscriptions;
+
 String getClientName() {
   //
   // Generate the MQTT import client name from the system name and a suffix
@@ -116,6 +118,7 @@ boolean Plugin_037(byte function, struct EventStruct *event, String& string)
         Device[deviceCount].ValueCount = 4;
         Device[deviceCount].SendDataOption = false;
         Device[deviceCount].TimerOption = false;
+        Device[deviceCount].Callbacks = PLUGIN_CALLBACK_TEN_PER_SECOND | PLUGIN_CALLBACK_ONCE_A_SECOND;
         break;
       }
 
@@ -172,6 +175,8 @@ boolean Plugin_037(byte function, struct EventStruct *event, String& string)
     case PLUGIN_INIT:
       {
         success = false;
+        P037_updateSubscriptions();
+
         //    When we edit the subscription data from the webserver, the plugin is called again with init.
         //    In order to resubscribe we have to disconnect and reconnect in order to get rid of any obsolete subscriptions
         if (MQTTclient_037 != NULL) {
@@ -228,79 +233,6 @@ boolean Plugin_037(byte function, struct EventStruct *event, String& string)
         success = false;
         break;
       }
-
-    case PLUGIN_IMPORT:
-      {
-        // This is a private option only used by the MQTT 037 callback function
-
-        //      Get the payload and check it out
-        LoadTaskSettings(event->TaskIndex);
-
-        // FIXME TD-er: It may be useful to generate events with string values.
-        String Payload = event->String2;
-        float floatPayload;
-        if (!string2float(Payload, floatPayload)) {
-          String log = F("IMPT : Bad Import MQTT Command ");
-          log += event->String1;
-          addLog(LOG_LEVEL_ERROR, log);
-          log = F("ERR  : Illegal Payload ");
-          log += Payload;
-          log += "  ";
-          log += getTaskDeviceName(event->TaskIndex);
-          addLog(LOG_LEVEL_INFO, log);
-          success = false;
-          break;
-        }
-
-        //      Get the Topic and see if it matches any of the subscriptions
-
-        String Topic = event->String1;
-
-        LoadCustomTaskSettings(event->TaskIndex, (byte*)&deviceTemplate, sizeof(deviceTemplate));
-
-        for (byte x = 0; x < 4; x++)
-        {
-          String subscriptionTopic = deviceTemplate[x];
-          subscriptionTopic.trim();
-          if (subscriptionTopic.length() == 0) continue;							// skip blank subscriptions
-
-          // Now check if the incoming topic matches one of our subscriptions
-          parseSystemVariables(subscriptionTopic, false);
-          if (MQTTCheckSubscription_037(Topic, subscriptionTopic))
-          {
-            UserVar[event->BaseVarIndex + x] = floatPayload;							// Save the new value
-
-            // Log the event
-            if (loglevelActiveFor(LOG_LEVEL_INFO)) {
-              String log = F("IMPT : [");
-              log += getTaskDeviceName(event->TaskIndex);
-              log += F("#");
-              log += ExtraTaskSettings.TaskDeviceValueNames[x];
-              log += F("] : ");
-              log += floatPayload;
-              addLog(LOG_LEVEL_INFO, log);
-            }
-
-            // Generate event for rules processing - proposed by TridentTD
-
-            if (Settings.UseRules)
-            {
-              String RuleEvent = "";
-              RuleEvent += getTaskDeviceName(event->TaskIndex);
-              RuleEvent += F("#");
-              RuleEvent += ExtraTaskSettings.TaskDeviceValueNames[x];
-              RuleEvent += F("=");
-              RuleEvent += floatPayload;
-              eventQueue.add(RuleEvent);
-            }
-
-            success = true;
-          }
-        }
-
-        break;
-
-      }
   }
 
   return success;
@@ -356,44 +288,97 @@ boolean MQTTSubscribe_037()
   }
   return true;
 }
+//
+// Compile the subscriptions of all MQTT import tasks.
+// Task and value names are looked up here, so no settings have to be loaded per message.
+//
+void P037_updateSubscriptions()
+{
+  char deviceTemplate[4][41];
+
+  P037_subscriptions.clear();
+
+  for (taskIndex_t y = 0; y < TASKS_MAX; y++)
+  {
+    if (Settings.TaskDeviceNumber[y] == PLUGIN_ID_037 && Settings.TaskDeviceEnabled[y])
+    {
+      LoadTaskSettings(y);
+      LoadCustomTaskSettings(y, (byte*)&deviceTemplate, sizeof(deviceTemplate));
+
+      for (byte x = 0; x < 4; x++)
+      {
+        String subscription = deviceTemplate[x];
+        subscription.trim();
+        if (subscription.length() == 0) continue;							// skip blank subscriptions
+
+        parseSystemVariables(subscription, false);
+        String name = getTaskDeviceName(y);
+        name += '#';
+        name += ExtraTaskSettings.TaskDeviceValueNames[x];
+        P037_subscriptions.add(subscription, y, x, name);
+      }
+    }
+  }
+}
+
 //
 // handle MQTT messages
 //
 void mqttcallback_037(char* c_topic, byte* b_payload, unsigned int length)
 {
-  // Here we have incomng MQTT messages from the mqtt import module
-  String topic = c_topic;
-
-  char cpayload[256];
-  strncpy(cpayload, (char*)b_payload, length);
-  cpayload[length] = 0;
-  String payload = cpayload;		// convert byte to char string
+  // Here we have incoming MQTT messages from the mqtt import module
+  // Kept to reuse its memory for the next message.
+  static std::vector<const P037_SubscriptionSlot *> matches;
+
+  matches.clear();
+  P037_subscriptions.match(c_topic, matches);
+  if (matches.empty()) return;
+
+  String payload;
+  payload.reserve(length);
+  for (unsigned int i = 0; i < length; ++i) {
+    payload += static_cast<char>(b_payload[i]);
+  }
   payload.trim();
 
-  deviceIndex_t DeviceIndex = getDeviceIndex(PLUGIN_ID_037);   // This is the device index of 037 modules -there should be one!
-  if (!validDeviceIndex(DeviceIndex)) {
-    // This should never happen.
-    addLog(LOG_LEVEL_ERROR, F("Plugin 037 does not exist"));
+  // FIXME TD-er: It may be useful to generate events with string values.
+  float floatPayload;
+  if (!string2float(payload, floatPayload)) {
+    String log = F("IMPT : Bad Import MQTT Command ");
+    log += c_topic;
+    addLog(LOG_LEVEL_ERROR, log);
+    log = F("ERR  : Illegal Payload ");
+    log += payload;
+    addLog(LOG_LEVEL_INFO, log);
     return;
   }
 
-  // We generate a temp event structure to pass to the plugins
-
-  struct EventStruct TempEvent;
-
-  TempEvent.String1 = topic;                            // This is the topic of the message
-  TempEvent.String2 = payload;                          // This is the payload
+  //  Set the values of all task values subscribed to this topic
+  for (const P037_SubscriptionSlot *slot : matches)
+  {
+    const taskIndex_t taskIndex = slot->taskIndex;
+    if (Settings.TaskDeviceNumber[taskIndex] != PLUGIN_ID_037 || !Settings.TaskDeviceEnabled[taskIndex]) continue;
+
+    UserVar[taskIndex * VARS_PER_TASK + slot->valueIndex] = floatPayload;			// Save the new value
+    markUserVarDirtyRTC(taskIndex);
+
+    // Log the event
+    if (loglevelActiveFor(LOG_LEVEL_INFO)) {
+      String log = F("IMPT : [");
+      log += slot->name;
+      log += F("] : ");
+      log += floatPayload;
+      addLog(LOG_LEVEL_INFO, log);
+    }
 
-  //  Here we loop over all tasks and call each 037 plugin with function PLUGIN_IMPORT
+    // Generate event for rules processing - proposed by TridentTD
 
-  for (taskIndex_t y = 0; y < TASKS_MAX; y++)
-  {
-    if (Settings.TaskDeviceNumber[y] == PLUGIN_ID_037)                // if we have found a 037 device, then give it something to think about!
+    if (Settings.UseRules)
     {
-      TempEvent.TaskIndex = y;
-      LoadTaskSettings(TempEvent.TaskIndex);
-      TempEvent.BaseVarIndex = y * VARS_PER_TASK;           // This is the index in Uservar where values for this task are stored
-      schedule_plugin_task_event_timer(DeviceIndex, PLUGIN_IMPORT, &TempEvent);
+      String RuleEvent = slot->name;
+      RuleEvent += F("=");
+      RuleEvent += floatPayload;
+      eventQueue.add(RuleEvent);
     }
   }
 }
@@ -466,69 +451,4 @@ boolean MQTTConnect_037()
   return MQTTclient_037->connected();
 }
 
-//
-// Check to see if Topic matches the MQTT subscription
-//
-boolean MQTTCheckSubscription_037(const String& Topic, const String& Subscription) {
-
-  String tmpTopic = Topic;
-  String tmpSub = Subscription;
-
-  tmpTopic.trim();
-  tmpSub.trim();
-
-  // Get rid of any initial /
-
-  if (tmpTopic.substring(0, 1) == "/")tmpTopic = tmpTopic.substring(1);
-  if (tmpSub.substring(0, 1) == "/")tmpSub = tmpSub.substring(1);
-
-  // Add trailing / if required
-
-  int lenTopic = tmpTopic.length();
-  if (tmpTopic.substring(lenTopic - 1, lenTopic) != "/")tmpTopic += '/';
-
-  int lenSub = tmpSub.length();
-  if (tmpSub.substring(lenSub - 1, lenSub) != "/")tmpSub += '/';
-
-  // Now get first part
-
-  int SlashTopic;
-  int SlashSub;
-  int count = 0;
-
-  String pTopic;
-  String pSub;
-
-  while (count < 10) {
-
-    //  Get locations of the first /
-
-    SlashTopic = tmpTopic.indexOf('/');
-    SlashSub = tmpSub.indexOf('/');
-
-    //  If no slashes found then match is OK
-    //  If only one slash found then not OK
-
-    if ((SlashTopic == -1) && (SlashSub == -1)) return true;
-    if ((SlashTopic == -1) && (SlashSub != -1)) return false;
-    if ((SlashTopic != -1) && (SlashSub == -1)) return false;
-
-    //  Get the values for the current subtopic
-
-    pTopic = tmpTopic.substring(0, SlashTopic);
-    pSub = tmpSub.substring(0, SlashSub);
-
-    //  And strip the subtopic from the topic
-
-    tmpTopic = tmpTopic.substring(SlashTopic + 1);
-    tmpSub = tmpSub.substring(SlashSub + 1);
-
-    //  If the subtopics match then OK - otherwise fail
-    if (pSub == "#")  return true;
-    if ((pTopic != pSub) && (pSub != "+"))return false;
-
-    count = count + 1;
-  }
-  return false;
-}
 #endif // USES_P037
@@ -52,6 +52,7 @@ boolean Plugin_038(byte function, struct EventStruct *event, String& string)
         Device[deviceCount].Type = DEVICE_TYPE_SINGLE;
         Device[deviceCount].Custom = true;
         Device[deviceCount].TimerOption = false;
+        Device[deviceCount].Callbacks = PLUGIN_CALLBACK_WRITE;
         break;
       }
 
@@ -35,6 +35,7 @@ boolean Plugin_041(byte function, struct EventStruct *event, String& string)
         Device[deviceCount].FormulaOption = false;
         Device[deviceCount].ValueCount = 0;
         Device[deviceCount].SendDataOption = false;
+        Device[deviceCount].Callbacks = PLUGIN_CALLBACK_ONCE_A_SECOND | PLUGIN_CALLBACK_CLOCK_IN | PLUGIN_CALLBACK_WRITE;
         break;
       }
 
@@ -117,6 +117,7 @@ boolean Plugin_042(byte function, struct EventStruct *event, String& string)
         Device[deviceCount].SendDataOption = true;
         Device[deviceCount].TimerOption = true;
         Device[deviceCount].GlobalSyncOption = false;
+        Device[deviceCount].Callbacks = PLUGIN_CALLBACK_FIFTY_PER_SECOND | PLUGIN_CALLBACK_ONCE_A_SECOND | PLUGIN_CALLBACK_WRITE;
         break;
       }
 
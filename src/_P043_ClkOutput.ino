@@ -29,6 +29,7 @@ boolean Plugin_043(byte function, struct EventStruct *event, String& string)
         Device[deviceCount].FormulaOption = false;
         Device[deviceCount].ValueCount = 1;
         Device[deviceCount].SendDataOption = true;
+        Device[deviceCount].Callbacks = PLUGIN_CALLBACK_CLOCK_IN;
         break;
       }
 
@@ -103,6 +103,7 @@ boolean Plugin_045(byte function, struct EventStruct *event, String& string)
         Device[deviceCount].SendDataOption = true;            //   and I use Domoticz ... so there.
         Device[deviceCount].TimerOption = true;
         Device[deviceCount].FormulaOption = false;
+        Device[deviceCount].Callbacks = PLUGIN_CALLBACK_ONCE_A_SECOND;
         break;
       }
 
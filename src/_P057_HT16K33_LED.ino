@@ -93,6 +93,7 @@ boolean Plugin_057(byte function, struct EventStruct *event, String& string)
         Device[deviceCount].TimerOption = false;
         Device[deviceCount].TimerOptional = false;
         Device[deviceCount].GlobalSyncOption = true;
+        Device[deviceCount].Callbacks = PLUGIN_CALLBACK_TEN_PER_SECOND | PLUGIN_CALLBACK_CLOCK_IN | PLUGIN_CALLBACK_WRITE;
         break;
       }
 
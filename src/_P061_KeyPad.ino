@@ -81,6 +81,7 @@ boolean Plugin_061(byte function, struct EventStruct *event, String& string)
         Device[deviceCount].TimerOption = true;
         Device[deviceCount].TimerOptional = true;
         Device[deviceCount].GlobalSyncOption = true;
+        Device[deviceCount].Callbacks = PLUGIN_CALLBACK_FIFTY_PER_SECOND;
         break;
       }
 
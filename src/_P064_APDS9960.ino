@@ -54,6 +54,7 @@ boolean Plugin_064(byte function, struct EventStruct *event, String& string)
         Device[deviceCount].TimerOption = true;
         Device[deviceCount].TimerOptional = true;
         Device[deviceCount].GlobalSyncOption = true;
+        Device[deviceCount].Callbacks = PLUGIN_CALLBACK_FIFTY_PER_SECOND;
         break;
       }
 
@@ -163,6 +163,7 @@ boolean Plugin_067(byte function, struct EventStruct *event, String& string)
         Device[deviceCount].TimerOption = true;
         Device[deviceCount].TimerOptional = false;
         Device[deviceCount].GlobalSyncOption = true;
+        Device[deviceCount].Callbacks = PLUGIN_CALLBACK_FIFTY_PER_SECOND | PLUGIN_CALLBACK_WRITE;
         break;
       }
 
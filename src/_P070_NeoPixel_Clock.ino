@@ -164,6 +164,7 @@ boolean Plugin_070(byte function, struct EventStruct *event, String& string)
         Device[deviceCount].SendDataOption = false;
         Device[deviceCount].TimerOption = false;
         Device[deviceCount].GlobalSyncOption = false;
+        Device[deviceCount].Callbacks = PLUGIN_CALLBACK_ONCE_A_SECOND | PLUGIN_CALLBACK_WRITE;
         break;
       }
 
@@ -80,6 +80,7 @@ boolean Plugin_074(byte function, struct EventStruct *event, String &string) {
       Device[deviceCount].TimerOption = true;
       Device[deviceCount].TimerOptional = false;
       Device[deviceCount].GlobalSyncOption = true;
+      Device[deviceCount].Callbacks = PLUGIN_CALLBACK_NONE;
       break;
     }
 
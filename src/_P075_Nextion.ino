@@ -118,6 +118,7 @@ boolean Plugin_075(byte function, struct EventStruct *event, String& string)
       Device[deviceCount].TimerOption = true;
       Device[deviceCount].TimerOptional = true;         // Allow user to disable interval function.
       Device[deviceCount].GlobalSyncOption = true;
+      Device[deviceCount].Callbacks = PLUGIN_CALLBACK_TEN_PER_SECOND | PLUGIN_CALLBACK_ONCE_A_SECOND | PLUGIN_CALLBACK_WRITE;
       break;
     }
 
@@ -291,7 +292,7 @@ boolean Plugin_075(byte function, struct EventStruct *event, String& string)
               newString += String(barVal,DEC);
             }
             else {
-              newString = parseTemplate(tmpString);
+              newString = parseTemplate_padded(tmpString, 0, false, true);
             }
 
             P075_sendCommand(event->TaskIndex, newString.c_str());
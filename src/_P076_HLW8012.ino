@@ -121,6 +121,7 @@ boolean Plugin_076(byte function, struct EventStruct *event, String &string) {
     Device[deviceCount].SendDataOption = true;
     Device[deviceCount].TimerOption = true;
     Device[deviceCount].GlobalSyncOption = false;
+    Device[deviceCount].Callbacks = PLUGIN_CALLBACK_TEN_PER_SECOND | PLUGIN_CALLBACK_WRITE;
     break;
   }
 
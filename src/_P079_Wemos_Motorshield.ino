@@ -79,6 +79,7 @@ boolean Plugin_079(byte function, struct EventStruct *event, String& string)
 		Device[deviceCount].ValueCount = 0;
 		Device[deviceCount].SendDataOption = false;
 		Device[deviceCount].TimerOption = false;
+		Device[deviceCount].Callbacks = PLUGIN_CALLBACK_WRITE;
 		break;
 	}
 
@@ -192,6 +192,7 @@ boolean Plugin_081(byte function, struct EventStruct *event, String& string)
       Device[deviceCount].TimerOptional    = false;
       Device[deviceCount].GlobalSyncOption = true;
       Device[deviceCount].DecimalsOnly     = true;
+      Device[deviceCount].Callbacks        = PLUGIN_CALLBACK_ONCE_A_SECOND | PLUGIN_CALLBACK_TIME_CHANGE;
       break;
     }
 
@@ -50,6 +50,7 @@ boolean Plugin_086(byte function, struct EventStruct *event, String& string)
         Device[deviceCount].TimerOption = false;
         Device[deviceCount].GlobalSyncOption = false;
         Device[deviceCount].Custom = true;
+        Device[deviceCount].Callbacks = PLUGIN_CALLBACK_WRITE;
         break;
       }
 
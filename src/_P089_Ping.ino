@@ -145,6 +145,7 @@ boolean Plugin_089(byte function, struct EventStruct *event, String& string)
     Device[deviceCount].FormulaOption = false;
     Device[deviceCount].SendDataOption = true;
     Device[deviceCount].TimerOption = true;
+    Device[deviceCount].Callbacks = PLUGIN_CALLBACK_WRITE;
     break;
   }
 
@@ -204,6 +204,7 @@ boolean Plugin_090(byte function, struct EventStruct *event, String& string)
       Device[deviceCount].ValueCount         = 2;
       Device[deviceCount].SendDataOption     = true;
       Device[deviceCount].TimerOption        = true;
+      Device[deviceCount].Callbacks          = PLUGIN_CALLBACK_ONCE_A_SECOND;
       break;
     }
 
@@ -98,6 +98,7 @@ boolean Plugin_091(byte function, struct EventStruct *event, String& string)
         Device[deviceCount].TimerOption = true;
         Device[deviceCount].TimerOptional = true;
         Device[deviceCount].GlobalSyncOption = true;
+        Device[deviceCount].Callbacks = PLUGIN_CALLBACK_WRITE | PLUGIN_CALLBACK_SERIAL_IN;
         break;
       }
     case PLUGIN_GET_DEVICENAME:
@@ -170,6 +170,7 @@ boolean Plugin_092(uint8_t function, struct EventStruct *event, String& string)
         Device[deviceCount].TimerOption = true;
         Device[deviceCount].GlobalSyncOption = true;
         Device[deviceCount].DecimalsOnly = true;
+        Device[deviceCount].Callbacks = PLUGIN_CALLBACK_ONCE_A_SECOND;
         break;
       }
 
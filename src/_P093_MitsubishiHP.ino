@@ -704,6 +704,7 @@ boolean Plugin_093(byte function, struct EventStruct *event, String& string) {
       Device[deviceCount].SendDataOption = true;
       Device[deviceCount].TimerOption = true;
       Device[deviceCount].TimerOptional = true;
+      Device[deviceCount].Callbacks = PLUGIN_CALLBACK_TEN_PER_SECOND | PLUGIN_CALLBACK_WRITE;
       break;
     }
 
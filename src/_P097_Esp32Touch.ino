@@ -54,6 +54,7 @@ boolean Plugin_097(byte function, struct EventStruct *event, String& string)
       Device[deviceCount].DecimalsOnly       = false;
       Device[deviceCount].TimerOption        = false;
       Device[deviceCount].GlobalSyncOption   = true;
+      Device[deviceCount].Callbacks          = PLUGIN_CALLBACK_TEN_PER_SECOND;
       break;
     }
 
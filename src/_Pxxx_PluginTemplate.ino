@@ -99,6 +99,7 @@ boolean Plugin_xxx(byte function, struct EventStruct *event, String& string)
         Device[deviceCount].TimerOptional = false;
         Device[deviceCount].GlobalSyncOption = true;
         Device[deviceCount].DecimalsOnly = true;
+        Device[deviceCount].Callbacks = PLUGIN_CALLBACK_ONCE_A_SECOND | PLUGIN_CALLBACK_TEN_PER_SECOND | PLUGIN_CALLBACK_WRITE; //calls handled by the plugin, must match the cases below
         break;
     }
 
@@ -1,8 +1,10 @@
+#include "src/Globals/Cache.h"
 #include "src/Globals/Device.h"
 #include "src/Globals/GlobalMapPortStatus.h"
 #include "src/Globals/Plugins.h"
 #include "src/Globals/Settings.h"
 
+#include "src/DataStructs/Caches.h"
 #include "src/DataStructs/ESPEasy_EventStruct.h"
 #include "src/DataStructs/TimingStats.h"
 
@@ -1074,6 +1076,7 @@ void PluginInit(void)
       Settings.TaskDeviceEnabled[task] = false;
     }
   }
+  Cache.pluginCallbacks.invalidate();
 
   PluginCall(PLUGIN_INIT_ALL, nullptr, dummy);
   sortDeviceIndexArray(); // Used in device selector dropdown.
@@ -1084,6 +1087,28 @@ void PluginInit(void)
 \*********************************************************************************************/
 byte PluginCall(byte Function, struct EventStruct *event, String& str)
 {
+  switch (Function) {
+    // Calls only sent to tasks handling them, nothing to do when no task does.
+    case PLUGIN_ONCE_A_SECOND:
+    case PLUGIN_TEN_PER_SECOND:
+    case PLUGIN_FIFTY_PER_SECOND:
+    case PLUGIN_CLOCK_IN:
+    case PLUGIN_EVENT_OUT:
+    case PLUGIN_TIME_CHANGE:
+
+      if (Cache.pluginCallbacks.getSubscribers(Function).empty()) {
+        return true;
+      }
+      break;
+    case PLUGIN_SERIAL_IN:
+    case PLUGIN_UDP_IN:
+
+      if (Cache.pluginCallbacks.getSubscribers(Function).empty()) {
+        return false;
+      }
+      break;
+  }
+
   struct EventStruct TempEvent;
 
   if (event == nullptr) {
@@ -1094,7 +1119,7 @@ byte PluginCall(byte Function, struct EventStruct *event, String& str)
   }
 
 
-  checkRAM(F("PluginCall"), Function);
+  checkRAM(RamProbe::PluginCall, Function);
 
   switch (Function)
   {
@@ -1104,6 +1129,11 @@ byte PluginCall(byte Function, struct EventStruct *event, String& str)
 
       for (byte x = 0; x < PLUGIN_MAX; x++) {
         if (validPluginID(DeviceIndex_to_Plugin_id[x])) {
+          if ((Function == PLUGIN_UNCONDITIONAL_POLL) &&
+              !(Device[x].Callbacks & PLUGIN_CALLBACK_UNCONDITIONAL_POLL)) {
+            continue;
+          }
+
           if (Function == PLUGIN_DEVICE_ADD) {
             if ((deviceCount + 2) > static_cast<int>(Device.size())) {
               // Increase with 16 to get some compromise between number of resizes and wasted space
@@ -1147,36 +1177,32 @@ byte PluginCall(byte Function, struct EventStruct *event, String& str)
     case PLUGIN_WRITE:
     case PLUGIN_REQUEST:
     {
-      for (taskIndex_t task = 0; task < TASKS_MAX; task++)
-      {
-        if (Settings.TaskDeviceEnabled[task] && validPluginID_fullcheck(Settings.TaskDeviceNumber[task]))
-        {
-          if (Settings.TaskDeviceDataFeed[task] == 0) // these calls only to tasks with local feed
-          {
-            const deviceIndex_t DeviceIndex = getDeviceIndex_from_TaskIndex(task);
-
-            if (validDeviceIndex(DeviceIndex)) {
-              TempEvent.TaskIndex    = task;
-              TempEvent.BaseVarIndex = task * VARS_PER_TASK;
-              TempEvent.sensorType   = Device[DeviceIndex].VType;
-              checkRAM(F("PluginCall_s"), task);
-              START_TIMER;
-              bool retval = (Plugin_ptr[DeviceIndex](Function, &TempEvent, str));
-              STOP_TIMER_TASK(DeviceIndex, Function);
-              delay(0); // SMY: call delay(0) unconditionally
+      // Iterate by index, as the list may be rebuilt by a nested call.
+      const PluginCallbackTable::SubscriberList& subscribers = Cache.pluginCallbacks.getSubscribers(Function);
+
+      for (size_t i = 0; i < subscribers.size(); ++i) {
+        const taskIndex_t   task        = subscribers[i].taskIndex;
+        const deviceIndex_t DeviceIndex = subscribers[i].deviceIndex;
+        TempEvent.TaskIndex    = task;
+        TempEvent.BaseVarIndex = task * VARS_PER_TASK;
+        TempEvent.sensorType   = Device[DeviceIndex].VType;
+        checkRAM(RamProbe::PluginCall_s, task);
+        START_TIMER;
+        bool retval = (Plugin_ptr[DeviceIndex](Function, &TempEvent, str));
+        STOP_TIMER_TASK(DeviceIndex, Function);
+        delay(0); // SMY: call delay(0) unconditionally
 
-              if (retval) {
-                CPluginCall(CPlugin::Function::CPLUGIN_ACKNOWLEDGE, &TempEvent, str);
-                return true;
-              }
-            }
-          }
+        if (retval) {
+          CPluginCall(CPlugin::Function::CPLUGIN_ACKNOWLEDGE, &TempEvent, str);
+          return true;
         }
       }
 
       // @FIXME TD-er: work-around as long as gpio command is still performed in P001_switch.
+      const uint16_t callbackFlag = PluginCallbackTable::getCallbackFlag(Function);
+
       for (deviceIndex_t deviceIndex = 0; deviceIndex < PLUGIN_MAX; deviceIndex++) {
-        if (validPluginID(DeviceIndex_to_Plugin_id[deviceIndex])) {
+        if (validPluginID(DeviceIndex_to_Plugin_id[deviceIndex]) && (Device[deviceIndex].Callbacks & callbackFlag)) {
           if (Plugin_ptr[deviceIndex](Function, event, str)) {
             delay(0); // SMY: call delay(0) unconditionally
             CPluginCall(CPlugin::Function::CPLUGIN_ACKNOWLEDGE, event, str);
@@ -1191,47 +1217,66 @@ byte PluginCall(byte Function, struct EventStruct *event, String& str)
     case PLUGIN_SERIAL_IN:
     case PLUGIN_UDP_IN:
     {
-      for (taskIndex_t task = 0; task < TASKS_MAX; task++)
-      {
-        if (Settings.TaskDeviceEnabled[task] && validPluginID_fullcheck(Settings.TaskDeviceNumber[task]))
-        {
-          const deviceIndex_t DeviceIndex = getDeviceIndex_from_TaskIndex(task);
+      const PluginCallbackTable::SubscriberList& subscribers = Cache.pluginCallbacks.getSubscribers(Function);
 
-          if (validDeviceIndex(DeviceIndex)) {
-            TempEvent.TaskIndex    = task;
-            TempEvent.BaseVarIndex = task * VARS_PER_TASK;
+      for (size_t i = 0; i < subscribers.size(); ++i) {
+        const taskIndex_t   task        = subscribers[i].taskIndex;
+        const deviceIndex_t DeviceIndex = subscribers[i].deviceIndex;
+        TempEvent.TaskIndex    = task;
+        TempEvent.BaseVarIndex = task * VARS_PER_TASK;
 
-            // TempEvent.idx = Settings.TaskDeviceID[task]; todo check
-            TempEvent.sensorType = Device[DeviceIndex].VType;
-            START_TIMER;
-            bool retval =  (Plugin_ptr[DeviceIndex](Function, &TempEvent, str));
-            STOP_TIMER_TASK(DeviceIndex, Function);
-            delay(0); // SMY: call delay(0) unconditionally
+        // TempEvent.idx = Settings.TaskDeviceID[task]; todo check
+        TempEvent.sensorType = Device[DeviceIndex].VType;
+        START_TIMER;
+        bool retval =  (Plugin_ptr[DeviceIndex](Function, &TempEvent, str));
+        STOP_TIMER_TASK(DeviceIndex, Function);
+        delay(0); // SMY: call delay(0) unconditionally
 
-            if (retval) {
-              checkRAM(F("PluginCallUDP"), task);
-              return true;
-            }
-          }
+        if (retval) {
+          checkRAM(RamProbe::PluginCallUDP, task);
+          return true;
         }
       }
       return false;
       break;
     }
 
-    // Call to all plugins that are used in a task
+    // Call to all plugins that are used in a task and handle the call
     case PLUGIN_ONCE_A_SECOND:
     case PLUGIN_TEN_PER_SECOND:
     case PLUGIN_FIFTY_PER_SECOND:
-    case PLUGIN_INIT_ALL:
     case PLUGIN_CLOCK_IN:
     case PLUGIN_EVENT_OUT:
     case PLUGIN_TIME_CHANGE:
     {
-      if (Function == PLUGIN_INIT_ALL) {
-        Function = PLUGIN_INIT;
+      const PluginCallbackTable::SubscriberList& subscribers = Cache.pluginCallbacks.getSubscribers(Function);
+
+      for (size_t i = 0; i < subscribers.size(); ++i) {
+        const taskIndex_t   task        = subscribers[i].taskIndex;
+        const deviceIndex_t DeviceIndex = subscribers[i].deviceIndex;
+        TempEvent.TaskIndex    = task;
+        TempEvent.BaseVarIndex = task * VARS_PER_TASK;
+
+        // TempEvent.idx = Settings.TaskDeviceID[task]; todo check
+        TempEvent.sensorType      = Device[DeviceIndex].VType;
+        TempEvent.OriginTaskIndex = event->TaskIndex;
+        checkRAM(RamProbe::PluginCall_s, task);
+        START_TIMER;
+        Plugin_ptr[DeviceIndex](Function, &TempEvent, str);
+        STOP_TIMER_TASK(DeviceIndex, Function);
       }
 
+      // These calls are short and frequent, so only yield once after all tasks are called.
+      delay(0);
+      return true;
+      break;
+    }
+
+    // Call to all plugins that are used in a task
+    case PLUGIN_INIT_ALL:
+    {
+      Function = PLUGIN_INIT;
+
       for (taskIndex_t task = 0; task < TASKS_MAX; task++)
       {
         if (Settings.TaskDeviceEnabled[task] && validPluginID_fullcheck(Settings.TaskDeviceNumber[task]))
@@ -1247,12 +1292,10 @@ byte PluginCall(byte Function, struct EventStruct *event, String& str)
               // TempEvent.idx = Settings.TaskDeviceID[task]; todo check
               TempEvent.sensorType      = Device[DeviceIndex].VType;
               TempEvent.OriginTaskIndex = event->TaskIndex;
-              checkRAM(F("PluginCall_s"), task);
+              checkRAM(RamProbe::PluginCall_s, task);
 
-              if (Function == PLUGIN_INIT) {
-                // Schedule the plugin to be read.
-                schedule_task_device_timer_at_init(TempEvent.TaskIndex);
-              }
+              // Schedule the plugin to be read.
+              schedule_task_device_timer_at_init(TempEvent.TaskIndex);
               START_TIMER;
               Plugin_ptr[DeviceIndex](Function, &TempEvent, str);
               STOP_TIMER_TASK(DeviceIndex, Function);
@@ -1293,13 +1336,7 @@ byte PluginCall(byte Function, struct EventStruct *event, String& str)
           LoadTaskSettings(event->TaskIndex);
         }
         event->BaseVarIndex = event->TaskIndex * VARS_PER_TASK;
-        {
-          String descr;
-          descr.reserve(20);
-          descr  = String(F("PluginCall_task_"));
-          descr += event->TaskIndex;
-          checkRAM(descr, String(Function));
-        }
+        checkRAM(RamProbe::PluginCall_task, event->TaskIndex);
         if (Function == PLUGIN_SET_DEFAULTS) {
           for (int i = 0; i < VARS_PER_TASK; ++i) {
             UserVar[event->BaseVarIndex + i] = 0.0;
@@ -1310,7 +1347,7 @@ byte PluginCall(byte Function, struct EventStruct *event, String& str)
 
         if ((retval && (Function == PLUGIN_READ)) 
             || Function == PLUGIN_SET_DEFAULTS) {
-          saveUserVarToRTC();
+          markUserVarDirtyRTC(event->TaskIndex);
         }
 
         if (Function == PLUGIN_GET_DEVICEVALUENAMES) {
@@ -1092,6 +1092,11 @@ To create/register a plugin, you have to :
   #undef USES_TIMING_STATS
 #endif
 
+// Trace of the timed calls can only be read via the timing stats page
+#if defined(USES_TIMING_TRACE) && !defined(USES_TIMING_STATS)
+  #undef USES_TIMING_TRACE
+#endif
+
 
 #ifdef BUILD_NO_DEBUG
   #ifndef BUILD_NO_DIAGNOSTIC_COMMANDS
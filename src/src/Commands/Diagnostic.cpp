@@ -21,6 +21,7 @@
 #include "../DataStructs/PortStatusStruct.h"
 #include "../Globals/GlobalMapPortStatus.h"
 #include "../../ESPEasy_Log.h"
+#include "../Globals/RamTracker.h"
 #include "../Globals/Statistics.h"
 
 #include "../Helpers/ESPEasy_time_calc.h"
@@ -39,7 +40,7 @@ String Command_Lowmem(struct EventStruct *event, const char *Line)
 
   result += lowestRAM;
   result += F(" : ");
-  result += lowestRAMfunction;
+  result += lowestRAMfunction.toString();
   return return_result(event, result);
 }
 
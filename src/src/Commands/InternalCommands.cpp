@@ -352,7 +352,7 @@ bool ExecuteCommand_plugin(taskIndex_t taskIndex, EventValueSource::Enum source,
 
 bool ExecuteCommand(taskIndex_t taskIndex, EventValueSource::Enum source, const char *Line, bool tryPlugin, bool tryInternal, bool tryRemoteConfig)
 {
-  checkRAM(F("ExecuteCommand"));
+  checkRAM(RamProbe::ExecuteCommand);
   String cmd;
 
   if (!GetArgv(Line, cmd, 1)) {
@@ -82,6 +82,7 @@ String Command_Task_ValueSet(struct EventStruct *event, const char *Line)
 
     // FIXME TD-er: The return code of Calculate is not used.
     UserVar[uservarIndex] = result;
+    markUserVarDirtyRTC(taskIndex);
   } else  {
     // TODO: Get Task description and var name
     serialPrintln(String(UserVar[uservarIndex]));
@@ -100,6 +101,7 @@ String Command_Task_ValueToggle(struct EventStruct *event, const char *Line)
 
   if ((result == 0) || (result == 1)) {
     UserVar[uservarIndex] = !result;
+    markUserVarDirtyRTC(taskIndex);
   }
   return return_command_success();
 }
@@ -118,6 +120,7 @@ String Command_Task_ValueSetAndRun(struct EventStruct *event, const char *Line)
     float result = 0;
     Calculate(TmpStr1.c_str(), &result);
     UserVar[uservarIndex] = result;
+    markUserVarDirtyRTC(taskIndex);
     SensorSendTask(taskIndex);
   }
   return return_command_success();
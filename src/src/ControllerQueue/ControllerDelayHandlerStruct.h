@@ -8,22 +8,37 @@
 #include "../Globals/CPlugins.h"
 #include "../Globals/Protocol.h"
 #include "../Helpers/ESPEasy_time_calc.h"
+#include "../ControllerQueue/DelayQueueRing.h"
 
-#include <list>
 
 /*********************************************************************************************\
 * ControllerDelayHandlerStruct
+* T is the queue element type, Queue the storage of the queued elements.
+* The queue capacity is set from the MaxQueueDepth controller setting.
+*
+* When MaxBatchSize is set (and the protocol does not use HTTP), processing waits until that many elements are queued
+* (or BatchFlushDelay has passed) and then sends up to MaxBatchSize elements
+* (limited to CONTROLLER_DELAY_QUEUE_BATCH_BYTES) in a single queue run.
+*
+* While a request is processed asynchronously (see send_via_http), processing is set
+* and the front element stays in the queue until the request is done.
 \*********************************************************************************************/
-template<class T>
+template<class T, class Queue = DelayQueueRing<T> >
 struct ControllerDelayHandlerStruct {
   ControllerDelayHandlerStruct() :
     lastSend(0),
+    batchStart(0),
     minTimeBetweenMessages(CONTROLLER_DELAY_QUEUE_DELAY_DFLT),
     max_queue_depth(CONTROLLER_DELAY_QUEUE_DEPTH_DFLT),
     attempt(0),
     max_retries(CONTROLLER_DELAY_QUEUE_RETRY_DFLT),
+    max_batch_size(0),
+    batch_flush_delay(0),
     delete_oldest(false),
-    must_check_reply(false) {}
+    must_check_reply(false),
+    processing(false) {
+    sendQueue.setCapacity(max_queue_depth);
+  }
 
   void configureControllerSettings(const ControllerSettingsStruct& settings) {
     minTimeBetweenMessages = settings.MinimalTimeBetweenMessages;
@@ -31,6 +46,8 @@ struct ControllerDelayHandlerStruct {
     max_retries            = settings.MaxRetry;
     delete_oldest          = settings.DeleteOldest;
     must_check_reply       = settings.MustCheckReply;
+    max_batch_size         = settings.MaxBatchSize;
+    batch_flush_delay      = settings.BatchFlushDelay;
 
     // Set some sound limits when not configured
     if (max_queue_depth == 0) { max_queue_depth = CONTROLLER_DELAY_QUEUE_DEPTH_DFLT; }
@@ -41,6 +58,15 @@ struct ControllerDelayHandlerStruct {
 
     // No less than 10 msec between messages.
     if (minTimeBetweenMessages < 10) { minTimeBetweenMessages = 10; }
+
+    // A batch can never be larger than the queue.
+    if (max_batch_size > max_queue_depth) { max_batch_size = max_queue_depth; }
+
+    // The front element is in use by an asynchronous request, so leave the capacity
+    // unchanged until the request is done.
+    if (!processing) {
+      sendQueue.setCapacity(max_queue_depth);
+    }
   }
 
   bool readyToProcess(const T& element) const {
@@ -55,7 +81,12 @@ struct ControllerDelayHandlerStruct {
   }
 
   bool queueFull(const T& element) const {
-    if (sendQueue.size() >= max_queue_depth) { return true; }
+    if (!sendQueue.canAdd(element)) { return true; }
+
+    if (!Queue::allocatesPerElement) {
+      // Element is stored in preallocated memory.
+      return false;
+    }
 
     // Number of elements is not exceeding the limit, check memory
     int freeHeap = ESP.getFreeHeap();
@@ -83,19 +114,26 @@ struct ControllerDelayHandlerStruct {
   // Try to add to the queue, if permitted by "delete_oldest"
   // Return false when no item was added.
   bool addToQueue(const T& element) {
-    if (delete_oldest) {
+    if (sendQueue.empty()) {
+      // Flush delay of a batch starts with the first element.
+      batchStart = millis();
+    }
+
+    if (delete_oldest && !processing) {
       // Force add to the queue.
       // If max buffer is reached, the oldest in the queue (first to be served) will be removed.
-      while (queueFull(element)) {
+      // Not while it is being sent, then the new element is dropped when the queue is full.
+      while (queueFull(element) && !sendQueue.empty()) {
         sendQueue.pop_front();
       }
-      sendQueue.emplace_back(element);
-      return true;
-    }
 
-    if (!queueFull(element)) {
-      sendQueue.emplace_back(element);
-      return true;
+      if (sendQueue.push_back(element)) {
+        return true;
+      }
+    } else if (!queueFull(element)) {
+      if (sendQueue.push_back(element)) {
+        return true;
+      }
     }
 #ifndef BUILD_NO_DEBUG
 
@@ -109,17 +147,22 @@ struct ControllerDelayHandlerStruct {
     return false;
   }
 
-  // Get the next element.
   // Remove front element when max_retries is reached.
-  T* getNext() {
-    if (sendQueue.empty()) { return NULL; }
+  // Return false when there is no element to process.
+  bool prepareNext() {
+    if (sendQueue.empty()) { return false; }
 
     if (attempt > max_retries) {
       sendQueue.pop_front();
       attempt = 0;
-
-      if (sendQueue.empty()) { return NULL; }
     }
+    return !sendQueue.empty();
+  }
+
+  // Get the next element.
+  // Remove front element when max_retries is reached.
+  T* getNext() {
+    if (!prepareNext()) { return NULL; }
     return &sendQueue.front();
   }
 
@@ -133,16 +176,56 @@ struct ControllerDelayHandlerStruct {
       sendQueue.pop_front();
       attempt = 0;
       lastSend = millis();
+
+      // Remaining elements will be sent as part of the next batch.
+      batchStart = lastSend;
     } else {
       ++attempt;
     }
     return getNextScheduleTime();
   }
 
+  // Protocols sending each element as a separate HTTP request (usesHTTP) do not batch.
+  bool batchEnabled() const {
+    if ((max_batch_size <= 1) || sendQueue.empty()) { return false; }
+    const protocolIndex_t protocolIndex = getProtocolIndex_from_ControllerIndex(sendQueue.front().controller_idx);
+    return protocolIndex != INVALID_PROTOCOL_INDEX && !Protocol[protocolIndex].usesHTTP;
+  }
+
+  // Return true when enough elements are queued to send a batch,
+  // or the oldest element waited long enough.
+  bool batchReady() const {
+    if (!batchEnabled()) { return true; }
+
+    if (sendQueue.size() >= max_batch_size) { return true; }
+    return timePassedSince(batchStart) >= static_cast<long>(batch_flush_delay);
+  }
+
+  // Return true when the next element may be sent in the same queue run.
+  // @param controller_idx  Controller of the first element of the batch, as its settings are loaded.
+  // @param nrProcessed     Number of elements processed in this queue run.
+  // @param bytesProcessed  Size of the elements processed in this queue run.
+  bool continueBatch(const T *element, controllerIndex_t controller_idx, unsigned int nrProcessed, size_t bytesProcessed) const {
+    if ((element == NULL) || !batchEnabled() || (attempt != 0)) { return false; }
+
+    if (element->controller_idx != controller_idx) { return false; }
+
+    if (nrProcessed >= max_batch_size) { return false; }
+    return (bytesProcessed + element->getSize()) <= CONTROLLER_DELAY_QUEUE_BATCH_BYTES;
+  }
+
   unsigned long getNextScheduleTime() const {
     if (sendQueue.empty()) { return 0; }
     unsigned long nextTime = lastSend + minTimeBetweenMessages;
 
+    if (!batchReady()) {
+      const unsigned long flushTime = batchStart + batch_flush_delay;
+
+      if (timeDiff(nextTime, flushTime) > 0) {
+        nextTime = flushTime;
+      }
+    }
+
     if (timePassedSince(nextTime) > 0) {
       nextTime = millis();
     }
@@ -153,22 +236,21 @@ struct ControllerDelayHandlerStruct {
   }
 
   size_t getQueueMemorySize() const {
-    size_t totalSize = 0;
-
-    for (auto it = sendQueue.begin(); it != sendQueue.end(); ++it) {
-      totalSize += it->getSize();
-    }
-    return totalSize;
+    return sendQueue.getMemorySize();
   }
 
-  std::list<T>  sendQueue;
+  Queue         sendQueue;
   unsigned long lastSend;
+  unsigned long batchStart;
   unsigned int  minTimeBetweenMessages;
   byte          max_queue_depth;
   byte          attempt;
   byte          max_retries;
+  byte          max_batch_size;
+  unsigned int  batch_flush_delay;
   bool          delete_oldest;
   bool          must_check_reply;
+  bool          processing; // Front element is being sent asynchronously
 };
 
 
@@ -195,26 +277,56 @@ struct ControllerDelayHandlerStruct {
 // N.B. some controllers only can send one value per iteration, so a returned "false" can mean it
 //      was still successful. The controller should keep track of the last value sent
 //      in the element stored in the queue.
-#define DEFINE_Cxxx_DELAY_QUEUE_MACRO(NNN, M)                                                                        \
-  bool do_process_c##NNN####M##_delay_queue(int controller_number,                                                   \
-                                           const C##NNN####M##_queue_element & element,                              \
-                                           ControllerSettingsStruct & ControllerSettings);                           \
-  ControllerDelayHandlerStruct<C##NNN####M##_queue_element>C##NNN####M##_DelayHandler;                               \
-  void process_c##NNN####M##_delay_queue();                                                                          \
-  void process_c##NNN####M##_delay_queue() {                                                                         \
-    C##NNN####M##_queue_element *element(C##NNN####M##_DelayHandler.getNext());                                      \
-    if (element == NULL) return;                                                                                     \
-    MakeControllerSettings (ControllerSettings);                                                                     \
-    LoadControllerSettings(element->controller_idx, ControllerSettings);                                             \
-    C##NNN####M##_DelayHandler.configureControllerSettings(ControllerSettings);                                      \
-    if (!C##NNN####M##_DelayHandler.readyToProcess(*element)) {                                                      \
-      scheduleNextDelayQueue(TIMER_C##NNN####M##_DELAY_QUEUE, C##NNN####M##_DelayHandler.getNextScheduleTime());     \
-      return;                                                                                                        \
-    }                                                                                                                \
-    START_TIMER;                                                                                                     \
-    C##NNN####M##_DelayHandler.markProcessed(do_process_c##NNN####M##_delay_queue(M, *element, ControllerSettings)); \
-    STOP_TIMER(C##NNN####M##_DELAY_QUEUE);                                                                           \
-    scheduleNextDelayQueue(TIMER_C##NNN####M##_DELAY_QUEUE, C##NNN####M##_DelayHandler.getNextScheduleTime());       \
+// When batching is enabled, up to MaxBatchSize elements are processed in one run.
+// The batch stops at the first element which could not be marked 'Processed'.
+// When do_process_cXXX_delay_queue started an asynchronous HTTP request, the element is not marked
+// and the request is polled every CONTROLLER_DELAY_QUEUE_POLL_INTERVAL msec, without loading the controller settings
+// or blocking the main loop.
+// When it is done, do_process_cXXX_delay_queue is called again for the same element to collect the result.
+// The controller settings are applied before a pointer to the element is taken, as they may change the queue capacity
+// (never while processing).
+#define DEFINE_Cxxx_DELAY_QUEUE_MACRO(NNN, M)                                                                         \
+  bool do_process_c##NNN####M##_delay_queue(int controller_number,                                                    \
+                                           const C##NNN####M##_queue_element & element,                               \
+                                           ControllerSettingsStruct & ControllerSettings);                            \
+  ControllerDelayHandlerStruct<C##NNN####M##_queue_element>C##NNN####M##_DelayHandler;                                \
+  void process_c##NNN####M##_delay_queue();                                                                           \
+  void process_c##NNN####M##_delay_queue() {                                                                          \
+    if (C##NNN####M##_DelayHandler.processing && poll_controller_http_request(M)) {                                   \
+      scheduleNextDelayQueue(TIMER_C##NNN####M##_DELAY_QUEUE, millis() + CONTROLLER_DELAY_QUEUE_POLL_INTERVAL);       \
+      return;                                                                                                         \
+    }                                                                                                                 \
+    if (!C##NNN####M##_DelayHandler.prepareNext()) return;                                                            \
+    MakeControllerSettings (ControllerSettings);                                                                      \
+    LoadControllerSettings(C##NNN####M##_DelayHandler.sendQueue.front().controller_idx, ControllerSettings);          \
+    C##NNN####M##_DelayHandler.configureControllerSettings(ControllerSettings);                                       \
+    C##NNN####M##_queue_element *element(&C##NNN####M##_DelayHandler.sendQueue.front());                              \
+    if (!C##NNN####M##_DelayHandler.processing &&                                                                     \
+        (!C##NNN####M##_DelayHandler.readyToProcess(*element) ||                                                      \
+         !C##NNN####M##_DelayHandler.batchReady())) {                                                                 \
+      scheduleNextDelayQueue(TIMER_C##NNN####M##_DELAY_QUEUE, C##NNN####M##_DelayHandler.getNextScheduleTime());      \
+      return;                                                                                                         \
+    }                                                                                                                 \
+    const controllerIndex_t controller_idx = element->controller_idx;                                                 \
+    unsigned int nrProcessed = 0;                                                                                     \
+    size_t bytesProcessed = 0;                                                                                        \
+    do {                                                                                                              \
+      START_TIMER;                                                                                                    \
+      const bool processed = do_process_c##NNN####M##_delay_queue(M, *element, ControllerSettings);                   \
+      C##NNN####M##_DelayHandler.processing = controller_http_request_busy(M);                                        \
+      if (!C##NNN####M##_DelayHandler.processing) {                                                                   \
+        ++nrProcessed;                                                                                                \
+        bytesProcessed += element->getSize();                                                                         \
+        C##NNN####M##_DelayHandler.markProcessed(processed);                                                          \
+      }                                                                                                               \
+      STOP_TIMER(C##NNN####M##_DELAY_QUEUE);                                                                          \
+      if (C##NNN####M##_DelayHandler.processing) {                                                                    \
+        scheduleNextDelayQueue(TIMER_C##NNN####M##_DELAY_QUEUE, millis() + CONTROLLER_DELAY_QUEUE_POLL_INTERVAL);     \
+        return;                                                                                                       \
+      }                                                                                                               \
+      element = C##NNN####M##_DelayHandler.getNext();                                                                 \
+    } while (C##NNN####M##_DelayHandler.continueBatch(element, controller_idx, nrProcessed, bytesProcessed));         \
+    scheduleNextDelayQueue(TIMER_C##NNN####M##_DELAY_QUEUE, C##NNN####M##_DelayHandler.getNextScheduleTime());        \
   }
 
 // Uncrustify must not be used on macros, but we're now done, so turn Uncrustify on again.
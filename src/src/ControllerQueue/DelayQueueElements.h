@@ -4,6 +4,7 @@
 #include "../../ESPEasy_common.h"
 #include "../DataStructs/ControllerSettingsStruct.h"
 #include "../../ESPEasy_fdwdecl.h"
+#include "../../_CPlugin_Helper.h"
 
 #include "../ControllerQueue/ControllerDelayHandlerStruct.h"
 #include "../ControllerQueue/SimpleQueueElement_string_only.h"
@@ -27,8 +28,8 @@
 
 
 #ifdef USES_MQTT
-# include "../ControllerQueue/MQTT_queue_element.h"
-ControllerDelayHandlerStruct<MQTT_queue_element> MQTTDelayHandler;
+# include "../ControllerQueue/MQTT_queue_arena.h"
+ControllerDelayHandlerStruct<MQTT_queue_element, MQTT_queue_arena> MQTTDelayHandler;
 #endif // USES_MQTT
 
 
@@ -0,0 +1,109 @@
+#ifndef CONTROLLERQUEUE_DELAY_QUEUE_RING_H
+#define CONTROLLERQUEUE_DELAY_QUEUE_RING_H
+
+#include <stddef.h>
+#include <vector>
+
+/*********************************************************************************************\
+* DelayQueueRing
+*
+* Fixed capacity FIFO, used as storage of the controller delay queues.
+* The slots are allocated once on the first push, so adding and removing elements
+* does not allocate or free list nodes.
+* Queued elements are never moved or removed by a change of capacity, so a reference
+* to the front element stays valid until pop_front().
+* The total size of the queued elements is kept up to date, so getMemorySize() is constant time.
+\*********************************************************************************************/
+template<class T>
+class DelayQueueRing {
+public:
+
+  // Elements may own heap memory (e.g. String members), so the free heap must be checked on add.
+  static const bool allocatesPerElement = true;
+
+  // Set the max. number of elements.
+  // The slots are only resized when the queue is empty.
+  // Until then no elements can be added beyond the current slots or the new capacity.
+  void setCapacity(size_t capacity) {
+    _capacity = capacity;
+
+    if (_count == 0) {
+      releaseSlots();
+    }
+  }
+
+  // The element is not needed, all elements use a single slot.
+  bool canAdd(const T&) const {
+    if (_count >= _capacity) { return false; }
+    return _slots.empty() || _count < _slots.size();
+  }
+
+  // Return false when the queue is full.
+  bool push_back(const T& element) {
+    if (!canAdd(element)) { return false; }
+
+    if (_slots.empty()) {
+      _slots.resize(_capacity);
+    }
+    _slots[(_head + _count) % _slots.size()] = element;
+    ++_count;
+    _memorySize += element.getSize();
+    return true;
+  }
+
+  // Only allowed when not empty.
+  T& front() {
+    return _slots[_head];
+  }
+
+  const T& front() const {
+    return _slots[_head];
+  }
+
+  void pop_front() {
+    if (_count == 0) { return; }
+    const size_t elementSize = _slots[_head].getSize();
+    _memorySize = (elementSize < _memorySize) ? _memorySize - elementSize : 0;
+
+    // Release any memory held by the element.
+    _slots[_head] = T();
+    _head         = (_head + 1) % _slots.size();
+    --_count;
+
+    if (_count == 0) {
+      releaseSlots();
+    }
+  }
+
+  bool empty() const {
+    return _count == 0;
+  }
+
+  size_t size() const {
+    return _count;
+  }
+
+  size_t getMemorySize() const {
+    return _memorySize;
+  }
+
+private:
+
+  // Free the slots when their number differs from the capacity, they will be allocated on the next push.
+  // Only allowed when empty.
+  void releaseSlots() {
+    _head = 0;
+
+    if (!_slots.empty() && (_slots.size() != _capacity)) {
+      std::vector<T>().swap(_slots);
+    }
+  }
+
+  std::vector<T>_slots;
+  size_t _capacity   = 0;
+  size_t _head       = 0;
+  size_t _count      = 0;
+  size_t _memorySize = 0;
+};
+
+#endif // CONTROLLERQUEUE_DELAY_QUEUE_RING_H
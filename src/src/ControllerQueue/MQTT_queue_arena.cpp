@@ -0,0 +1,132 @@
+#include "../ControllerQueue/MQTT_queue_arena.h"
+
+void MQTT_queue_arena::setCapacity(size_t capacity)
+{
+  size_t arenaSize = capacity * MQTT_QUEUE_ARENA_BYTES_PER_ELEMENT;
+
+  if (arenaSize < MQTT_MAX_PACKET_SIZE) {
+    arenaSize = MQTT_MAX_PACKET_SIZE;
+  }
+
+  if (arenaSize > 0xFFFF) {
+    // Offsets are stored as uint16_t
+    arenaSize = 0xFFFF;
+  }
+
+  _arenaSize = arenaSize;
+  _entries.setCapacity(capacity);
+
+  if (_entries.empty()) {
+    releaseArena();
+  }
+}
+
+bool MQTT_queue_arena::canAdd(const MQTT_queue_element& element) const
+{
+  if (!_entries.canAdd(Entry())) {
+    return false;
+  }
+  const size_t length = getLength(element);
+
+  if (_arena.empty()) {
+    return length <= _arenaSize;
+  }
+  return findSpace(length) >= 0;
+}
+
+bool MQTT_queue_arena::push_back(const MQTT_queue_element& element)
+{
+  if (!canAdd(element)) {
+    return false;
+  }
+
+  if (_arena.empty()) {
+    _arena.resize(_arenaSize);
+  }
+  Entry entry;
+  entry.length         = getLength(element);
+  entry.topicLength    = strlen(element._topic);
+  entry.offset         = findSpace(entry.length);
+  entry.controller_idx = element.controller_idx;
+  entry.retained       = element._retained;
+
+  char *pos = &_arena[entry.offset];
+  memcpy(pos, element._topic, entry.topicLength + 1);
+  memcpy(pos + entry.topicLength + 1, element._payload, entry.length - entry.topicLength - 1);
+
+  _entries.push_back(entry);
+  _tail = entry.offset + entry.length;
+  return true;
+}
+
+MQTT_queue_element& MQTT_queue_arena::front()
+{
+  const Entry& entry = _entries.front();
+
+  _front = MQTT_queue_element(
+    entry.controller_idx,
+    &_arena[entry.offset],
+    &_arena[entry.offset + entry.topicLength + 1],
+    entry.retained);
+  return _front;
+}
+
+void MQTT_queue_arena::pop_front()
+{
+  _entries.pop_front();
+
+  if (_entries.empty()) {
+    _tail = 0;
+    releaseArena();
+  }
+}
+
+bool MQTT_queue_arena::empty() const
+{
+  return _entries.empty();
+}
+
+size_t MQTT_queue_arena::size() const
+{
+  return _entries.size();
+}
+
+size_t MQTT_queue_arena::getMemorySize() const
+{
+  // The messages are stored in the arena, which is allocated at full size.
+  return _arena.size() + _entries.size() * sizeof(Entry);
+}
+
+size_t MQTT_queue_arena::getLength(const MQTT_queue_element& element)
+{
+  return strlen(element._topic) + strlen(element._payload) + 2;
+}
+
+void MQTT_queue_arena::releaseArena()
+{
+  if (!_arena.empty() && (_arena.size() != _arenaSize)) {
+    std::vector<char>().swap(_arena);
+  }
+}
+
+int MQTT_queue_arena::findSpace(size_t length) const
+{
+  const size_t arenaSize = _arena.size();
+
+  if (_entries.empty()) {
+    return (length <= arenaSize) ? 0 : -1;
+  }
+  const size_t head = _entries.front().offset;
+
+  if (_tail > head) {
+    // Not wrapped, free space at the end and at the start of the arena.
+    if (length <= (arenaSize - _tail)) { return _tail; }
+
+    if (length <= head) { return 0; }
+    return -1;
+  }
+
+  // Wrapped, free space is between the last and the first message.
+  if (length <= (head - _tail)) { return _tail; }
+  return -1;
+}
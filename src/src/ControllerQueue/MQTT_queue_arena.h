@@ -0,0 +1,86 @@
+#ifndef CONTROLLERQUEUE_MQTT_QUEUE_ARENA_H
+#define CONTROLLERQUEUE_MQTT_QUEUE_ARENA_H
+
+#include "../../ESPEasy_common.h"
+#include "../ControllerQueue/DelayQueueRing.h"
+#include "../ControllerQueue/MQTT_queue_element.h"
+
+#include <vector>
+
+#ifndef MQTT_QUEUE_ARENA_BYTES_PER_ELEMENT
+# ifdef ESP32
+#  define MQTT_QUEUE_ARENA_BYTES_PER_ELEMENT  128
+# else // ifdef ESP32
+#  define MQTT_QUEUE_ARENA_BYTES_PER_ELEMENT  64
+# endif // ifdef ESP32
+#endif // ifndef MQTT_QUEUE_ARENA_BYTES_PER_ELEMENT
+
+
+/*********************************************************************************************\
+* MQTT_queue_arena
+*
+* Storage of the MQTT delay queue.
+* Topic and payload of all queued messages are stored in a single byte arena, used as ring buffer.
+* The arena is sized from the max. queue depth, but is at least MQTT_MAX_PACKET_SIZE,
+* so any message which can be published will fit in an empty queue.
+* The arena is allocated on the first message, adding and removing messages does not allocate.
+\*********************************************************************************************/
+class MQTT_queue_arena {
+public:
+
+  // Messages are stored in the preallocated arena.
+  static const bool allocatesPerElement = false;
+
+  // Set the max. number of messages.
+  // The arena is only resized when the queue is empty, queued messages are never moved.
+  void                setCapacity(size_t capacity);
+
+  bool                canAdd(const MQTT_queue_element& element) const;
+
+  // Copy topic and payload into the arena.
+  // Return false when there is no room.
+  bool                push_back(const MQTT_queue_element& element);
+
+  // Only allowed when not empty.
+  // The returned element is valid until the message is removed from the queue.
+  MQTT_queue_element& front();
+
+  void                pop_front();
+
+  bool                empty() const;
+
+  size_t              size() const;
+
+  size_t              getMemorySize() const;
+
+private:
+
+  struct Entry {
+    size_t getSize() const {
+      return length;
+    }
+
+    uint16_t offset                  = 0;
+    uint16_t topicLength             = 0;
+    uint16_t length                  = 0; // topic + payload, including 0-terminators
+    controllerIndex_t controller_idx = 0;
+    bool retained                    = false;
+  };
+
+  static size_t getLength(const MQTT_queue_element& element);
+
+  // Free the arena when its size differs from the configured size, it will be allocated on the next message.
+  // Only allowed when empty.
+  void releaseArena();
+
+  // Offset in the arena where a message of given length can be stored, or -1 when there is no room.
+  int findSpace(size_t length) const;
+
+  DelayQueueRing<Entry>_entries;
+  std::vector<char>_arena;
+  size_t _arenaSize = 0;
+  size_t _tail      = 0; // End of the last added message
+  MQTT_queue_element _front;
+};
+
+#endif // CONTROLLERQUEUE_MQTT_QUEUE_ARENA_H
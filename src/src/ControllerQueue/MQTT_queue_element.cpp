@@ -5,10 +5,10 @@
 MQTT_queue_element::MQTT_queue_element() {}
 
 MQTT_queue_element::MQTT_queue_element(int ctrl_idx,
-                                       const String& topic, const String& payload, bool retained) :
+                                       const char *topic, const char *payload, bool retained) :
   _topic(topic), _payload(payload), controller_idx(ctrl_idx), _retained(retained)
 {}
 
 size_t MQTT_queue_element::getSize() const {
-  return sizeof(*this) + _topic.length() + _payload.length();
+  return sizeof(*this) + strlen(_topic) + strlen(_payload);
 }
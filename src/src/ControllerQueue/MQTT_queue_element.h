@@ -7,21 +7,25 @@
 
 /*********************************************************************************************\
 * MQTT_queue_element for all MQTT base controllers
+*
+* Does not own the topic and payload.
+* When added to the queue, topic and payload are copied into the byte arena of the MQTT_queue_arena.
+* The element returned by the queue points into that arena and is valid until it is removed from the queue.
 \*********************************************************************************************/
 class MQTT_queue_element {
 public:
 
   MQTT_queue_element();
 
-  MQTT_queue_element(int           ctrl_idx,
-                     const String& topic,
-                     const String& payload,
-                     bool          retained);
+  MQTT_queue_element(int         ctrl_idx,
+                     const char *topic,
+                     const char *payload,
+                     bool        retained);
 
   size_t getSize() const;
 
-  String _topic;
-  String _payload;
+  const char *_topic               = "";
+  const char *_payload             = "";
   controllerIndex_t controller_idx = INVALID_CONTROLLER_INDEX;
   bool _retained                   = false;
 };
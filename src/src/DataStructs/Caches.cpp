@@ -4,6 +4,10 @@ void Caches::clearAllCaches()
 {
   taskIndexName.clear();
   taskIndexValueName.clear();
+  taskFormulaPrograms.clear();
+  templatePlans.clear();
+  extraTaskSettings.clear();
+  pluginCallbacks.invalidate();
 
 
 }
\ No newline at end of file
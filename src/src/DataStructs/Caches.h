@@ -4,9 +4,14 @@
 #include <map>
 #include "../../ESPEasy_common.h"
 #include "../Globals/Plugins.h"
+#include "../DataStructs/ExtraTaskSettingsCache.h"
+#include "../DataStructs/PluginCallbackTable.h"
+#include "../DataStructs/TaskFormulaPrograms.h"
+#include "../DataStructs/TemplatePlan.h"
 
 typedef std::map<String, taskIndex_t> TaskIndexNameMap;
 typedef std::map<String, byte> TaskIndexValueNameMap;
+typedef std::map<taskIndex_t, TaskFormulaPrograms> TaskFormulaProgramsMap;
 
 struct Caches {
   void clearAllCaches();
@@ -14,6 +19,10 @@ struct Caches {
 
   TaskIndexNameMap taskIndexName;
   TaskIndexValueNameMap taskIndexValueName;
+  TaskFormulaProgramsMap taskFormulaPrograms;
+  TemplatePlanCache templatePlans;
+  ExtraTaskSettingsCache extraTaskSettings;
+  PluginCallbackTable pluginCallbacks;
 };
 
 
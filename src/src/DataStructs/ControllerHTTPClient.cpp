@@ -0,0 +1,303 @@
+#include "../DataStructs/ControllerHTTPClient.h"
+
+#include "../../_CPlugin_Helper.h"
+#include "../../ESPEasy_Log.h"
+#include "../DataStructs/ControllerSettingsStruct.h"
+#include "../Helpers/ESPEasy_time_calc.h"
+
+bool ControllerHTTPClient::canReuse(const String& newHostPort) {
+  if (!client.connected() || !hostPort.equals(newHostPort)) {
+    return false;
+  }
+
+  // Left over data of a previous reply means the connection is out of sync.
+  return client.available() == 0;
+}
+
+void ControllerHTTPClient::stop() {
+  client.stop();
+  hostPort = String();
+}
+
+void ControllerHTTPClient::begin(const String& postStr, bool must_check_reply) {
+  request        = postStr;
+  mustCheckReply = must_check_reply;
+  success        = false;
+  keepAlive      = true;
+  retried        = false;
+  setState(State::Connecting);
+}
+
+bool ControllerHTTPClient::busy() const {
+  return state != State::Idle && state != State::Done;
+}
+
+bool ControllerHTTPClient::poll(int controller_number) {
+  switch (state) {
+    case State::Sending:
+      send(controller_number);
+      break;
+    case State::AwaitingStatus:
+    case State::ReadingHeaders:
+    case State::Draining:
+      readReply(controller_number);
+      break;
+    case State::Idle:
+    case State::Connecting:
+    case State::Done:
+      break;
+  }
+  return busy() && state != State::Connecting;
+}
+
+bool ControllerHTTPClient::collect() {
+  const bool result = success;
+
+  state = State::Idle;
+  return result;
+}
+
+bool ControllerHTTPClient::open(int controller_number, ControllerSettingsStruct& ControllerSettings) {
+  const String newHostPort = ControllerSettings.getHostPortString();
+
+  if (canReuse(newHostPort)) {
+    return true;
+  }
+  stop();
+
+  if (!try_connect_host(controller_number, client, ControllerSettings)) {
+    return false;
+  }
+  hostPort = newHostPort;
+  ++connects;
+  return true;
+}
+
+void ControllerHTTPClient::connect(int controller_number, ControllerSettingsStruct& ControllerSettings) {
+  reused = canReuse(ControllerSettings.getHostPortString());
+
+  if (!open(controller_number, ControllerSettings)) {
+    keepAlive = false;
+    finish(false);
+    return;
+  }
+
+  if (reused) {
+    ++reuses;
+  }
+  success = false;
+  sent    = 0;
+  setState(State::Sending);
+}
+
+void ControllerHTTPClient::send(int controller_number) {
+  if (!client.connected()) {
+    if (!retry()) {
+      keepAlive = false;
+      finish(false);
+    }
+    return;
+  }
+  size_t chunk = request.length() - sent;
+
+  if (chunk > CONTROLLER_HTTP_WRITE_CHUNK) {
+    chunk = CONTROLLER_HTTP_WRITE_CHUNK;
+  }
+  const size_t written = client.write(reinterpret_cast<const uint8_t *>(request.c_str()) + sent, chunk);
+
+  if (written == 0) {
+    if (timeOutReached(timer)) {
+      if (retry()) {
+        // Reused connection does not accept data, it may be closed by the server.
+        return;
+      }
+
+      if (loglevelActiveFor(LOG_LEVEL_ERROR)) {
+        String log = F("HTTP : ");
+        log += get_formatted_Controller_number(controller_number);
+        log += F(" Error: could not write to client (");
+        log += sent;
+        log += '/';
+        log += request.length();
+        log += ')';
+        addLog(LOG_LEVEL_ERROR, log);
+      }
+      keepAlive = false;
+      finish(false);
+    }
+    return;
+  }
+  sent += written;
+
+  if (sent < request.length()) {
+    setState(State::Sending);
+    return;
+  }
+#ifndef BUILD_NO_DEBUG
+
+  if (loglevelActiveFor(LOG_LEVEL_DEBUG)) {
+    String log = F("HTTP : ");
+    log += get_formatted_Controller_number(controller_number);
+    log += F(" written to client (");
+    log += sent;
+    log += F(" bytes)");
+    addLog(LOG_LEVEL_DEBUG, log);
+  }
+#endif // ifndef BUILD_NO_DEBUG
+  line          = String();
+  contentLength = -1;
+
+  // Without checking the reply, a request written to a new connection is considered sent.
+  // Via a reused connection the server may already have closed it, which only shows when
+  // no reply is received. So then wait for the status line before reporting success.
+  if (!mustCheckReply && !reused) {
+    success = true;
+  }
+  setState(State::AwaitingStatus);
+}
+
+void ControllerHTTPClient::readReply(int controller_number) {
+  while (busy() && client.available()) {
+    if (state == State::Draining) {
+      uint8_t buf[64];
+      size_t  toRead = contentLength;
+
+      if (toRead > sizeof(buf)) {
+        toRead = sizeof(buf);
+      }
+      const int nrRead = client.read(buf, toRead);
+
+      if (nrRead <= 0) {
+        break;
+      }
+      contentLength -= nrRead;
+    } else {
+      const int c = client.read();
+
+      if (c < 0) {
+        break;
+      }
+
+      if (c == '\n') {
+        line.trim();
+        handleLine(controller_number);
+        line = String();
+      } else if (line.length() < 128) {
+        // Only the start of a line is needed
+        line += static_cast<char>(c);
+      }
+    }
+
+    if ((state == State::Draining) && (contentLength <= 0)) {
+      finish(success);
+    }
+  }
+
+  if (!busy() || client.available()) {
+    return;
+  }
+
+  if (!client.connected()) {
+    if ((state == State::AwaitingStatus) && (line.length() == 0)) {
+      // Server closed a reused connection before sending a reply.
+      if (retry()) {
+        return;
+      }
+
+      if (!success && loglevelActiveFor(LOG_LEVEL_ERROR)) {
+        String log = F("HTTP : ");
+        log += get_formatted_Controller_number(controller_number);
+        log += F(" Error: connection closed without reply");
+        addLog(LOG_LEVEL_ERROR, log);
+      }
+    }
+    keepAlive = false;
+    finish(success);
+  } else if (timeOutReached(timer)) {
+    keepAlive = false;
+    finish(success);
+  }
+}
+
+void ControllerHTTPClient::handleLine(int controller_number) {
+#ifndef BUILD_NO_DEBUG
+
+  if (loglevelActiveFor(LOG_LEVEL_DEBUG_MORE)) {
+    addLog(LOG_LEVEL_DEBUG_MORE, line);
+  }
+#endif // ifndef BUILD_NO_DEBUG
+
+  if (state == State::AwaitingStatus) {
+    // Status line, e.g. "HTTP/1.1 200 OK"
+    if (!line.startsWith(F("HTTP/1.1"))) {
+      keepAlive = false;
+    }
+
+    // Any reply shows the request was received, which is enough when the reply is not checked.
+    if (check_http_status_line(get_formatted_Controller_number(controller_number), line, request) || !mustCheckReply) {
+      success = true;
+    }
+
+    if (!line.startsWith(F("HTTP/1."))) {
+      finish(success);
+      return;
+    }
+    setState(State::ReadingHeaders);
+    return;
+  }
+
+  if (line.length() == 0) {
+    // End of the headers, the connection can only be reused when the length of the content is known.
+    if ((contentLength < 0) || !keepAlive) {
+      keepAlive = false;
+      finish(success);
+    } else if (contentLength == 0) {
+      finish(success);
+    } else {
+      setState(State::Draining);
+    }
+    return;
+  }
+  line.toLowerCase();
+
+  if (line.startsWith(F("content-length:"))) {
+    contentLength = line.substring(15).toInt();
+  } else if (line.startsWith(F("connection:")) && (line.indexOf(F("close")) > 0)) {
+    keepAlive = false;
+  } else if (line.startsWith(F("transfer-encoding:"))) {
+    keepAlive = false;
+  }
+}
+
+bool ControllerHTTPClient::retry() {
+  if (!reused || retried) {
+    return false;
+  }
+#ifndef BUILD_NO_DEBUG
+
+  if (loglevelActiveFor(LOG_LEVEL_DEBUG)) {
+    addLog(LOG_LEVEL_DEBUG, F("HTTP : Reused connection closed, retry with a new connection"));
+  }
+#endif // ifndef BUILD_NO_DEBUG
+  retried = true;
+  success = false;
+  stop();
+  setState(State::Connecting);
+  return true;
+}
+
+void ControllerHTTPClient::finish(bool result) {
+  success = result;
+
+  if (!keepAlive) {
+    stop();
+  }
+  request = String();
+  line    = String();
+  setState(State::Done);
+}
+
+void ControllerHTTPClient::setState(State newState) {
+  state = newState;
+  timer = millis() + CONTROLLER_HTTP_REQUEST_TIMEOUT;
+}
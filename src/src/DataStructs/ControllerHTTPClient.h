@@ -0,0 +1,109 @@
+#ifndef DATASTRUCTS_CONTROLLERHTTPCLIENT_H
+#define DATASTRUCTS_CONTROLLERHTTPCLIENT_H
+
+#include "../../ESPEasy_common.h"
+
+#include <WiFiClient.h>
+
+struct ControllerSettingsStruct;
+
+// Max. time in msec to wait for the next step of a request (connected, written, reply received).
+// Waiting does not block the main loop, so it can be longer than the client timeout.
+#ifndef CONTROLLER_HTTP_REQUEST_TIMEOUT
+# define CONTROLLER_HTTP_REQUEST_TIMEOUT  2000
+#endif // ifndef CONTROLLER_HTTP_REQUEST_TIMEOUT
+
+// Max. number of bytes written to the client per poll.
+#ifndef CONTROLLER_HTTP_WRITE_CHUNK
+# define CONTROLLER_HTTP_WRITE_CHUNK      256
+#endif // ifndef CONTROLLER_HTTP_WRITE_CHUNK
+
+/*********************************************************************************************\
+* ControllerHTTPClient
+*
+* Persistent connection of a HTTP based controller.
+* The connection is kept open after a request when the server allows it (HTTP/1.1 keep-alive)
+* and reused for the next queue element, to save the TCP handshake and DNS lookup.
+*
+* A request is processed asynchronously: begin() only stores the request, connect() opens the
+* connection and every call to poll() performs a single step, without waiting for the server.
+* Idle -> Connecting -> Sending -> AwaitingStatus -> ReadingHeaders -> Draining -> Done
+* Only connect() needs the controller settings, so the settings do not have to be loaded to poll.
+*
+* The server may close a kept open connection at any time. A request sent via a reused connection
+* is therefore only successful when a reply is received, also when the reply is not checked.
+* When the connection turns out to be closed, the request is sent once more via a new connection.
+\*********************************************************************************************/
+struct ControllerHTTPClient {
+  enum class State : uint8_t {
+    Idle,           // No request in progress
+    Connecting,     // Connect to the host, unless the open connection can be reused
+    Sending,        // Write the request
+    AwaitingStatus, // Wait for the status line of the reply
+    ReadingHeaders, // Read the headers of the reply
+    Draining,       // Skip the content of the reply
+    Done            // Result can be collected
+  };
+
+  // Connection is open to the given host and can be used for a new request.
+  bool canReuse(const String& newHostPort);
+
+  void stop();
+
+  // Start a new request, continued by connect() and then by calling poll() until it is done.
+  void begin(const String& postStr, bool must_check_reply);
+
+  bool busy() const;
+
+  // Connect to the host (state Connecting), unless the open connection can be reused.
+  void connect(int controller_number, ControllerSettingsStruct& ControllerSettings);
+
+  // Perform the next step of the request.
+  // Return true while the request is waiting for the server.
+  // Return false when done, or when connect() must be called (again).
+  bool poll(int controller_number);
+
+  // Return the result of a finished request and make the client available for a new request.
+  bool collect();
+
+  // Open the connection, unless it is still open to the same host.
+  bool open(int controller_number, ControllerSettingsStruct& ControllerSettings);
+
+  WiFiClient client;
+  String     hostPort; // Host and port of the open connection
+
+  // Number of new connections and number of requests sent via an already open connection.
+  uint32_t connects = 0;
+  uint32_t reuses   = 0;
+
+  State state = State::Idle;
+
+private:
+
+  void send(int controller_number);
+
+  void readReply(int controller_number);
+
+  void handleLine(int controller_number);
+
+  // Retry once with a new connection, when the server closed the reused connection.
+  // Return false when the request was not sent via a reused connection, or already retried.
+  bool retry();
+
+  void finish(bool success);
+
+  void setState(State newState);
+
+  String        request;
+  String        line;                  // Partial line of the reply
+  unsigned long timer          = 0;    // Timeout of the current state
+  int           contentLength  = -1;
+  size_t        sent           = 0;    // Number of bytes of the request written
+  bool          mustCheckReply = false;
+  bool          keepAlive      = false; // Connection can be used for the next request
+  bool          reused         = false; // Request is sent via an already open connection
+  bool          retried        = false;
+  bool          success        = false;
+};
+
+#endif // DATASTRUCTS_CONTROLLERHTTPCLIENT_H
@@ -26,6 +26,8 @@ void ControllerSettingsStruct::reset() {
   MustCheckReply             = false;
   SampleSetInitiator         = INVALID_TASK_INDEX;
   MQTT_flags                 = 0;
+  MaxBatchSize               = 0;
+  BatchFlushDelay            = 0;
 
   for (byte i = 0; i < 4; ++i) {
     IP[i] = 0;
@@ -55,6 +57,10 @@ void ControllerSettingsStruct::validate() {
 
   if (MaxRetry == 0) { MaxRetry = CONTROLLER_DELAY_QUEUE_RETRY_DFLT; }
 
+  if (MaxBatchSize > CONTROLLER_DELAY_QUEUE_BATCH_MAX) { MaxBatchSize = 0; }
+
+  if (BatchFlushDelay > CONTROLLER_DELAY_QUEUE_BATCH_FLUSH_MAX) { BatchFlushDelay = 0; }
+
   if ((ClientTimeout < 10) || (ClientTimeout > CONTROLLER_CLIENTTIMEOUT_MAX)) {
     ClientTimeout = CONTROLLER_CLIENTTIMEOUT_DFLT;
   }
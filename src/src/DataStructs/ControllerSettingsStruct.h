@@ -22,6 +22,11 @@ class WiFiUDP;
 # define CONTROLLER_DELAY_QUEUE_DELAY_DFLT  100
 #endif // ifndef CONTROLLER_DELAY_QUEUE_DELAY_DFLT
 
+// Interval in msec to poll a request which is processed asynchronously.
+#ifndef CONTROLLER_DELAY_QUEUE_POLL_INTERVAL
+# define CONTROLLER_DELAY_QUEUE_POLL_INTERVAL  5
+#endif // ifndef CONTROLLER_DELAY_QUEUE_POLL_INTERVAL
+
 // Queue length for controller messages not yet sent.
 #ifndef CONTROLLER_DELAY_QUEUE_DEPTH_MAX
 # define CONTROLLER_DELAY_QUEUE_DEPTH_MAX   50
@@ -39,6 +44,26 @@ class WiFiUDP;
 # define CONTROLLER_DELAY_QUEUE_RETRY_DFLT  10
 #endif // ifndef CONTROLLER_DELAY_QUEUE_RETRY_DFLT
 
+// Number of queued messages a controller may send in a single queue run.
+// 0 or 1 disables batching.
+#ifndef CONTROLLER_DELAY_QUEUE_BATCH_MAX
+# define CONTROLLER_DELAY_QUEUE_BATCH_MAX   CONTROLLER_DELAY_QUEUE_DEPTH_MAX
+#endif // ifndef CONTROLLER_DELAY_QUEUE_BATCH_MAX
+
+// Max. time in msec to wait for a batch to fill before sending a partial batch.
+#ifndef CONTROLLER_DELAY_QUEUE_BATCH_FLUSH_MAX
+# define CONTROLLER_DELAY_QUEUE_BATCH_FLUSH_MAX  60000
+#endif // ifndef CONTROLLER_DELAY_QUEUE_BATCH_FLUSH_MAX
+
+// Max. number of bytes of queued messages to send in a single queue run.
+#ifndef CONTROLLER_DELAY_QUEUE_BATCH_BYTES
+# ifdef ESP32
+#  define CONTROLLER_DELAY_QUEUE_BATCH_BYTES  4096
+# else // ifdef ESP32
+#  define CONTROLLER_DELAY_QUEUE_BATCH_BYTES  1024
+# endif // ifdef ESP32
+#endif // ifndef CONTROLLER_DELAY_QUEUE_BATCH_BYTES
+
 // Timeout of the client in msec.
 #ifndef CONTROLLER_CLIENTTIMEOUT_MAX
 # define CONTROLLER_CLIENTTIMEOUT_MAX     1000
@@ -68,6 +93,8 @@ struct ControllerSettingsStruct
     CONTROLLER_MAX_QUEUE_DEPTH,
     CONTROLLER_MAX_RETRIES,
     CONTROLLER_FULL_QUEUE_ACTION,
+    CONTROLLER_MAX_BATCH_SIZE,
+    CONTROLLER_BATCH_FLUSH_DELAY,
     CONTROLLER_CHECK_REPLY,
     CONTROLLER_CLIENT_ID,
     CONTROLLER_UNIQUE_CLIENT_ID_RECONNECT,
@@ -146,6 +173,8 @@ struct ControllerSettingsStruct
   taskIndex_t  SampleSetInitiator; // The first task to start a sample set.
   uint32_t     MQTT_flags;         // Various flags for MQTT controllers
   char         ClientID[65];       // Used to define the Client ID used by the controller
+  unsigned int MaxBatchSize;       // Max. number of queued messages sent per queue run, 0 = no batching
+  unsigned int BatchFlushDelay;    // Max. time in msec to wait for a full batch.
 
 private:
 
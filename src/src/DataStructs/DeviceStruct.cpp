@@ -4,7 +4,8 @@
     Number(0), Type(0), VType(SENSOR_TYPE_NONE), Ports(0), ValueCount(0),
     PullUpOption(false), InverseLogicOption(false), FormulaOption(false),
     Custom(false), SendDataOption(false), GlobalSyncOption(false),
-    TimerOption(false), TimerOptional(false), DecimalsOnly(false) {}
+    TimerOption(false), TimerOptional(false), DecimalsOnly(false),
+    Callbacks(PLUGIN_CALLBACK_ALL) {}
 
   bool DeviceStruct::connectedToGPIOpins() const {
     switch(Type) {
@@ -30,6 +30,22 @@
 #define SENSOR_TYPE_WIND                   21
 #define SENSOR_TYPE_STRING                 22
 
+// Used for Callbacks, the plugin calls which are sent to all tasks (or plugins) handling them.
+// A plugin not handling a call does not need to be called, see PluginCallbackTable.
+#define PLUGIN_CALLBACK_NONE                0
+#define PLUGIN_CALLBACK_FIFTY_PER_SECOND    (1 << 0)
+#define PLUGIN_CALLBACK_TEN_PER_SECOND      (1 << 1)
+#define PLUGIN_CALLBACK_ONCE_A_SECOND       (1 << 2)
+#define PLUGIN_CALLBACK_CLOCK_IN            (1 << 3)
+#define PLUGIN_CALLBACK_EVENT_OUT           (1 << 4)
+#define PLUGIN_CALLBACK_TIME_CHANGE         (1 << 5)
+#define PLUGIN_CALLBACK_WRITE               (1 << 6)
+#define PLUGIN_CALLBACK_REQUEST             (1 << 7)
+#define PLUGIN_CALLBACK_SERIAL_IN           (1 << 8)
+#define PLUGIN_CALLBACK_UDP_IN              (1 << 9)
+#define PLUGIN_CALLBACK_UNCONDITIONAL_POLL  (1 << 10)
+#define PLUGIN_CALLBACK_ALL                 0xFFFF // Default, for plugins not declaring their callbacks
+
 /*********************************************************************************************\
  * DeviceStruct
  * Description of a plugin
@@ -56,6 +72,7 @@ struct DeviceStruct
   bool TimerOption : 1;        // Allow to set the "Interval" timer for the plugin.
   bool TimerOptional : 1;      // When taskdevice timer is not set and not optional, use default "Interval" delay (Settings.Delay)
   bool DecimalsOnly : 1;       // Allow to set the number of decimals (otherwise treated a 0 decimals)
+  uint16_t Callbacks;          // Plugin calls handled by the plugin, combination of PLUGIN_CALLBACK_xxx
 };
 typedef std::vector<DeviceStruct> DeviceVector;
 
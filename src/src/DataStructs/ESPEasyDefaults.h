@@ -187,6 +187,18 @@
 #ifndef DEFAULT_RULES_OLDENGINE
 #define DEFAULT_RULES_OLDENGINE                true
 #endif
+#ifndef DEFAULT_RULES_EVENTS_TIME_BUDGET
+#define DEFAULT_RULES_EVENTS_TIME_BUDGET        20      // Max. time in msec to process queued rules events per 100 msec
+#endif
+#ifndef DEFAULT_RULES_EVENT_QUEUE_SIZE
+#define DEFAULT_RULES_EVENT_QUEUE_SIZE          64      // Max. number of queued rules events (1 .. 255)
+#endif
+#ifndef DEFAULT_RULES_EVENT_QUEUE_DROP_NEWEST
+#define DEFAULT_RULES_EVENT_QUEUE_DROP_NEWEST   false   // (true|false) Drop new events when the queue is full, else drop the oldest
+#endif
+#ifndef DEFAULT_RULES_COALESCE_EVENTS
+#define DEFAULT_RULES_COALESCE_EVENTS           false   // (true|false) Only keep the newest value of pending events with the same name
+#endif
 
 #ifndef DEFAULT_MQTT_RETAIN
 #define DEFAULT_MQTT_RETAIN                     false   // (true|false) Retain MQTT messages?
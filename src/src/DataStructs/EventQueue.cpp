@@ -1,10 +1,62 @@
 #include "EventQueue.h"
 
+#include "../DataStructs/TimingStats.h"
+#include "../Globals/Settings.h"
+#include "../Helpers/ESPEasy_time_calc.h"
+
+EventQueueStruct::Element::Element(const String& ev) : event(ev), queued(micros()) {}
+
 EventQueueStruct::EventQueueStruct() {}
 
-void EventQueueStruct::add(const String& event)
+bool EventQueueStruct::add(const String& event)
+{
+  if (Settings.CoalesceRulesEvents() && coalesce(event)) {
+    return true;
+  }
+
+  // Max. size 0 means no limit.
+  const size_t maxSize = Settings.RulesEventQueueSize;
+
+  if ((maxSize != 0) && (_eventQueue.size() >= maxSize)) {
+    ++dropped;
+
+    if (Settings.RulesEventQueueDropNewest()) {
+      return false;
+    }
+    _eventQueue.pop_front();
+  }
+  _eventQueue.emplace_back(event);
+
+  if (_eventQueue.size() > maxDepth) {
+    maxDepth = _eventQueue.size();
+  }
+  return true;
+}
+
+bool EventQueueStruct::coalesce(const String& event)
 {
-  _eventQueue.push_back(event);
+  // The event name is the part before '=', events without value must be equal.
+  const int nameLength = event.indexOf('=');
+
+  for (auto it = _eventQueue.begin(); it != _eventQueue.end(); ++it) {
+    bool sameName = false;
+
+    if (nameLength < 0) {
+      sameName = it->event.equals(event);
+    } else {
+      sameName = static_cast<int>(it->event.length()) > nameLength &&
+                 it->event[nameLength] == '=' &&
+                 strncmp(it->event.c_str(), event.c_str(), nameLength) == 0;
+    }
+
+    if (sameName) {
+      // Keep the position and queue time of the pending event, only update the value.
+      it->event = event;
+      ++coalesced;
+      return true;
+    }
+  }
+  return false;
 }
 
 bool EventQueueStruct::getNext(String& event)
@@ -12,7 +64,10 @@ bool EventQueueStruct::getNext(String& event)
   if (_eventQueue.empty()) {
     return false;
   }
-  event = _eventQueue.front();
+  #ifdef USES_TIMING_STATS
+  miscStats[RULES_EVENT_QUEUE_WAIT].add(usecPassedSince(_eventQueue.front().queued));
+  #endif // ifdef USES_TIMING_STATS
+  event = _eventQueue.front().event;
   _eventQueue.pop_front();
   return true;
 }
@@ -25,4 +80,16 @@ void EventQueueStruct::clear()
 bool EventQueueStruct::isEmpty() const
 {
   return _eventQueue.empty();
-}
\ No newline at end of file
+}
+
+size_t EventQueueStruct::size() const
+{
+  return _eventQueue.size();
+}
+
+void EventQueueStruct::resetStats()
+{
+  dropped   = 0;
+  coalesced = 0;
+  maxDepth  = _eventQueue.size();
+}
@@ -8,20 +8,47 @@
 #include "../Globals/Plugins.h"
 
 
+/*********************************************************************************************\
+* EventQueueStruct
+*
+* Rules events waiting to be processed.
+* The max. number of queued events and what to do when the queue is full are set in the
+* advanced settings. Optionally an event replaces a pending event with the same name.
+\*********************************************************************************************/
 struct EventQueueStruct {
   EventQueueStruct();
 
-  void add(const String& event);
+  // Return false when the event was dropped.
+  bool   add(const String& event);
 
-  bool getNext(String& event);
+  bool   getNext(String& event);
 
-  void clear();
+  void   clear();
 
-  bool isEmpty() const;
+  bool   isEmpty() const;
+
+  size_t size() const;
+
+  void   resetStats();
+
+  // Statistics since the last resetStats()
+  unsigned long dropped   = 0; // Events removed or rejected because the queue was full
+  unsigned long coalesced = 0; // Events replacing the value of a pending event
+  size_t        maxDepth  = 0;
 
 private:
 
-  std::list<String>_eventQueue;
+  struct Element {
+    Element(const String& ev);
+
+    String        event;
+    unsigned long queued; // micros() when the event was first queued
+  };
+
+  // Replace the value of a pending event with the same name.
+  bool coalesce(const String& event);
+
+  std::list<Element>_eventQueue;
 };
 
 
@@ -0,0 +1,121 @@
+#include "../DataStructs/ExtraTaskSettingsCache.h"
+
+#include <new>
+
+ExtraTaskSettingsCache::ExtraTaskSettingsCache()
+{
+  for (size_t i = 0; i < EXTRA_TASK_SETTINGS_CACHE_SIZE; ++i) {
+    _slots[i]    = nullptr;
+    _lastUsed[i] = 0;
+  }
+}
+
+ExtraTaskSettingsCache::~ExtraTaskSettingsCache()
+{
+  clear();
+}
+
+bool ExtraTaskSettingsCache::get(taskIndex_t TaskIndex, ExtraTaskSettingsStruct& settings)
+{
+  for (size_t i = 0; i < EXTRA_TASK_SETTINGS_CACHE_SIZE; ++i) {
+    if ((_slots[i] != nullptr) && (_lastUsed[i] != 0) && (_slots[i]->TaskIndex == TaskIndex)) {
+      settings     = *_slots[i];
+      _lastUsed[i] = ++_useCounter;
+      ++hits;
+      return true;
+    }
+  }
+  ++misses;
+  return false;
+}
+
+void ExtraTaskSettingsCache::store(const ExtraTaskSettingsStruct& settings)
+{
+  if (!validTaskIndex(settings.TaskIndex)) {
+    return;
+  }
+  invalidate(settings.TaskIndex);
+
+  size_t slot                    = 0;
+  ExtraTaskSettingsStruct *entry = getFreeSlot(slot);
+
+  if (entry != nullptr) {
+    *entry          = settings;
+    _lastUsed[slot] = ++_useCounter;
+  }
+}
+
+void ExtraTaskSettingsCache::invalidate(taskIndex_t TaskIndex)
+{
+  for (size_t i = 0; i < EXTRA_TASK_SETTINGS_CACHE_SIZE; ++i) {
+    if ((_slots[i] != nullptr) && (_slots[i]->TaskIndex == TaskIndex)) {
+      _slots[i]->TaskIndex = INVALID_TASK_INDEX;
+      _lastUsed[i]         = 0;
+    }
+  }
+}
+
+void ExtraTaskSettingsCache::clear()
+{
+  for (size_t i = 0; i < EXTRA_TASK_SETTINGS_CACHE_SIZE; ++i) {
+    if (_slots[i] != nullptr) {
+      delete _slots[i];
+      _slots[i] = nullptr;
+    }
+    _lastUsed[i] = 0;
+  }
+}
+
+size_t ExtraTaskSettingsCache::getMemorySize() const
+{
+  size_t res = 0;
+
+  for (size_t i = 0; i < EXTRA_TASK_SETTINGS_CACHE_SIZE; ++i) {
+    if (_slots[i] != nullptr) {
+      res += sizeof(ExtraTaskSettingsStruct);
+    }
+  }
+  return res;
+}
+
+ExtraTaskSettingsStruct * ExtraTaskSettingsCache::getFreeSlot(size_t& slot)
+{
+  // Prefer an allocated unused slot, then a new slot, then the least recently used slot.
+  int unallocated = -1;
+  int lru         = -1;
+
+  for (size_t i = 0; i < EXTRA_TASK_SETTINGS_CACHE_SIZE; ++i) {
+    if (_slots[i] == nullptr) {
+      if (unallocated < 0) { unallocated = i; }
+    } else if (_lastUsed[i] == 0) {
+      slot = i;
+      return _slots[i];
+    } else if ((lru < 0) || (_lastUsed[i] < _lastUsed[lru])) {
+      lru = i;
+    }
+  }
+
+  if (unallocated >= 0) {
+    bool allocate = true;
+    #ifdef ESP8266
+
+    // Each slot takes a considerable amount of RAM, keep enough free memory for other tasks.
+    allocate = ESP.getFreeHeap() > (EXTRA_TASK_SETTINGS_CACHE_MIN_FREE_HEAP + sizeof(ExtraTaskSettingsStruct));
+    #endif // ifdef ESP8266
+
+    if (allocate) {
+      _slots[unallocated] = new (std::nothrow) ExtraTaskSettingsStruct();
+
+      if (_slots[unallocated] != nullptr) {
+        slot = unallocated;
+        return _slots[unallocated];
+      }
+    }
+  }
+
+  if (lru >= 0) {
+    slot = lru;
+    return _slots[lru];
+  }
+  return nullptr;
+}
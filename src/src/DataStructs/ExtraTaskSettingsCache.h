@@ -0,0 +1,67 @@
+#ifndef DATASTRUCTS_EXTRATASKSETTINGSCACHE_H
+#define DATASTRUCTS_EXTRATASKSETTINGSCACHE_H
+
+#include "../../ESPEasy_common.h"
+#include "../DataStructs/ExtraTaskSettingsStruct.h"
+#include "../Globals/Plugins.h"
+
+/*********************************************************************************************\
+* ExtraTaskSettingsCache
+*
+* Small LRU cache of decoded task settings, so walking over tasks does not need
+* to read the settings file for every task switch.
+* Slots are allocated on first use. On ESP8266 a slot is only allocated when enough
+* free heap is left, otherwise the least recently used slot is reused.
+\*********************************************************************************************/
+
+#ifndef EXTRA_TASK_SETTINGS_CACHE_SIZE
+# ifdef ESP32
+#  define EXTRA_TASK_SETTINGS_CACHE_SIZE  8
+# else // ifdef ESP32
+#  define EXTRA_TASK_SETTINGS_CACHE_SIZE  4
+# endif // ifdef ESP32
+#endif // ifndef EXTRA_TASK_SETTINGS_CACHE_SIZE
+
+// Min. free heap needed to allocate a new cache slot.
+#ifndef EXTRA_TASK_SETTINGS_CACHE_MIN_FREE_HEAP
+# define EXTRA_TASK_SETTINGS_CACHE_MIN_FREE_HEAP  10000
+#endif // ifndef EXTRA_TASK_SETTINGS_CACHE_MIN_FREE_HEAP
+
+struct ExtraTaskSettingsCache {
+  ExtraTaskSettingsCache();
+  ~ExtraTaskSettingsCache();
+
+  // Copy the cached settings of the task to settings.
+  // Return false when not present.
+  bool   get(taskIndex_t             TaskIndex,
+             ExtraTaskSettingsStruct& settings);
+
+  // Store a copy of the settings, using settings.TaskIndex as key.
+  void   store(const ExtraTaskSettingsStruct& settings);
+
+  void   invalidate(taskIndex_t TaskIndex);
+
+  // Remove all entries and free the allocated memory.
+  void   clear();
+
+  size_t getMemorySize() const;
+
+  // Statistics
+  unsigned long hits   = 0;
+  unsigned long misses = 0;
+
+private:
+
+  // Not copyable, the slots are owned by the cache.
+  ExtraTaskSettingsCache(const ExtraTaskSettingsCache&);
+  ExtraTaskSettingsCache& operator=(const ExtraTaskSettingsCache&);
+
+  // Return the slot to store a new entry, or nullptr when none could be allocated.
+  ExtraTaskSettingsStruct* getFreeSlot(size_t& slot);
+
+  ExtraTaskSettingsStruct *_slots[EXTRA_TASK_SETTINGS_CACHE_SIZE];
+  uint32_t _lastUsed[EXTRA_TASK_SETTINGS_CACHE_SIZE];
+  uint32_t _useCounter = 0;
+};
+
+#endif // DATASTRUCTS_EXTRATASKSETTINGSCACHE_H
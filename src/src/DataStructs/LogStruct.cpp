@@ -2,67 +2,172 @@
 #include "../../ESPEasy_fdwdecl.h"
 #include "../Helpers/ESPEasy_time_calc.h"
 
+#include "../../ESPEasy_Log.h"
 
-LogStruct::LogStruct() : write_idx(0), read_idx(0), lastReadTimeStamp(0) {
-  for (int i = 0; i < LOG_STRUCT_MESSAGE_LINES; ++i) {
-    timeStamp[i] = 0;
-    log_level[i] = 0;
+// Longest text of a record, it must fit in the arena.
+#define LOG_RECORD_MAX_LENGTH   (LOG_STRUCT_ARENA_SIZE - LOG_RECORD_HEADER_SIZE)
+
+// The record positions wrap around at 2^32, which must be a multiple of the arena size.
+static_assert((LOG_STRUCT_ARENA_SIZE & (LOG_STRUCT_ARENA_SIZE - 1)) == 0, "LOG_STRUCT_ARENA_SIZE must be a power of 2");
+
+
+// Text length from the header fields after the timestamp.
+static uint16_t headerLength(const uint8_t *header) {
+  return header[2] | (header[3] << 8);
+}
+
+LogStruct::LogStruct() : write_pos(0), tail_pos(0), lastReadTimeStamp(0) {
+  for (int i = 0; i < LOG_STRUCT_NR_DESTINATIONS; ++i) {
+    read_pos[i] = 0;
+    dropped[i]  = 0;
+  }
+}
+
+void LogStruct::add(const byte loglevel, byte destinations, const char *line) {
+  if (destinations == 0) {
+    return;
+  }
+  size_t linelength = strlen(line);
+
+  if (linelength > LOG_RECORD_MAX_LENGTH) {
+    linelength = LOG_RECORD_MAX_LENGTH;
+  }
+  const size_t recordSize = LOG_RECORD_HEADER_SIZE + linelength;
+
+  while ((write_pos - tail_pos + recordSize) > LOG_STRUCT_ARENA_SIZE) {
+    dropOldest();
+  }
+  const uint32_t timestamp = millis();
+  uint8_t header[LOG_RECORD_HEADER_SIZE - 4];
+
+  header[0] = loglevel;
+  header[1] = destinations;
+  header[2] = linelength & 0xFF;
+  header[3] = linelength >> 8;
+  write(write_pos,     &timestamp, 4);
+  write(write_pos + 4, header,     sizeof(header));
+  write(write_pos + LOG_RECORD_HEADER_SIZE, line, linelength);
+  write_pos += recordSize;
+}
+
+bool LogStruct::fits(size_t linelength) {
+  return linelength <= LOG_RECORD_MAX_LENGTH;
+}
+
+bool LogStruct::mustOverwriteUnread(byte destination, size_t linelength) const {
+  if ((destination < 1) || (destination > LOG_STRUCT_NR_DESTINATIONS)) {
+    return false;
+  }
+  const byte index = destination - 1;
+
+  if (linelength > LOG_RECORD_MAX_LENGTH) {
+    linelength = LOG_RECORD_MAX_LENGTH;
+  }
+  const size_t recordSize = LOG_RECORD_HEADER_SIZE + linelength;
+
+  // Walk the records add() would drop, records before read_pos are already read.
+  const uint32_t unread = read_pos[index] - tail_pos;
+  uint32_t pos          = tail_pos;
+
+  while ((write_pos - pos + recordSize) > LOG_STRUCT_ARENA_SIZE) {
+    uint8_t header[LOG_RECORD_HEADER_SIZE - 4];
+    read(pos + 4, header, sizeof(header));
+
+    if (((pos - tail_pos) >= unread) && (header[1] & (1 << index))) {
+      return true;
+    }
+    pos += LOG_RECORD_HEADER_SIZE + headerLength(header);
+  }
+  return false;
+}
+
+bool LogStruct::getNext(byte destination, LogRecord& record) {
+  if (!peekNext(destination, record)) {
+    return false;
   }
+  read_pos[destination - 1] += record.size();
+  return true;
 }
 
-void LogStruct::add(const byte loglevel, const char *line) {
-  write_idx = (write_idx + 1) % LOG_STRUCT_MESSAGE_LINES;
+bool LogStruct::peekNext(byte destination, LogRecord& record) {
+  if ((destination < 1) || (destination > LOG_STRUCT_NR_DESTINATIONS)) {
+    return false;
+  }
+  const byte index = destination - 1;
 
-  if (write_idx == read_idx) {
-    // Buffer full, move read_idx to overwrite oldest entry.
-    read_idx = (read_idx + 1) % LOG_STRUCT_MESSAGE_LINES;
+  if (destination == LOG_TO_WEBLOG) {
+    lastReadTimeStamp = millis();
   }
-  timeStamp[write_idx] = millis();
-  log_level[write_idx] = loglevel;
-  unsigned linelength = strlen(line);
 
-  if (linelength > LOG_STRUCT_MESSAGE_SIZE - 1) {
-    linelength = LOG_STRUCT_MESSAGE_SIZE - 1;
+  while (read_pos[index] != write_pos) {
+    uint8_t header[LOG_RECORD_HEADER_SIZE - 4];
+    read(read_pos[index] + 4, header, sizeof(header));
+
+    if (header[1] & (1 << index)) {
+      read(read_pos[index], &record.timestamp, 4);
+      record.pos      = read_pos[index] + LOG_RECORD_HEADER_SIZE;
+      record.length   = headerLength(header);
+      record.loglevel = header[0];
+      return true;
+    }
+
+    // Skip records not meant for this destination.
+    read_pos[index] += LOG_RECORD_HEADER_SIZE + headerLength(header);
   }
-  Message[write_idx] = "";
-  Message[write_idx].reserve(linelength);
+  return false;
+}
 
-  for (unsigned i = 0; i < linelength; ++i) {
-    Message[write_idx] += *(line + i);
+size_t LogStruct::getMessagePart(const LogRecord& record, size_t offset, const char *& data) const {
+  if (offset >= record.length) {
+    return 0;
   }
+  const size_t index = (record.pos + offset) % LOG_STRUCT_ARENA_SIZE;
+  size_t partSize    = LOG_STRUCT_ARENA_SIZE - index;
+
+  if (partSize > (record.length - offset)) { partSize = record.length - offset; }
+  data = reinterpret_cast<const char *>(arena + index);
+  return partSize;
 }
 
-// Read the next item and append it to the given string.
-// Returns whether new lines are available.
-bool LogStruct::get(String& output, const String& lineEnd) {
-  lastReadTimeStamp = millis();
+String LogStruct::getMessage(const LogRecord& record) const {
+  String message;
+
+  message.reserve(record.length);
+  const char *data;
+  size_t offset = 0;
+  size_t partSize;
 
-  if (!isEmpty()) {
-    read_idx = (read_idx + 1) % LOG_STRUCT_MESSAGE_LINES;
-    output  += formatLine(read_idx, lineEnd);
+  while ((partSize = getMessagePart(record, offset, data)) > 0) {
+    for (size_t i = 0; i < partSize; ++i) {
+      message += data[i];
+    }
+    offset += partSize;
   }
-  return !isEmpty();
+  return message;
 }
 
-String LogStruct::get_logjson_formatted(bool& logLinesAvailable, unsigned long& timestamp) {
-  lastReadTimeStamp = millis();
+String LogStruct::get_logjson_formatted(bool& logLinesAvailable, unsigned long& timestamp, size_t& recordSize) {
   logLinesAvailable = false;
+  LogRecord record;
 
-  if (isEmpty()) {
+  if (!getNext(LOG_TO_WEBLOG, record)) {
     return "";
   }
-  read_idx  = (read_idx + 1) % LOG_STRUCT_MESSAGE_LINES;
-  timestamp = timeStamp[read_idx];
-  String output = logjson_formatLine(read_idx);
+  timestamp  = record.timestamp;
+  recordSize = record.size();
+  String output = logjson_formatLine(record);
 
-  if (isEmpty()) { return output; }
+  if (isEmpty(LOG_TO_WEBLOG)) { return output; }
   output           += ",\n";
   logLinesAvailable = true;
   return output;
 }
 
-bool LogStruct::isEmpty() {
-  return write_idx == read_idx;
+bool LogStruct::isEmpty(byte destination) const {
+  if ((destination < 1) || (destination > LOG_STRUCT_NR_DESTINATIONS)) {
+    return true;
+  }
+  return read_pos[destination - 1] == write_pos;
 }
 
 bool LogStruct::logActiveRead() {
@@ -70,44 +175,71 @@ bool LogStruct::logActiveRead() {
   return timePassedSince(lastReadTimeStamp) < LOG_BUFFER_EXPIRE;
 }
 
-String LogStruct::formatLine(int index, const String& lineEnd) {
-  String output;
-
-  output += timeStamp[index];
-  output += " : ";
-  output += Message[index];
-  output += lineEnd;
-  return output;
+uint32_t LogStruct::getDropped(byte destination) const {
+  if ((destination < 1) || (destination > LOG_STRUCT_NR_DESTINATIONS)) {
+    return 0;
+  }
+  return dropped[destination - 1];
 }
 
-String LogStruct::logjson_formatLine(int index) {
+String LogStruct::logjson_formatLine(const LogRecord& record) {
   String output;
 
-  output.reserve(LOG_STRUCT_MESSAGE_SIZE + 64);
+  output.reserve(record.length + 64);
   output  = "{";
-  output += to_json_object_value("timestamp", String(timeStamp[index]));
+  output += to_json_object_value("timestamp", String(record.timestamp));
   output += ",\n";
-  output += to_json_object_value("text",  Message[index]);
+  output += to_json_object_value("text",  getMessage(record));
   output += ",\n";
-  output += to_json_object_value("level", String(log_level[index]));
+  output += to_json_object_value("level", String(record.loglevel));
   output += "}";
   return output;
 }
 
 void LogStruct::clearExpiredEntries() {
-  if (isEmpty()) {
+  if (isEmpty(LOG_TO_WEBLOG)) {
     return;
   }
 
   if (timePassedSince(lastReadTimeStamp) > LOG_BUFFER_EXPIRE) {
-    // Clear the entire log.
+    // Skip all unread records of the web log.
     // If web log is the only log active, it will not be checked again until it is read.
-    for (read_idx = 0; read_idx < LOG_STRUCT_MESSAGE_LINES; ++read_idx) {
-      Message[read_idx]   = String(); // Free also the reserved memory.
-      timeStamp[read_idx] = 0;
-      log_level[read_idx] = 0;
+    read_pos[LOG_TO_WEBLOG - 1] = write_pos;
+  }
+}
+
+void LogStruct::dropOldest() {
+  uint8_t header[LOG_RECORD_HEADER_SIZE - 4];
+
+  read(tail_pos + 4, header, sizeof(header));
+  const uint32_t next = tail_pos + LOG_RECORD_HEADER_SIZE + headerLength(header);
+
+  for (byte index = 0; index < LOG_STRUCT_NR_DESTINATIONS; ++index) {
+    if (read_pos[index] == tail_pos) {
+      // Destination did not yet read this record.
+      if (header[1] & (1 << index)) {
+        ++dropped[index];
+      }
+      read_pos[index] = next;
     }
-    read_idx  = 0;
-    write_idx = 0;
   }
+  tail_pos = next;
+}
+
+void LogStruct::write(uint32_t pos, const void *data, size_t size) {
+  const size_t index = pos % LOG_STRUCT_ARENA_SIZE;
+  size_t firstPart   = LOG_STRUCT_ARENA_SIZE - index;
+
+  if (firstPart > size) { firstPart = size; }
+  memcpy(arena + index, data, firstPart);
+  memcpy(arena, static_cast<const uint8_t *>(data) + firstPart, size - firstPart);
+}
+
+void LogStruct::read(uint32_t pos, void *data, size_t size) const {
+  const size_t index = pos % LOG_STRUCT_ARENA_SIZE;
+  size_t firstPart   = LOG_STRUCT_ARENA_SIZE - index;
+
+  if (firstPart > size) { firstPart = size; }
+  memcpy(data, arena + index, firstPart);
+  memcpy(static_cast<uint8_t *>(data) + firstPart, arena, size - firstPart);
 }
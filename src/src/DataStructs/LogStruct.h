@@ -5,51 +5,99 @@
 
 /*********************************************************************************************\
  * LogStruct
+ *
+ * Ring buffer of binary log records: timestamp, log level, destinations, length and text.
+ * All log destinations (serial, syslog, web log, SD card) read the same records,
+ * each with its own read position. The text is only formatted when a destination reads it.
+ * When the buffer is full, the oldest records are overwritten.
 \*********************************************************************************************/
-#define LOG_STRUCT_MESSAGE_SIZE 128
 #ifdef ESP32
-  #define LOG_STRUCT_MESSAGE_LINES 30
+  #define LOG_STRUCT_ARENA_SIZE     2048   // Must be a power of 2
   #define LOG_BUFFER_EXPIRE         30000  // Time after which a buffered log item is considered expired.
 #else
   #if defined(PLUGIN_BUILD_TESTING) || defined(PLUGIN_BUILD_DEV)
-    #define LOG_STRUCT_MESSAGE_LINES 10
+    #define LOG_STRUCT_ARENA_SIZE     512
   #else
-    #define LOG_STRUCT_MESSAGE_LINES 15
+    #define LOG_STRUCT_ARENA_SIZE     1024
   #endif
   #define LOG_BUFFER_EXPIRE         5000  // Time after which a buffered log item is considered expired.
 #endif
 
+// Record header: timestamp (4 bytes), loglevel, destinations, length (2 bytes)
+#define LOG_RECORD_HEADER_SIZE      8
+
+// Number of log destinations, LOG_TO_SERIAL ... LOG_TO_SDCARD
+#define LOG_STRUCT_NR_DESTINATIONS  4
+
+struct LogRecord {
+  // Size of the record in the log buffer
+  size_t size() const { return LOG_RECORD_HEADER_SIZE + length; }
+
+  uint32_t timestamp;
+  uint32_t pos;      // Position of the text in the log buffer, only valid until the next LogStruct::add()
+  uint16_t length;
+  byte     loglevel;
+};
+
 struct LogStruct {
     LogStruct();
 
-    void add(const byte loglevel, const char *line);
+    // Store a log line for the given destinations.
+    // destinations: bit (LOG_TO_xxx - 1) set for each destination which should receive the line.
+    // A line which does not fit() is clipped.
+    void add(const byte loglevel, byte destinations, const char *line);
+
+    // Whether a line of this length can be stored without clipping.
+    static bool fits(size_t linelength);
+
+    // Whether adding a line of this length overwrites records the destination did not yet read.
+    bool mustOverwriteUnread(byte destination, size_t linelength) const;
+
+    // Read the next record for the destination (LOG_TO_xxx).
+    // Returns false when there is no record left.
+    bool getNext(byte destination, LogRecord& record);
 
-    // Read the next item and append it to the given string.
-    // Returns whether new lines are available.
-    bool get(String& output, const String& lineEnd);
+    // Same as getNext(), but the record is not marked as read.
+    bool peekNext(byte destination, LogRecord& record);
 
-    String get_logjson_formatted(bool& logLinesAvailable, unsigned long& timestamp);
+    // Contiguous part of the text of the record, starting at offset.
+    // Return the size of the part, 0 when offset is at the end of the text.
+    size_t getMessagePart(const LogRecord& record, size_t offset, const char *& data) const;
 
-    bool isEmpty();
+    String getMessage(const LogRecord& record) const;
+
+    // recordSize: size of the record in the log buffer
+    String get_logjson_formatted(bool& logLinesAvailable, unsigned long& timestamp, size_t& recordSize);
+
+    bool isEmpty(byte destination) const;
 
     bool logActiveRead();
 
-  private:
-    String formatLine(int index, const String& lineEnd);
+    // Number of records overwritten before the destination did read them.
+    uint32_t getDropped(byte destination) const;
 
-    String logjson_formatLine(int index);
+  private:
+    String logjson_formatLine(const LogRecord& record);
 
     void clearExpiredEntries();
 
-    String Message[LOG_STRUCT_MESSAGE_LINES];
-    unsigned long timeStamp[LOG_STRUCT_MESSAGE_LINES];
-    int write_idx;
-    int read_idx;
-    unsigned long lastReadTimeStamp;
-    byte log_level[LOG_STRUCT_MESSAGE_LINES];
+    // Remove the oldest record.
+    void dropOldest();
+
+    void write(uint32_t pos, const void *data, size_t size);
+
+    void read(uint32_t pos, void *data, size_t size) const;
+
+    // Record positions are absolute, index in the arena is pos % LOG_STRUCT_ARENA_SIZE.
+    uint8_t  arena[LOG_STRUCT_ARENA_SIZE];
+    uint32_t write_pos;
+    uint32_t tail_pos; // Oldest record in the arena
+    uint32_t read_pos[LOG_STRUCT_NR_DESTINATIONS];
+    uint32_t dropped[LOG_STRUCT_NR_DESTINATIONS];
+    uint32_t lastReadTimeStamp;
 
 };
 
 
 
-#endif // DATASTRUCTS_LOGSTRUCT_H
\ No newline at end of file
+#endif // DATASTRUCTS_LOGSTRUCT_H
@@ -0,0 +1,102 @@
+#include "../DataStructs/PluginCallbackTable.h"
+
+#include "../../ESPEasy_plugindefs.h"
+#include "../Globals/Device.h"
+#include "../Globals/Settings.h"
+
+uint16_t PluginCallbackTable::getCallbackFlag(byte Function)
+{
+  switch (Function) {
+    case PLUGIN_FIFTY_PER_SECOND:   return PLUGIN_CALLBACK_FIFTY_PER_SECOND;
+    case PLUGIN_TEN_PER_SECOND:     return PLUGIN_CALLBACK_TEN_PER_SECOND;
+    case PLUGIN_ONCE_A_SECOND:      return PLUGIN_CALLBACK_ONCE_A_SECOND;
+    case PLUGIN_CLOCK_IN:           return PLUGIN_CALLBACK_CLOCK_IN;
+    case PLUGIN_EVENT_OUT:          return PLUGIN_CALLBACK_EVENT_OUT;
+    case PLUGIN_TIME_CHANGE:        return PLUGIN_CALLBACK_TIME_CHANGE;
+    case PLUGIN_WRITE:              return PLUGIN_CALLBACK_WRITE;
+    case PLUGIN_REQUEST:            return PLUGIN_CALLBACK_REQUEST;
+    case PLUGIN_SERIAL_IN:          return PLUGIN_CALLBACK_SERIAL_IN;
+    case PLUGIN_UDP_IN:             return PLUGIN_CALLBACK_UDP_IN;
+    case PLUGIN_UNCONDITIONAL_POLL: return PLUGIN_CALLBACK_UNCONDITIONAL_POLL;
+  }
+  return PLUGIN_CALLBACK_NONE;
+}
+
+const byte PluginCallbackTable::callbackFunctions[NR_CALLBACKS] = {
+  PLUGIN_FIFTY_PER_SECOND,
+  PLUGIN_TEN_PER_SECOND,
+  PLUGIN_ONCE_A_SECOND,
+  PLUGIN_CLOCK_IN,
+  PLUGIN_EVENT_OUT,
+  PLUGIN_TIME_CHANGE,
+  PLUGIN_WRITE,
+  PLUGIN_REQUEST,
+  PLUGIN_SERIAL_IN,
+  PLUGIN_UDP_IN
+};
+
+PluginCallbackTable::CallbackIndex PluginCallbackTable::getCallbackIndex(byte Function)
+{
+  for (int index = 0; index < NR_CALLBACKS; ++index) {
+    if (callbackFunctions[index] == Function) {
+      return static_cast<CallbackIndex>(index);
+    }
+  }
+  return NR_CALLBACKS;
+}
+
+const PluginCallbackTable::SubscriberList& PluginCallbackTable::getSubscribers(byte Function)
+{
+  if (!_valid) {
+    rebuild();
+  }
+  return _subscribers[getCallbackIndex(Function)];
+}
+
+void PluginCallbackTable::invalidate()
+{
+  _valid = false;
+}
+
+size_t PluginCallbackTable::getMemorySize() const
+{
+  size_t res = 0;
+
+  for (int i = 0; i < NR_CALLBACKS; ++i) {
+    res += _subscribers[i].capacity() * sizeof(Subscriber);
+  }
+  return res;
+}
+
+void PluginCallbackTable::rebuild()
+{
+  for (int i = 0; i < NR_CALLBACKS; ++i) {
+    _subscribers[i].clear();
+  }
+
+  for (taskIndex_t task = 0; task < TASKS_MAX; ++task) {
+    if (!Settings.TaskDeviceEnabled[task] || !validPluginID_fullcheck(Settings.TaskDeviceNumber[task])) {
+      continue;
+    }
+    const deviceIndex_t deviceIndex = getDeviceIndex_from_TaskIndex(task);
+
+    if (!validDeviceIndex(deviceIndex)) {
+      continue;
+    }
+    const uint16_t callbacks = Device[deviceIndex].Callbacks;
+
+    // Only serial and UDP input is also sent to tasks with a remote data feed.
+    const bool localFeed = Settings.TaskDeviceDataFeed[task] == 0;
+
+    for (int index = 0; index < NR_CALLBACKS; ++index) {
+      if (!(callbacks & getCallbackFlag(callbackFunctions[index]))) {
+        continue;
+      }
+
+      if (localFeed || (index == SERIAL_IN) || (index == UDP_IN)) {
+        _subscribers[index].push_back({ task, deviceIndex });
+      }
+    }
+  }
+  _valid = true;
+}
@@ -0,0 +1,68 @@
+#ifndef DATASTRUCTS_PLUGINCALLBACKTABLE_H
+#define DATASTRUCTS_PLUGINCALLBACKTABLE_H
+
+#include "../../ESPEasy_common.h"
+#include "../DataStructs/DeviceStruct.h"
+#include "../Globals/Plugins.h"
+
+#include <vector>
+
+/*********************************************************************************************\
+* PluginCallbackTable
+*
+* Per plugin call (e.g. PLUGIN_TEN_PER_SECOND) the list of enabled tasks whose plugin
+* handles that call, as declared in DeviceStruct::Callbacks.
+* PluginCall() only walks this list, instead of checking all tasks on every call.
+* The lists are rebuilt on first use after invalidate(), which must be called when a task
+* is enabled, disabled or gets another plugin assigned.
+\*********************************************************************************************/
+struct PluginCallbackTable {
+  struct Subscriber {
+    taskIndex_t   taskIndex;
+    deviceIndex_t deviceIndex;
+  };
+
+  typedef std::vector<Subscriber> SubscriberList;
+
+  // Return the PLUGIN_CALLBACK_xxx flag of the plugin call.
+  // Return PLUGIN_CALLBACK_NONE when the call is not dispatched via this table.
+  static uint16_t       getCallbackFlag(byte Function);
+
+  // Enabled tasks handling the plugin call, in task order.
+  // Empty list for plugin calls which are not dispatched via this table.
+  const SubscriberList& getSubscribers(byte Function);
+
+  void                  invalidate();
+
+  size_t                getMemorySize() const;
+
+private:
+
+  enum CallbackIndex {
+    FIFTY_PER_SECOND,
+    TEN_PER_SECOND,
+    ONCE_A_SECOND,
+    CLOCK_IN,
+    EVENT_OUT,
+    TIME_CHANGE,
+    WRITE,
+    REQUEST,
+    SERIAL_IN,
+    UDP_IN,
+    NR_CALLBACKS
+  };
+
+  // Plugin call per CallbackIndex
+  static const byte callbackFunctions[NR_CALLBACKS];
+
+  // Return NR_CALLBACKS when the plugin call has no subscriber list.
+  static CallbackIndex getCallbackIndex(byte Function);
+
+  void                 rebuild();
+
+  // Extra (always empty) list at NR_CALLBACKS for other plugin calls.
+  SubscriberList _subscribers[NR_CALLBACKS + 1];
+  bool _valid = false;
+};
+
+#endif // DATASTRUCTS_PLUGINCALLBACKTABLE_H
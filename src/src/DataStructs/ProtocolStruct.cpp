@@ -4,7 +4,7 @@ ProtocolStruct::ProtocolStruct() :
     defaultPort(0), Number(0), usesMQTT(false), usesAccount(false), usesPassword(false),
     usesTemplate(false), usesID(false), Custom(false), usesHost(true), usesPort(true),
     usesQueue(true), usesCheckReply(true), usesTimeout(true), usesSampleSets(false), 
-    usesExtCreds(false), needsWiFi(true) {}
+    usesExtCreds(false), needsWiFi(true), usesHTTP(false) {}
 
 
 bool ProtocolStruct::useExtendedCredentials() const {
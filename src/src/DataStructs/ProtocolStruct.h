@@ -29,6 +29,7 @@ struct ProtocolStruct
   bool     usesSampleSets : 1;
   bool     usesExtCreds   : 1;
   bool     needsWiFi      : 1;
+  bool     usesHTTP       : 1; // Each queued element is sent as a separate HTTP request, so no batch settings
 };
 
 typedef std::vector<ProtocolStruct> ProtocolVector;
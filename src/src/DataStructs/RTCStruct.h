@@ -2,12 +2,19 @@
 #define DATASTRUCTS_RTC_STRUCTS_H
 
 #include "../../ESPEasy_common.h"
+#include "../DataStructs/ESPEasyLimits.h"
 
 // this offsets are in blocks, bytes = blocks * 4
 #define RTC_BASE_STRUCT 64
 #define RTC_BASE_USERVAR 74
 #define RTC_BASE_CACHE 124
 
+// UserVar is checked in blocks of RTC_USERVAR_BLOCK_TASKS tasks, each block has its own checksum.
+// The checksums are stored right after UserVar, with 12 tasks this ends at RTC_BASE_CACHE.
+#define RTC_USERVAR_BLOCK_TASKS  6
+#define RTC_USERVAR_NR_BLOCKS    ((TASKS_MAX + RTC_USERVAR_BLOCK_TASKS - 1) / RTC_USERVAR_BLOCK_TASKS)
+#define RTC_BASE_USERVAR_CHECKSUM (RTC_BASE_USERVAR + (VARS_PER_TASK * TASKS_MAX))
+
 #define RTC_CACHE_DATA_SIZE 240
 #define CACHE_FILE_MAX_SIZE 24000
 
@@ -0,0 +1,242 @@
+#include "../DataStructs/RulesCompiled.h"
+
+#include "../DataStructs/ESPEasyLimits.h"
+#include "../../ESPEasy_fdwdecl.h"
+
+#include <algorithm>
+
+RulesNode::RulesNode(Type nodeType, const String& nodeText) : text(nodeText), type(nodeType)
+{
+  for (size_t i = 0; i < text.length() && !dynamic; ++i) {
+    switch (text[i]) {
+      case '%':
+      case '[':
+      case '{':
+        dynamic = true;
+        break;
+    }
+  }
+}
+
+void RulesNode::setCompare(char compareOperator, int posStart, float compareValue)
+{
+  compare    = compareOperator;
+  nameLength = posStart;
+  value      = compareValue;
+  fastMatch  = !dynamic;
+}
+
+void RulesCompiledFile::clear()
+{
+  clearNodes();
+  triggerIndex.clear();
+  genericTriggers.clear();
+  nrTriggers       = 0;
+  compileAttempted = false;
+  indexed          = false;
+}
+
+void RulesCompiledFile::clearNodes()
+{
+  // Swap with empty vector to actually free the memory.
+  std::vector<RulesNode>().swap(nodes);
+  compiled = false;
+  ++revision;
+}
+
+void RulesCompiledFile::reserve(size_t fileSize)
+{
+  // Rough estimate of 32 characters per line.
+  nodes.reserve(fileSize / 32 + 1);
+}
+
+void RulesCompiledFile::addNode(RulesNode::Type type, const String& text)
+{
+  nodes.emplace_back(type, text);
+}
+
+void RulesCompiledFile::addTrigger(size_t nameLength)
+{
+  const uint16_t nodeIndex = nodes.size() - 1;
+
+  triggerIndex.push_back({ hashTriggerName(nodes[nodeIndex].text.c_str(), nameLength), nodeIndex });
+  ++nrTriggers;
+}
+
+void RulesCompiledFile::addGenericTrigger()
+{
+  genericTriggers.push_back(nodes.size() - 1);
+  ++nrTriggers;
+}
+
+void RulesCompiledFile::finalizeIndex()
+{
+  std::sort(triggerIndex.begin(), triggerIndex.end(),
+            [](const TriggerIndexEntry& lhs, const TriggerIndexEntry& rhs) {
+    return lhs.nameHash < rhs.nameHash;
+  });
+  triggerIndex.shrink_to_fit();
+  genericTriggers.shrink_to_fit();
+  indexed = true;
+}
+
+bool RulesCompiledFile::getTriggerCandidates(const RulesEventParts& eventParts,
+                                             std::vector<uint16_t>& candidates) const
+{
+  candidates.clear();
+
+  if (eventParts.literal) {
+    // Need to check all triggers
+    for (size_t i = 0; i < nodes.size(); ++i) {
+      if (nodes[i].type == RulesNode::Type::On) {
+        candidates.push_back(i);
+      }
+    }
+    return nrTriggers > 0;
+  }
+  candidates = genericTriggers;
+
+  const uint32_t hashes[2] = { eventParts.nameHash, eventParts.compareHash };
+  const int nrHashes       = (eventParts.nameHash == eventParts.compareHash) ? 1 : 2;
+
+  for (int h = 0; h < nrHashes; ++h) {
+    auto it = std::lower_bound(triggerIndex.begin(), triggerIndex.end(), hashes[h],
+                               [](const TriggerIndexEntry& entry, uint32_t hash) {
+      return entry.nameHash < hash;
+    });
+
+    for (; it != triggerIndex.end() && it->nameHash == hashes[h]; ++it) {
+      candidates.push_back(it->nodeIndex);
+    }
+  }
+
+  if (candidates.empty()) {
+    return false;
+  }
+
+  // Blocks must be processed in the order they appear in the file.
+  std::sort(candidates.begin(), candidates.end());
+  candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+  return true;
+}
+
+uint32_t RulesCompiledFile::hashTriggerName(const char *name, size_t length)
+{
+  // FNV-1a hash on the lower case characters
+  uint32_t hash = 2166136261u;
+
+  for (size_t i = 0; i < length && name[i] != '\0'; ++i) {
+    hash ^= static_cast<uint8_t>(tolower(name[i]));
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+size_t RulesCompiledFile::getMemorySize() const
+{
+  size_t res = nodes.capacity() * sizeof(RulesNode);
+
+  res += triggerIndex.capacity() * sizeof(TriggerIndexEntry);
+  res += genericTriggers.capacity() * sizeof(uint16_t);
+
+  for (auto it = nodes.begin(); it != nodes.end(); ++it) {
+    res += it->text.length();
+  }
+  return res;
+}
+
+RulesEventParts::RulesEventParts(const String& event) : trimmed(event)
+{
+  trimmed.trim();
+  literal = event.charAt(0) == '!';
+  special = literal || event.startsWith(F("Clock#Time"));
+
+  const int pos = event.indexOf('=');
+
+  if (pos >= 0) {
+    valueValid = validFloatFromString(event.substring(pos + 1), value);
+    name       = event.substring(0, pos);
+  } else {
+    name = trimmed;
+  }
+  nameHash = RulesCompiledFile::hashTriggerName(name.c_str(), name.length());
+
+  // An event may also match a trigger when it is literally the same as the trigger.
+  int  posStart, posEnd;
+  char compare;
+
+  if (findCompareCondition(trimmed, compare, posStart, posEnd)) {
+    compareHash = RulesCompiledFile::hashTriggerName(trimmed.c_str(), posStart);
+  } else {
+    compareHash = RulesCompiledFile::hashTriggerName(trimmed.c_str(), trimmed.length());
+  }
+}
+
+RulesFileLineReader::RulesFileLineReader(fs::File& file, size_t lineReserve)
+  : _file(file), _lineReserve(lineReserve)
+{
+  _buf.resize(RULES_BUFFER_SIZE);
+}
+
+bool RulesFileLineReader::readLine(String& line)
+{
+  line = "";
+  line.reserve(_lineReserve);
+  bool firstNonSpaceRead = false;
+  bool commentFound      = false;
+
+  while (true) {
+    if (_bufPos >= _bufLength) {
+      if (!_file.available()) {
+        return false;
+      }
+      _bufLength = _file.read(&_buf[0], RULES_BUFFER_SIZE);
+      _bufPos    = 0;
+
+      if (_bufLength == 0) {
+        return false;
+      }
+    }
+    const char c = static_cast<char>(_buf[_bufPos++]);
+
+    switch (c)
+    {
+      case '\n':
+        // Line end
+        return true;
+      case '\r': // Just skip this character
+        break;
+      case '\t': // tab
+      case ' ':  // space
+      {
+        // Strip leading spaces.
+        if (firstNonSpaceRead) {
+          line += ' ';
+        }
+        break;
+      }
+      case '/':
+      {
+        if (!commentFound) {
+          line += '/';
+
+          if (line.endsWith("//")) {
+            // consider the rest of the line a comment
+            commentFound = true;
+          }
+        }
+        break;
+      }
+      default: // Any other character
+      {
+        firstNonSpaceRead = true;
+
+        if (!commentFound) {
+          line += c;
+        }
+        break;
+      }
+    }
+  }
+  return false;
+}
@@ -0,0 +1,173 @@
+#ifndef DATASTRUCTS_RULESCOMPILED_H
+#define DATASTRUCTS_RULESCOMPILED_H
+
+#include "../../ESPEasy_common.h"
+
+#include <FS.h>
+#include <vector>
+
+/*********************************************************************************************\
+* Compiled rules
+*
+* A rules file is compiled into a flat list of nodes when it is saved or at boot.
+* The structure of a rules file (on/if/elseif/else/endif/endon) does not depend on the event,
+* so it can be resolved once.
+* Only the parts containing template markup (%...%, [...] or {...}) still need
+* substitution when the node is executed.
+*
+* The triggers are indexed by (a hash of) the lower case event name, so an event is only
+* matched against the blocks which may handle it.
+\*********************************************************************************************/
+
+#ifndef RULES_COMPILED_MIN_FREE_HEAP
+
+// Do not keep compiled rules in memory when free heap drops below this value after compiling.
+  # define RULES_COMPILED_MIN_FREE_HEAP     8192
+#endif // ifndef RULES_COMPILED_MIN_FREE_HEAP
+
+struct RulesNode {
+  enum class Type : uint8_t {
+    On,     // text = trigger (lower case), inline action follows as separate node
+    If,     // text = condition
+    ElseIf, // text = condition
+    Else,
+    EndIf,
+    EndOn,
+    Action  // text = command
+  };
+
+  RulesNode(Type nodeType, const String& nodeText);
+
+  // Split a static trigger into event name, compare operator and value.
+  // Must be called with the result of findCompareCondition() on the trigger.
+  void setCompare(char compareOperator, int posStart, float compareValue);
+
+  String text;
+
+  // Value to compare the event value with (On node with compare operator)
+  float value = 0.0f;
+
+  // Length of the event name part of the trigger (On node with compare operator)
+  uint16_t nameLength = 0;
+
+  Type type;
+
+  // Compare operator as used by compareValues(), 0 when the trigger has no compare condition
+  char compare = 0;
+
+  // Text contains markup which must be parsed every time the node is executed.
+  bool dynamic = false;
+
+  // On node: trigger can be matched using the pre-split name, compare operator and value.
+  bool fastMatch = false;
+};
+
+
+/*********************************************************************************************\
+* Event split into name and value, to match against compiled triggers.
+\*********************************************************************************************/
+struct RulesEventParts {
+  RulesEventParts(const String& event);
+
+  String trimmed;
+  String name;
+  float  value = 0.0f;
+
+  // Event has no value or a valid numerical value
+  bool valueValid = true;
+
+  // Literal string events and clock events need special handling, done by ruleMatch()
+  bool special = false;
+
+  // Literal string events (starting with '!') can match triggers by prefix, so cannot use the trigger index.
+  bool literal = false;
+
+  // Hash of the lower case event name, used to look up triggers in the trigger index.
+  // The second one is the name part as split by findCompareCondition(), which may differ from the part before '='.
+  uint32_t nameHash    = 0;
+  uint32_t compareHash = 0;
+};
+
+
+struct RulesCompiledFile {
+  void clear();
+
+  // Reserve memory for the expected number of nodes, based on the file size.
+  void reserve(size_t fileSize);
+
+  void addNode(RulesNode::Type type, const String& text);
+
+  // Add the last added (On) node to the trigger index.
+  // nameLength is the length of the event name part of the (lower case) trigger.
+  void addTrigger(size_t nameLength);
+
+  // Add the last added (On) node to the triggers which must be checked for every event.
+  void addGenericTrigger();
+
+  // Sort the trigger index, must be called after the last trigger has been added.
+  void finalizeIndex();
+
+  // Drop the nodes, but keep the trigger index.
+  void clearNodes();
+
+  // Collect the node indices of all On nodes which may match the event, in file order.
+  // Return false when no trigger can match, so the event does not need to be processed for this rules set.
+  bool getTriggerCandidates(const RulesEventParts& eventParts,
+                            std::vector<uint16_t>& candidates) const;
+
+  static uint32_t hashTriggerName(const char *name,
+                                  size_t      length);
+
+  size_t getMemorySize() const;
+
+  std::vector<RulesNode>nodes;
+
+  struct TriggerIndexEntry {
+    uint32_t nameHash;
+    uint16_t nodeIndex;
+  };
+
+  // On nodes with a static trigger, sorted by hash of the lower case event name.
+  std::vector<TriggerIndexEntry>triggerIndex;
+
+  // On nodes which must be checked for every event. (wildcard or markup in the trigger)
+  std::vector<uint16_t>genericTriggers;
+
+  // Total number of On nodes.
+  uint16_t nrTriggers = 0;
+
+  // Compile step has run since the last change of the rules file.
+  bool compileAttempted = false;
+
+  // Nodes are valid and can be executed instead of reading the file.
+  bool compiled = false;
+
+  // Trigger index is valid. May still be valid when nodes have been dropped.
+  bool indexed = false;
+
+  // Incremented on every clear(), to detect a recompile while executing the nodes.
+  uint16_t revision = 0;
+};
+
+
+/*********************************************************************************************\
+* Read a rules file line by line.
+* Leading whitespace and everything after "//" is stripped per line.
+* Only lines terminated by a newline are returned.
+\*********************************************************************************************/
+struct RulesFileLineReader {
+  RulesFileLineReader(fs::File& file, size_t lineReserve);
+
+  bool readLine(String& line);
+
+private:
+
+  fs::File& _file;
+  std::vector<uint8_t>_buf;
+  size_t _bufLength = 0;
+  size_t _bufPos    = 0;
+  size_t _lineReserve;
+};
+
+
+#endif // DATASTRUCTS_RULESCOMPILED_H
@@ -0,0 +1,65 @@
+#include "../DataStructs/SerialWriteBuffer.h"
+
+#include <string.h>
+
+SerialWriteBuffer::SerialWriteBuffer() : droppedBytes(0), _head(0), _count(0) {}
+
+size_t SerialWriteBuffer::add(const char *data, size_t length) {
+  const size_t available = getFree();
+
+  if (length > available) {
+    droppedBytes += length - available;
+    length        = available;
+  }
+  size_t added = 0;
+
+  while (added < length) {
+    const size_t tail = (_head + _count) % SERIAL_WRITE_BUFFER_SIZE;
+    size_t step       = SERIAL_WRITE_BUFFER_SIZE - tail;
+
+    if (step > (length - added)) { step = length - added; }
+    memcpy(_buffer + tail, data + added, step);
+    _count += step;
+    added  += step;
+  }
+  return added;
+}
+
+size_t SerialWriteBuffer::add(const char *line) {
+  return add(line, strlen(line));
+}
+
+size_t SerialWriteBuffer::getContiguous(const char *& data) const {
+  data = _buffer + _head;
+  const size_t untilEnd = SERIAL_WRITE_BUFFER_SIZE - _head;
+
+  return (_count < untilEnd) ? _count : untilEnd;
+}
+
+void SerialWriteBuffer::consume(size_t length) {
+  if (length > _count) { length = _count; }
+  _head   = (_head + length) % SERIAL_WRITE_BUFFER_SIZE;
+  _count -= length;
+
+  if (_count == 0) {
+    // Start at the beginning, so the next block is as large as possible.
+    _head = 0;
+  }
+}
+
+size_t SerialWriteBuffer::size() const {
+  return _count;
+}
+
+size_t SerialWriteBuffer::getFree() const {
+  return SERIAL_WRITE_BUFFER_SIZE - _count;
+}
+
+bool SerialWriteBuffer::empty() const {
+  return _count == 0;
+}
+
+void SerialWriteBuffer::clear() {
+  _head  = 0;
+  _count = 0;
+}
@@ -0,0 +1,53 @@
+#ifndef DATASTRUCTS_SERIALWRITEBUFFER_H
+#define DATASTRUCTS_SERIALWRITEBUFFER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*********************************************************************************************\
+* SerialWriteBuffer
+*
+* Fixed capacity ring buffer of data waiting to be sent via the serial port.
+* The data is handed to Serial.write() in contiguous blocks.
+* When the buffer is full, new data is dropped and counted in droppedBytes.
+\*********************************************************************************************/
+#ifdef ESP32
+# define SERIAL_WRITE_BUFFER_SIZE  1024
+#else // ifdef ESP32
+# define SERIAL_WRITE_BUFFER_SIZE  512
+#endif // ifdef ESP32
+
+struct SerialWriteBuffer {
+  SerialWriteBuffer();
+
+  // Return the number of bytes added, the rest is dropped.
+  size_t   add(const char *data,
+               size_t      length);
+
+  size_t   add(const char *line);
+
+  // Largest contiguous block of data at the front of the buffer.
+  // Return the size of the block, 0 when empty.
+  size_t   getContiguous(const char *& data) const;
+
+  // Remove data from the front of the buffer, after it has been sent.
+  void     consume(size_t length);
+
+  size_t   size() const;
+
+  size_t   getFree() const;
+
+  bool     empty() const;
+
+  void     clear();
+
+  uint32_t droppedBytes;
+
+private:
+
+  char   _buffer[SERIAL_WRITE_BUFFER_SIZE];
+  size_t _head;  // Position of the first byte to send
+  size_t _count; // Number of bytes in the buffer
+};
+
+#endif // DATASTRUCTS_SERIALWRITEBUFFER_H
@@ -112,6 +112,26 @@ void SettingsStruct_tmpl<N_TASKS>::SendToHttp_ack(bool value) {
   bitWrite(VariousBits1, 10, value);
 }
 
+template<unsigned int N_TASKS>
+bool SettingsStruct_tmpl<N_TASKS>::CoalesceRulesEvents() const {
+  return bitRead(VariousBits1, 11);
+}
+
+template<unsigned int N_TASKS>
+void SettingsStruct_tmpl<N_TASKS>::CoalesceRulesEvents(bool value) {
+  bitWrite(VariousBits1, 11, value);
+}
+
+template<unsigned int N_TASKS>
+bool SettingsStruct_tmpl<N_TASKS>::RulesEventQueueDropNewest() const {
+  return bitRead(VariousBits1, 12);
+}
+
+template<unsigned int N_TASKS>
+void SettingsStruct_tmpl<N_TASKS>::RulesEventQueueDropNewest(bool value) {
+  bitWrite(VariousBits1, 12, value);
+}
+
 template<unsigned int N_TASKS>
 void SettingsStruct_tmpl<N_TASKS>::validate() {
   if (UDPPort > 65535) { UDPPort = 0; }
@@ -126,6 +146,8 @@ void SettingsStruct_tmpl<N_TASKS>::validate() {
 
   if ((I2C_clockSpeed == 0) || (I2C_clockSpeed > 3400000)) { I2C_clockSpeed = DEFAULT_I2C_CLOCK_SPEED; }
   if (WebserverPort == 0) { WebserverPort = 80;}
+  if (RulesEventsTimeBudget == 0) { RulesEventsTimeBudget = DEFAULT_RULES_EVENTS_TIME_BUDGET; }
+  if (RulesEventQueueSize == 0) { RulesEventQueueSize = DEFAULT_RULES_EVENT_QUEUE_SIZE; }
 }
 
 template<unsigned int N_TASKS>
@@ -220,6 +242,8 @@ void SettingsStruct_tmpl<N_TASKS>::clearMisc() {
   WireClockStretchLimit            = 0;
   I2C_clockSpeed                   = 400000;
   WebserverPort                    = 80;
+  RulesEventsTimeBudget            = DEFAULT_RULES_EVENTS_TIME_BUDGET;
+  RulesEventQueueSize              = DEFAULT_RULES_EVENT_QUEUE_SIZE;
   GlobalSync                       = false;
   ConnectionFailuresThreshold      = 0;
   MQTTRetainFlag_unused            = false;
@@ -241,6 +265,8 @@ void SettingsStruct_tmpl<N_TASKS>::clearMisc() {
   gratuitousARP(DEFAULT_GRATUITOUS_ARP);
   TolerantLastArgParse(DEFAULT_TOLERANT_LAST_ARG_PARSE);
   SendToHttp_ack(DEFAULT_SEND_TO_HTTP_ACK);
+  CoalesceRulesEvents(DEFAULT_RULES_COALESCE_EVENTS);
+  RulesEventQueueDropNewest(DEFAULT_RULES_EVENT_QUEUE_DROP_NEWEST);
 }
 
 template<unsigned int N_TASKS>
@@ -56,6 +56,14 @@ class SettingsStruct_tmpl
   bool SendToHttp_ack() const;
   void SendToHttp_ack(bool value);
 
+  // Replace the value of a pending rules event with the same name, instead of queueing it again.
+  bool CoalesceRulesEvents() const;
+  void CoalesceRulesEvents(bool value);
+
+  // Drop new rules events when the event queue is full, instead of the oldest queued event.
+  bool RulesEventQueueDropNewest() const;
+  void RulesEventQueueDropNewest(bool value);
+
   void validate();
 
   bool networkSettingsEmpty() const;
@@ -176,7 +184,8 @@ class SettingsStruct_tmpl
   uint32_t      ResetFactoryDefaultPreference; // Do not clear this one in the clearAll()
   uint32_t      I2C_clockSpeed;
   uint16_t      WebserverPort;
-  uint16_t      unused;
+  uint8_t       RulesEventsTimeBudget; // Max. time in msec to process queued rules events per 100 msec.
+  uint8_t       RulesEventQueueSize;   // Max. number of queued rules events.
 
   // FIXME @TD-er: As discussed in #1292, the CRC for the settings is now disabled.
   // make sure crc is the last value in the struct
@@ -95,6 +95,11 @@
 # define DAT_EXTDCONTR_CRED_SIZE     1024
 #endif // ifndef DAT_EXTDCONTR_CRED_SIZE
 
+// Chunk size used to write settings to the file system, equal to the SPIFFS/LittleFS page size.
+#ifndef FILE_WRITE_PAGE_SIZE
+# define FILE_WRITE_PAGE_SIZE        256
+#endif // ifndef FILE_WRITE_PAGE_SIZE
+
 
 /*
 
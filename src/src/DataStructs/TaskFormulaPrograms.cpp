@@ -0,0 +1,43 @@
+#include "../DataStructs/TaskFormulaPrograms.h"
+
+// Index of the variable name matches the order of the values passed to CalculateProgram::execute()
+static const char *const formulaVariableNames[] = { "%value%", "%pvalue%" };
+
+TaskFormulaPrograms::TaskFormulaPrograms()
+{
+  for (byte varNr = 0; varNr < VARS_PER_TASK; ++varNr) {
+    errors[varNr] = CALCULATE_OK;
+  }
+}
+
+void TaskFormulaPrograms::compile(const ExtraTaskSettingsStruct& settings)
+{
+  for (byte varNr = 0; varNr < VARS_PER_TASK; ++varNr) {
+    if (settings.TaskDeviceFormula[varNr][0] != 0) {
+      errors[varNr] = programs[varNr].compile(settings.TaskDeviceFormula[varNr], formulaVariableNames, 2);
+    } else {
+      programs[varNr].clear();
+      errors[varNr] = CALCULATE_OK;
+    }
+  }
+}
+
+bool TaskFormulaPrograms::hasFormula(byte varNr) const
+{
+  if (varNr >= VARS_PER_TASK) { return false; }
+
+  // An empty formula or a formula with errors will also be considered "not present".
+  return !programs[varNr].isEmpty();
+}
+
+int TaskFormulaPrograms::calculate(byte varNr, float value, float pvalue, float& result) const
+{
+  if (varNr >= VARS_PER_TASK) { return CALCULATE_ERROR_UNKNOWN_TOKEN; }
+
+  if (errors[varNr] != CALCULATE_OK) {
+    return errors[varNr];
+  }
+  const float variables[] = { value, pvalue };
+  result = programs[varNr].execute(variables);
+  return CALCULATE_OK;
+}
@@ -0,0 +1,34 @@
+#ifndef DATASTRUCTS_TASKFORMULAPROGRAMS_H
+#define DATASTRUCTS_TASKFORMULAPROGRAMS_H
+
+#include <Arduino.h>
+
+#include "../DataStructs/ESPEasyLimits.h"
+#include "../DataStructs/ExtraTaskSettingsStruct.h"
+#include "../Helpers/Calculate.h"
+
+/*********************************************************************************************\
+* TaskFormulaPrograms
+* Compiled task value formulas, so a formula does not need to be parsed on every PLUGIN_READ.
+* The formula variables %value% and %pvalue% are bound when executing.
+\*********************************************************************************************/
+struct TaskFormulaPrograms {
+  TaskFormulaPrograms();
+
+  void compile(const ExtraTaskSettingsStruct& settings);
+
+  bool hasFormula(byte varNr) const;
+
+  // Returns one of the CALCULATE_* values, result is only set when CALCULATE_OK.
+  int  calculate(byte   varNr,
+                 float  value,
+                 float  pvalue,
+                 float& result) const;
+
+private:
+
+  CalculateProgram programs[VARS_PER_TASK];
+  uint8_t errors[VARS_PER_TASK];
+};
+
+#endif // DATASTRUCTS_TASKFORMULAPROGRAMS_H
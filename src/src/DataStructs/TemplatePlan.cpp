@@ -0,0 +1,194 @@
+#include "../DataStructs/TemplatePlan.h"
+
+#include "../DataStructs/ESPEasyLimits.h"
+#include "../Helpers/ESPEasy_time.h"
+#include "../Helpers/SystemVariables.h"
+
+namespace {
+uint32_t hashTemplate(const String& text)
+{
+  // FNV-1a
+  uint32_t hash = 2166136261u;
+
+  for (size_t i = 0; i < text.length(); ++i) {
+    hash ^= static_cast<uint8_t>(text[i]);
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+// Match "%vN%" with N in 1 ... CUSTOM_VARS_MAX, without leading zeroes.
+// Return the 0-based variable index, or -1 when not matched.
+int matchCustomVar(const String& text, int start, int end)
+{
+  if ((end - start) < 3 || (text[start + 1] != 'v') || (text[start + 2] == '0')) {
+    return -1;
+  }
+  int varNum = 0;
+
+  for (int i = start + 2; i < end; ++i) {
+    if (!isDigit(text[i])) {
+      return -1;
+    }
+    varNum = varNum * 10 + (text[i] - '0');
+
+    if (varNum > CUSTOM_VARS_MAX) {
+      return -1;
+    }
+  }
+  return (varNum > 0) ? varNum - 1 : -1;
+}
+} // namespace
+
+
+void TemplatePlan::clear()
+{
+  // Swap with empty vector to actually free the memory.
+  std::vector<TemplateSegment>().swap(segments);
+  literalLength     = 0;
+  hasConversions    = false;
+  hasStringCommands = false;
+  legacy            = false;
+}
+
+void TemplatePlan::addText(const String& text)
+{
+  if (text.indexOf(F("%c_")) != -1) {
+    hasConversions = true;
+  }
+
+  if (text.indexOf('{') != -1) {
+    hasStringCommands = true;
+  }
+
+  int literalStart = 0;
+  int pos          = text.indexOf('%');
+
+  while (pos != -1) {
+    const int end = text.indexOf('%', pos + 1);
+
+    if (end == -1) {
+      break;
+    }
+    bool matched = false;
+
+    const int varIndex = matchCustomVar(text, pos, end);
+
+    if (varIndex >= 0) {
+      addLiteral(text, literalStart, pos);
+      TemplateSegment segment(TemplateSegment::Type::CustomVar);
+      segment.index = varIndex;
+      addSegment(std::move(segment));
+      matched = true;
+    } else {
+      const size_t markerLength = end - pos + 1;
+
+      for (int i = 0; i < SystemVariables::Enum::UNKNOWN && !matched; ++i) {
+        const SystemVariables::Enum enumval = static_cast<SystemVariables::Enum>(i);
+        const String name                   = SystemVariables::toString(enumval);
+
+        if ((enumval == SystemVariables::Enum::SUNRISE) || (enumval == SystemVariables::Enum::SUNSET)) {
+          // Marker may contain an offset, like "%sunrise-1h%"
+          if (text.startsWith(name, pos)) {
+            addLiteral(text, literalStart, pos);
+            TemplateSegment segment(TemplateSegment::Type::SunTime);
+            segment.index  = enumval;
+            segment.offset = ESPEasy_time::getSecOffset(text.substring(pos, end + 1));
+            addSegment(std::move(segment));
+            matched = true;
+          }
+        } else if ((name.length() == markerLength) && text.startsWith(name, pos)) {
+          addLiteral(text, literalStart, pos);
+          TemplateSegment segment(TemplateSegment::Type::SystemVariable);
+          segment.index = enumval;
+          addSegment(std::move(segment));
+          matched = true;
+        }
+      }
+    }
+
+    if (matched) {
+      literalStart = end + 1;
+      pos          = text.indexOf('%', literalStart);
+    } else {
+      // The closing '%' may be the start of the next marker.
+      pos = end;
+    }
+  }
+  addLiteral(text, literalStart, text.length());
+}
+
+void TemplatePlan::addLiteral(const String& text, int start, int end)
+{
+  if (end <= start) {
+    return;
+  }
+
+  if (!segments.empty() && (segments.back().type == TemplateSegment::Type::Literal)) {
+    segments.back().text += text.substring(start, end);
+  } else {
+    TemplateSegment segment(TemplateSegment::Type::Literal);
+    segment.text = text.substring(start, end);
+    segments.push_back(std::move(segment));
+  }
+  literalLength += end - start;
+}
+
+void TemplatePlan::addSegment(TemplateSegment&& segment)
+{
+  segments.push_back(std::move(segment));
+}
+
+size_t TemplatePlan::getMemorySize() const
+{
+  size_t res = segments.capacity() * sizeof(TemplateSegment);
+
+  for (auto it = segments.begin(); it != segments.end(); ++it) {
+    res += it->text.length() + it->valueName.length() + it->format.length();
+  }
+  return res;
+}
+
+TemplatePlanCache::TemplatePlanCache() {}
+
+TemplatePlan * TemplatePlanCache::find(const String& templateText)
+{
+  const uint32_t hash = hashTemplate(templateText);
+
+  for (size_t i = 0; i < TEMPLATE_PLAN_CACHE_SIZE; ++i) {
+    if ((_entries[i].lastUsed != 0) && (_entries[i].hash == hash) &&
+        _entries[i].templateText.equals(templateText)) {
+      ++hits;
+      _entries[i].lastUsed = ++_useCounter;
+      return &_entries[i].plan;
+    }
+  }
+  ++misses;
+  return nullptr;
+}
+
+TemplatePlan& TemplatePlanCache::insert(const String& templateText)
+{
+  // Replace the least recently used entry
+  Entry *entry = &_entries[0];
+
+  for (size_t i = 1; i < TEMPLATE_PLAN_CACHE_SIZE; ++i) {
+    if (_entries[i].lastUsed < entry->lastUsed) {
+      entry = &_entries[i];
+    }
+  }
+  entry->templateText = templateText;
+  entry->hash         = hashTemplate(templateText);
+  entry->lastUsed     = ++_useCounter;
+  entry->plan.clear();
+  return entry->plan;
+}
+
+void TemplatePlanCache::clear()
+{
+  for (size_t i = 0; i < TEMPLATE_PLAN_CACHE_SIZE; ++i) {
+    _entries[i].templateText = String();
+    _entries[i].plan.clear();
+    _entries[i].lastUsed = 0;
+  }
+}
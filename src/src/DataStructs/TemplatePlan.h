@@ -0,0 +1,109 @@
+#ifndef DATASTRUCTS_TEMPLATEPLAN_H
+#define DATASTRUCTS_TEMPLATEPLAN_H
+
+#include "../../ESPEasy_common.h"
+#include "../Globals/Plugins.h"
+
+#include <vector>
+
+/*********************************************************************************************\
+* Template plan
+*
+* A template (e.g. "%sysname% [bme#temp#R]") is split once into literal spans and typed
+* placeholders, so rendering does not need to search the text for system variables
+* and [task#value] markers again.
+* Plans are kept in a small LRU cache, keyed by the template text.
+\*********************************************************************************************/
+
+#ifndef TEMPLATE_PLAN_CACHE_SIZE
+# ifdef ESP32
+#  define TEMPLATE_PLAN_CACHE_SIZE  16
+# else // ifdef ESP32
+#  define TEMPLATE_PLAN_CACHE_SIZE  8
+# endif // ifdef ESP32
+#endif // ifndef TEMPLATE_PLAN_CACHE_SIZE
+
+struct TemplateSegment {
+  enum class Type : uint8_t {
+    Literal,        // text = literal text
+    SystemVariable, // index = SystemVariables::Enum
+    SunTime,        // index = SystemVariables::Enum (SUNRISE/SUNSET), offset in seconds
+    CustomVar,      // %v1% ... index = variable index (0-based)
+    TaskValue,      // [task#value#format] taskIndex, index = value index
+    Variable,       // [var#N#format] or [int#N#format] index = variable index (0-based)
+    DevVal          // Any other [...#...], looked up when rendering. text = device name
+  };
+
+  TemplateSegment(Type segmentType) : type(segmentType) {}
+
+  String  text;
+  String  valueName; // DevVal only
+  String  format;    // Format part of [...#...#format]
+  int32_t offset = 0;
+  Type    type;
+  uint8_t index     = 0;
+  taskIndex_t taskIndex = INVALID_TASK_INDEX;
+  bool    asInt     = false;
+};
+
+
+struct TemplatePlan {
+  void clear();
+
+  // Add literal text, which will be split in literal spans and system variables.
+  void addText(const String& text);
+
+  void addSegment(TemplateSegment&& segment);
+
+  size_t getMemorySize() const;
+
+  std::vector<TemplateSegment>segments;
+
+  // Total length of the literal spans, used to reserve the output string.
+  size_t literalLength = 0;
+
+  // The template contains markup which must be handled after rendering.
+  bool hasConversions    = false; // %c_...%
+  bool hasStringCommands = false; // {...}
+
+  // The template cannot be represented as plan and must be parsed every time.
+  bool legacy = false;
+
+private:
+
+  void addLiteral(const String& text,
+                  int           start,
+                  int           end);
+};
+
+
+struct TemplatePlanCache {
+  TemplatePlanCache();
+
+  // Return the cached plan of the template, or nullptr when not present.
+  TemplatePlan* find(const String& templateText);
+
+  // Return an empty plan for the template, replacing the least recently used entry.
+  TemplatePlan& insert(const String& templateText);
+
+  void          clear();
+
+  // Statistics
+  unsigned long hits   = 0;
+  unsigned long misses = 0;
+
+private:
+
+  struct Entry {
+    String       templateText;
+    TemplatePlan plan;
+    uint32_t     hash     = 0;
+    uint32_t     lastUsed = 0;
+  };
+
+  Entry _entries[TEMPLATE_PLAN_CACHE_SIZE];
+  uint32_t _useCounter = 0;
+};
+
+
+#endif // DATASTRUCTS_TEMPLATEPLAN_H
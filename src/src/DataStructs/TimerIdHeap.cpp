@@ -0,0 +1,227 @@
+#include "../DataStructs/TimerIdHeap.h"
+
+#include "../Helpers/ESPEasy_time_calc.h"
+
+#include <utility>
+
+TimerIdHeap::TimerIdHeap(size_t initialCapacity)
+{
+  _heap.reserve(initialCapacity);
+  size_t nrSlots = 8;
+
+  while (nrSlots < 2 * initialCapacity) {
+    nrSlots <<= 1;
+  }
+  rehash(nrSlots);
+}
+
+void TimerIdHeap::set(unsigned long id, unsigned long timer)
+{
+  const int slot = findSlot(id);
+
+  if (slot >= 0) {
+    // Reschedule
+    const size_t        pos      = _slots[slot] - 1;
+    const unsigned long oldTimer = _heap[pos].timer;
+    _heap[pos].timer = timer;
+
+    if (earlier(timer, oldTimer)) {
+      siftUp(pos);
+    } else {
+      siftDown(pos);
+    }
+    return;
+  }
+
+  if (2 * (_heap.size() + 1) > _slots.size()) {
+    rehash(2 * _slots.size());
+  }
+  const size_t mask = _slots.size() - 1;
+  size_t newSlot    = hashSlot(id);
+
+  while (_slots[newSlot] != 0) {
+    newSlot = (newSlot + 1) & mask;
+  }
+  _heap.push_back({ timer, id, static_cast<uint16_t>(newSlot) });
+  _slots[newSlot] = _heap.size();
+  siftUp(_heap.size() - 1);
+}
+
+bool TimerIdHeap::remove(unsigned long id)
+{
+  const int slot = findSlot(id);
+
+  if (slot < 0) {
+    return false;
+  }
+  removeAt(_slots[slot] - 1);
+  return true;
+}
+
+bool TimerIdHeap::contains(unsigned long id) const
+{
+  return findSlot(id) >= 0;
+}
+
+const TimerIdHeap::Entry& TimerIdHeap::top() const
+{
+  return _heap.front();
+}
+
+void TimerIdHeap::pop()
+{
+  if (!_heap.empty()) {
+    removeAt(0);
+  }
+}
+
+bool TimerIdHeap::empty() const
+{
+  return _heap.empty();
+}
+
+size_t TimerIdHeap::size() const
+{
+  return _heap.size();
+}
+
+void TimerIdHeap::clear()
+{
+  _heap.clear();
+
+  for (size_t i = 0; i < _slots.size(); ++i) {
+    _slots[i] = 0;
+  }
+}
+
+bool TimerIdHeap::earlier(unsigned long a, unsigned long b)
+{
+  return timeDiff(b, a) < 0;
+}
+
+size_t TimerIdHeap::hashSlot(unsigned long id) const
+{
+  // Fibonacci hashing, the mixed scheduler ids differ mainly in the lower bits.
+  const uint32_t hash = static_cast<uint32_t>(id) * 2654435761u;
+
+  return (hash ^ (hash >> 16)) & (_slots.size() - 1);
+}
+
+int TimerIdHeap::findSlot(unsigned long id) const
+{
+  const size_t mask = _slots.size() - 1;
+
+  for (size_t slot = hashSlot(id); _slots[slot] != 0; slot = (slot + 1) & mask) {
+    if (_heap[_slots[slot] - 1].id == id) {
+      return slot;
+    }
+  }
+  return -1;
+}
+
+void TimerIdHeap::rehash(size_t nrSlots)
+{
+  _slots.assign(nrSlots, 0);
+  const size_t mask = nrSlots - 1;
+
+  for (size_t pos = 0; pos < _heap.size(); ++pos) {
+    size_t slot = hashSlot(_heap[pos].id);
+
+    while (_slots[slot] != 0) {
+      slot = (slot + 1) & mask;
+    }
+    _slots[slot]    = pos + 1;
+    _heap[pos].slot = slot;
+  }
+}
+
+void TimerIdHeap::eraseSlot(size_t slot)
+{
+  // Backward shift deletion, to keep the probe sequences intact without tombstones.
+  const size_t mask = _slots.size() - 1;
+  size_t hole       = slot;
+  size_t next       = slot;
+
+  while (true) {
+    next = (next + 1) & mask;
+
+    if (_slots[next] == 0) {
+      break;
+    }
+    const size_t home = hashSlot(_heap[_slots[next] - 1].id);
+
+    // Entry may stay when its home slot is cyclically in (hole, next]
+    const bool stay = (hole <= next) ?
+                      ((hole < home) && (home <= next)) :
+                      ((hole < home) || (home <= next));
+
+    if (!stay) {
+      _slots[hole]                 = _slots[next];
+      _heap[_slots[hole] - 1].slot = hole;
+      hole                         = next;
+    }
+  }
+  _slots[hole] = 0;
+}
+
+void TimerIdHeap::removeAt(size_t pos)
+{
+  eraseSlot(_heap[pos].slot);
+  const size_t last = _heap.size() - 1;
+
+  if (pos != last) {
+    _heap[pos]              = _heap[last];
+    _slots[_heap[pos].slot] = pos + 1;
+  }
+  _heap.pop_back();
+
+  if (pos < _heap.size()) {
+    siftUp(pos);
+    siftDown(pos);
+  }
+}
+
+void TimerIdHeap::swapEntries(size_t a, size_t b)
+{
+  std::swap(_heap[a], _heap[b]);
+  _slots[_heap[a].slot] = a + 1;
+  _slots[_heap[b].slot] = b + 1;
+}
+
+void TimerIdHeap::siftUp(size_t pos)
+{
+  while (pos > 0) {
+    const size_t parent = (pos - 1) / 2;
+
+    if (!earlier(_heap[pos].timer, _heap[parent].timer)) {
+      return;
+    }
+    swapEntries(pos, parent);
+    pos = parent;
+  }
+}
+
+void TimerIdHeap::siftDown(size_t pos)
+{
+  const size_t size = _heap.size();
+
+  while (true) {
+    const size_t left  = 2 * pos + 1;
+    const size_t right = left + 1;
+    size_t first       = pos;
+
+    if ((left < size) && earlier(_heap[left].timer, _heap[first].timer)) {
+      first = left;
+    }
+
+    if ((right < size) && earlier(_heap[right].timer, _heap[first].timer)) {
+      first = right;
+    }
+
+    if (first == pos) {
+      return;
+    }
+    swapEntries(pos, first);
+    pos = first;
+  }
+}
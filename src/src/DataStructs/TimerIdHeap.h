@@ -0,0 +1,78 @@
+#ifndef DATASTRUCTS_TIMERIDHEAP_H
+#define DATASTRUCTS_TIMERIDHEAP_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+/*********************************************************************************************\
+* TimerIdHeap
+*
+* Binary min-heap of scheduled timers, ordered by timer (wrap-around safe).
+* Every id is present at most once. An open addressing hash table maps the id to
+* its position in the heap, so set and remove by id are O(log n).
+* Storage only grows when more timers are present than ever before,
+* so there are no heap allocations when rescheduling existing timers.
+\*********************************************************************************************/
+struct TimerIdHeap {
+  struct Entry {
+    unsigned long timer;
+    unsigned long id;
+    uint16_t      slot; // Position in the hash table
+  };
+
+  TimerIdHeap(size_t initialCapacity);
+
+  // Add a timer, or reschedule when a timer with the same id is present.
+  void         set(unsigned long id,
+                   unsigned long timer);
+
+  // Remove the timer with given id.
+  // Return false when not present.
+  bool         remove(unsigned long id);
+
+  bool         contains(unsigned long id) const;
+
+  // Entry with the first timer to expire. Only allowed when not empty.
+  const Entry& top() const;
+
+  void         pop();
+
+  bool         empty() const;
+
+  size_t       size() const;
+
+  void         clear();
+
+private:
+
+  // Return true when timer a expires before timer b.
+  static bool earlier(unsigned long a,
+                      unsigned long b);
+
+  size_t      hashSlot(unsigned long id) const;
+
+  // Return the slot in the hash table of id, or -1 when not present.
+  int         findSlot(unsigned long id) const;
+
+  void        rehash(size_t nrSlots);
+
+  void        eraseSlot(size_t slot);
+
+  void        removeAt(size_t pos);
+
+  void        swapEntries(size_t a,
+                          size_t b);
+
+  void        siftUp(size_t pos);
+
+  void        siftDown(size_t pos);
+
+  std::vector<Entry>_heap;
+
+  // Hash table with heap position + 1 of the entries, 0 = empty slot.
+  // Size is a power of 2 and at least twice the number of entries.
+  std::vector<uint16_t>_slots;
+};
+
+#endif // DATASTRUCTS_TIMERIDHEAP_H
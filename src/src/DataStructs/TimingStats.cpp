@@ -1,4 +1,5 @@
 #include "../DataStructs/TimingStats.h"
+#include "../DataStructs/TimingTrace.h"
 #include "../../ESPEasy_common.h"
 #include "../../ESPEasy_plugindefs.h"
 #include "../../_CPlugin_Helper.h"
@@ -10,12 +11,29 @@
 std::map<int, TimingStats> pluginStats;
 std::map<int, TimingStats> controllerStats;
 std::map<int, TimingStats> miscStats;
+TimingStatsWorst timingStatsWorst;
 unsigned long timingstats_last_reset(0);
 
 
 
 
-TimingStats::TimingStats() : _timeTotal(0.0), _count(0), _maxVal(0), _minVal(4294967295) {}
+TimingStats::TimingStats() {
+  reset();
+}
+
+namespace {
+byte getHistogramBucket(unsigned long time) {
+  if (time < 8) { return 0; }
+
+  // Index of the highest bit set, time >= 8 so at least 3.
+  const byte bucket = (31 - __builtin_clz(static_cast<uint32_t>(time))) - 2;
+
+  if (bucket >= TIMING_STATS_NR_BUCKETS) {
+    return TIMING_STATS_NR_BUCKETS - 1;
+  }
+  return bucket;
+}
+} // namespace
 
 void TimingStats::add(unsigned long time) {
   _timeTotal += static_cast<float>(time);
@@ -24,13 +42,24 @@ void TimingStats::add(unsigned long time) {
   if (time > _maxVal) { _maxVal = time; }
 
   if (time < _minVal) { _minVal = time; }
+
+  const byte bucket = getHistogramBucket(time);
+
+  if (_histogram[bucket] == 0xFFFF) {
+    for (byte i = 0; i < TIMING_STATS_NR_BUCKETS; ++i) {
+      _histogram[i] = (_histogram[i] + 1) / 2;
+    }
+  }
+  ++_histogram[bucket];
 }
 
 void TimingStats::reset() {
-  _timeTotal = 0.0;
-  _count     = 0;
-  _maxVal    = 0;
-  _minVal    = 4294967295;
+  _timeTotal  = 0.0;
+  _count      = 0;
+  _maxVal     = 0;
+  _minVal     = 4294967295;
+  _bytesTotal = 0.0;
+  memset(_histogram, 0, sizeof(_histogram));
 }
 
 bool TimingStats::isEmpty() const {
@@ -60,6 +89,90 @@ bool TimingStats::thresholdExceeded(unsigned long threshold) const {
   return _maxVal > threshold;
 }
 
+unsigned long TimingStats::getPercentile(byte percentile) const {
+  if (_count == 0) { return 0; }
+
+  if (percentile > 100) { percentile = 100; }
+  uint32_t total = 0;
+
+  for (byte i = 0; i < TIMING_STATS_NR_BUCKETS; ++i) {
+    total += _histogram[i];
+  }
+
+  // Rank of the sample, rounded up so p100 is the last sample.
+  const uint32_t rank = (total * percentile + 99) / 100;
+  uint32_t cumulative = 0;
+
+  for (byte i = 0; i < (TIMING_STATS_NR_BUCKETS - 1); ++i) {
+    cumulative += _histogram[i];
+
+    if ((cumulative >= rank) && (cumulative > 0)) {
+      const unsigned long upperBound = (1ul << (i + 3)) - 1;
+
+      if (upperBound > _maxVal) { return _maxVal; }
+
+      if (upperBound < _minVal) { return _minVal; }
+      return upperBound;
+    }
+  }
+  return _maxVal;
+}
+
+void TimingStats::addBytes(unsigned long bytes) {
+  _bytesTotal += static_cast<float>(bytes);
+}
+
+bool TimingStats::hasBytes() const {
+  return _bytesTotal > 0.0;
+}
+
+float TimingStats::getBytesPerSec() const {
+  if (_timeTotal < 1.0) { return 0.0; }
+
+  // Time is in usec
+  return _bytesTotal * 1000000.0 / _timeTotal;
+}
+
+void TimingStatsWorst::add(byte kind, int key, unsigned long duration) {
+  if ((_count == TIMING_STATS_WORST_NR) && (duration <= _entries[TIMING_STATS_WORST_NR - 1].duration)) {
+    // Not slower than the fastest one kept.
+    return;
+  }
+  byte pos = (_count < TIMING_STATS_WORST_NR) ? _count++ : TIMING_STATS_WORST_NR - 1;
+
+  // Shift the faster entries one position to keep the list sorted.
+  while (pos > 0 && _entries[pos - 1].duration < duration) {
+    _entries[pos] = _entries[pos - 1];
+    --pos;
+  }
+  _entries[pos].duration  = duration;
+  _entries[pos].timestamp = millis();
+  _entries[pos].key       = key;
+  _entries[pos].kind      = kind;
+}
+
+void TimingStatsWorst::reset() {
+  _count = 0;
+}
+
+byte TimingStatsWorst::size() const {
+  return _count;
+}
+
+const TimingStatsWorstEntry& TimingStatsWorst::operator[](byte index) const {
+  return _entries[index];
+}
+
+void timingStats_add(std::map<int, TimingStats>& stats, byte kind, int key, unsigned long timerStart) {
+  const unsigned long duration = usecPassedSince(timerStart);
+
+  stats[key].add(duration);
+  timingStatsWorst.add(kind, key, duration);
+  # ifdef USES_TIMING_TRACE
+  timingTrace.add(kind, key, timerStart, duration);
+  # endif // ifdef USES_TIMING_TRACE
+}
+
 /********************************************************************************************\
    Functions used for displaying timing stats
  \*********************************************************************************************/
@@ -201,6 +314,7 @@ String getMiscStatsName(int stat) {
     case SENSOR_SEND_TASK:        return F("SensorSendTask()");
     case SEND_DATA_STATS:         return F("sendData()");
     case COMPUTE_FORMULA_STATS:   return F("Compute formula");
+    case COMPILE_FORMULA_STATS:   return F("Compile formula");
     case PROC_SYS_TIMER:          return F("proc_system_timer()");
     case SET_NEW_TIMER:           return F("setNewTimerAt()");
     case TIME_DIFF_COMPUTE:       return F("timeDiff()");
@@ -222,9 +336,12 @@ String getMiscStatsName(int stat) {
     case HANDLE_SCHEDULER_IDLE:   return F("handle_schedule() idle");
     case HANDLE_SCHEDULER_TASK:   return F("handle_schedule() task");
     case PARSE_TEMPLATE_PADDED:   return F("parseTemplate_padded()");
+    case COMPILE_TEMPLATE_PLAN:   return F("compileTemplatePlan()");
     case PARSE_SYSVAR:            return F("parseSystemVariables()");
     case PARSE_SYSVAR_NOCHANGE:   return F("parseSystemVariables() No change");
     case HANDLE_SERVING_WEBPAGE:  return F("handle webpage");
+    case RULES_COMPILE:           return F("compileRuleSet()");
+    case RULES_EVENT_QUEUE_WAIT:  return F("eventQueue wait");
     case C001_DELAY_QUEUE:
     case C002_DELAY_QUEUE:
     case C003_DELAY_QUEUE:
@@ -74,6 +74,22 @@
 # define HANDLE_SCHEDULER_IDLE   53
 # define HANDLE_SCHEDULER_TASK   54
 # define HANDLE_SERVING_WEBPAGE  55
+# define RULES_COMPILE           56
+# define COMPILE_FORMULA_STATS   57
+# define COMPILE_TEMPLATE_PLAN   58
+# define RULES_EVENT_QUEUE_WAIT  59
+
+// Kind of timing stats, used to refer to an entry in pluginStats, controllerStats or miscStats.
+# define TIMING_STATS_PLUGIN      0
+# define TIMING_STATS_CONTROLLER  1
+# define TIMING_STATS_MISC        2
+
+// Histogram buckets: bucket 0 holds durations < 8 usec,
+// bucket N holds [2^(N+2) ... 2^(N+3)> usec and the last bucket holds all durations >= 2^21 usec (~2.1 sec).
+# define TIMING_STATS_NR_BUCKETS  20
+
+// Number of slowest calls kept in timingStatsWorst
+# define TIMING_STATS_WORST_NR    8
 
 class TimingStats {
 public:
@@ -88,12 +104,54 @@ public:
                          unsigned long& maxVal) const;
   bool         thresholdExceeded(unsigned long threshold) const;
 
+  // Estimate of the given percentile (0 ... 100) in usec, based on the histogram.
+  // Returns the upper bound of the bucket holding the percentile, limited to the min/max value.
+  unsigned long getPercentile(byte percentile) const;
+
+  // Amount of data processed, used to compute the throughput.
+  void         addBytes(unsigned long bytes);
+  bool         hasBytes() const;
+  float        getBytesPerSec() const;
+
 private:
 
   float _timeTotal;
   unsigned int _count;
   unsigned long _maxVal;
   unsigned long _minVal;
+  float _bytesTotal;
+
+  // Log2 bucketed histogram of the durations.
+  // When a bucket is full, all buckets are halved to keep the distribution.
+  uint16_t _histogram[TIMING_STATS_NR_BUCKETS];
+};
+
+
+/*********************************************************************************************\
+* TimingStatsWorst
+* Slowest calls since the last reset of the timing stats, sorted from slowest to fastest.
+\*********************************************************************************************/
+struct TimingStatsWorstEntry {
+  unsigned long duration  = 0; // usec
+  unsigned long timestamp = 0; // millis() at the end of the call
+  int           key       = 0; // Key in pluginStats, controllerStats or miscStats
+  byte          kind      = TIMING_STATS_MISC;
+};
+
+class TimingStatsWorst {
+public:
+
+  void                         add(byte          kind,
+                                   int           key,
+                                   unsigned long duration);
+  void                         reset();
+  byte                         size() const;
+  const TimingStatsWorstEntry& operator[](byte index) const;
+
+private:
+
+  TimingStatsWorstEntry _entries[TIMING_STATS_WORST_NR];
+  byte _count = 0;
 };
 
 
@@ -103,20 +161,33 @@ String getCPluginCFunctionName(CPlugin::Function function);
 bool   mustLogCFunction(CPlugin::Function function);
 String getMiscStatsName(int stat);
 
+// Add the duration of the call started at timerStart (micros()) to the stats with the given key,
+// keep track of the slowest calls and add it to the trace (when enabled).
+void   timingStats_add(std::map<int, TimingStats>& stats,
+                       byte                        kind,
+                       int                         key,
+                       unsigned long               timerStart);
+
 
 extern std::map<int, TimingStats> pluginStats;
 extern std::map<int, TimingStats> controllerStats;
 extern std::map<int, TimingStats> miscStats;
+extern TimingStatsWorst timingStatsWorst;
 extern unsigned long timingstats_last_reset;
 
 # define START_TIMER const unsigned statisticsTimerStart(micros());
 # define STOP_TIMER_TASK(T, F) \
-  if (mustLogFunction(F)) pluginStats[(T) * 256 + (F)].add(usecPassedSince(statisticsTimerStart));
+  if (mustLogFunction(F)) timingStats_add(pluginStats, TIMING_STATS_PLUGIN, (T) * 256 + (F), statisticsTimerStart);
 # define STOP_TIMER_CONTROLLER(T, F) \
-  if (mustLogCFunction(F)) controllerStats[(T) * 256 + (F)].add(usecPassedSince(statisticsTimerStart));
+  if (mustLogCFunction(F)) timingStats_add(controllerStats, TIMING_STATS_CONTROLLER, (T) * 256 + (F), statisticsTimerStart);
 
 // #define STOP_TIMER_LOADFILE miscStats[LOADFILE_STATS].add(usecPassedSince(statisticsTimerStart));
-# define STOP_TIMER(L) miscStats[L].add(usecPassedSince(statisticsTimerStart));
+# define STOP_TIMER(L) timingStats_add(miscStats, TIMING_STATS_MISC, L, statisticsTimerStart);
+# define STOP_TIMER_BYTES(L, B)                                              \
+  do {                                                                      \
+    timingStats_add(miscStats, TIMING_STATS_MISC, L, statisticsTimerStart); \
+    miscStats[L].addBytes(B);                                               \
+  } while (0)
 
 #else // ifdef USES_TIMING_STATS
 
@@ -124,6 +195,7 @@ extern unsigned long timingstats_last_reset;
 # define STOP_TIMER_TASK(T, F) ;
 # define STOP_TIMER_CONTROLLER(T, F) ;
 # define STOP_TIMER(L) ;
+# define STOP_TIMER_BYTES(L, B) ;
 
 
 // FIXME TD-er: This class is used as a parameter in functions defined in .ino files.
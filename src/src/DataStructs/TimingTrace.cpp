@@ -0,0 +1,52 @@
+#include "../DataStructs/TimingTrace.h"
+
+#ifdef USES_TIMING_TRACE
+
+TimingTrace timingTrace;
+
+TimingTrace::TimingTrace() : overwritten(0), _head(0), _count(0), _recording(false) {}
+
+void TimingTrace::clear() {
+  overwritten = 0;
+  _head       = 0;
+  _count      = 0;
+}
+
+void TimingTrace::setRecording(bool recording) {
+  _recording = recording;
+}
+
+bool TimingTrace::isRecording() const {
+  return _recording;
+}
+
+void TimingTrace::add(uint8_t kind, int key, uint32_t start, uint32_t duration) {
+  if (!_recording) { return; }
+  uint16_t pos;
+
+  if (_count < TIMING_TRACE_NR_EVENTS) {
+    pos = (_head + _count) % TIMING_TRACE_NR_EVENTS;
+    ++_count;
+  } else {
+    // Full, overwrite the oldest event.
+    pos   = _head;
+    _head = (_head + 1) % TIMING_TRACE_NR_EVENTS;
+    ++overwritten;
+  }
+  TimingTraceEvent& event = _events[pos];
+
+  event.start    = start;
+  event.duration = duration;
+  event.key      = static_cast<uint16_t>(key);
+  event.kind     = kind;
+}
+
+uint16_t TimingTrace::size() const {
+  return _count;
+}
+
+const TimingTraceEvent& TimingTrace::operator[](uint16_t index) const {
+  return _events[(_head + index) % TIMING_TRACE_NR_EVENTS];
+}
+
+#endif // ifdef USES_TIMING_TRACE
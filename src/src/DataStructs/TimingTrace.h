@@ -0,0 +1,68 @@
+#ifndef DATASTRUCTS_TIMINGTRACE_H
+#define DATASTRUCTS_TIMINGTRACE_H
+
+#include "../../ESPEasy_common.h"
+
+#ifdef USES_TIMING_TRACE
+
+# include <stdint.h>
+
+/*********************************************************************************************\
+* TimingTrace
+*
+* Fixed size ring of the calls timed via the START_TIMER / STOP_TIMER* macros,
+* to see how the scheduler, plugin and controller calls interleave in time.
+* Each call is stored as a complete event (start + duration), the oldest events are overwritten.
+* Recording is only active when enabled, to have no overhead when no trace is captured.
+\*********************************************************************************************/
+# ifdef ESP32
+#  define TIMING_TRACE_NR_EVENTS  1024
+# else // ifdef ESP32
+#  define TIMING_TRACE_NR_EVENTS  256
+# endif // ifdef ESP32
+
+struct TimingTraceEvent {
+  uint32_t start;    // micros() at the start of the call
+  uint32_t duration; // usec
+  uint16_t key;      // Key in pluginStats, controllerStats or miscStats
+  uint8_t  kind;     // TIMING_STATS_PLUGIN, TIMING_STATS_CONTROLLER or TIMING_STATS_MISC
+};
+
+class TimingTrace {
+public:
+
+  TimingTrace();
+
+  void                    clear();
+
+  void                    setRecording(bool recording);
+
+  bool                    isRecording() const;
+
+  void                    add(uint8_t  kind,
+                              int      key,
+                              uint32_t start,
+                              uint32_t duration);
+
+  // Number of events in the ring.
+  uint16_t                size() const;
+
+  // Index 0 is the oldest event.
+  const TimingTraceEvent& operator[](uint16_t index) const;
+
+  // Number of events overwritten since clear()
+  uint32_t overwritten;
+
+private:
+
+  TimingTraceEvent _events[TIMING_TRACE_NR_EVENTS];
+  uint16_t _head;  // Position of the oldest event
+  uint16_t _count; // Number of events in the ring
+  bool     _recording;
+};
+
+extern TimingTrace timingTrace;
+
+#endif // ifdef USES_TIMING_TRACE
+
+#endif // DATASTRUCTS_TIMINGTRACE_H
@@ -10,112 +10,131 @@
 // FIXME TD-er: Should keep a pointer to the webserver as a member, not use the global defined one.
 #include "../Globals/Services.h"
 
-#define CHUNKED_BUFFER_SIZE          400
-
 Web_StreamingBuffer::Web_StreamingBuffer(void) : lowMemorySkip(false),
   initialRam(0), beforeTXRam(0), duringTXRam(0), finalRam(0), maxCoreUsage(0),
-  maxServerUsage(0), sentBytes(0), flashStringCalls(0), flashStringData(0)
-{
-  buf.reserve(CHUNKED_BUFFER_SIZE + 50);
-  buf = "";
-}
+  maxServerUsage(0), sentBytes(0), flashStringCalls(0), flashStringData(0),
+  lastStreamBytes(0), lastStreamDuration(0), bufLength(0), streamStart(0)
+{}
 
-Web_StreamingBuffer Web_StreamingBuffer::operator=(String& a)                 {
+Web_StreamingBuffer& Web_StreamingBuffer::operator=(const String& a)           {
   flush(); return addString(a);
 }
 
-Web_StreamingBuffer Web_StreamingBuffer::operator=(const String& a)           {
-  flush(); return addString(a);
+Web_StreamingBuffer& Web_StreamingBuffer::operator+=(char a)                   {
+  append(&a, 1);
+  return *this;
 }
 
-Web_StreamingBuffer Web_StreamingBuffer::operator+=(char a)                   {
-  return addString(String(a));
-}
+Web_StreamingBuffer& Web_StreamingBuffer::operator+=(long unsigned int a)     {
+  char tmp[12];
 
-Web_StreamingBuffer Web_StreamingBuffer::operator+=(long unsigned int a)     {
-  return addString(String(a));
+  ultoa(a, tmp, 10);
+  append(tmp, strlen(tmp));
+  return *this;
 }
 
-Web_StreamingBuffer Web_StreamingBuffer::operator+=(float a)                  {
-  return addString(String(a));
+Web_StreamingBuffer& Web_StreamingBuffer::operator+=(float a)                  {
+  // Same format as String(float)
+  char tmp[48];
+
+  dtostrf(a, 4, 2, tmp);
+  append(tmp, strlen(tmp));
+  return *this;
 }
 
-Web_StreamingBuffer Web_StreamingBuffer::operator+=(int a)                    {
-  return addString(String(a));
+Web_StreamingBuffer& Web_StreamingBuffer::operator+=(int a)                    {
+  char tmp[12];
+
+  itoa(a, tmp, 10);
+  append(tmp, strlen(tmp));
+  return *this;
 }
 
-Web_StreamingBuffer Web_StreamingBuffer::operator+=(uint32_t a)               {
-  return addString(String(a));
+Web_StreamingBuffer& Web_StreamingBuffer::operator+=(uint32_t a)               {
+  char tmp[12];
+
+  ultoa(a, tmp, 10);
+  append(tmp, strlen(tmp));
+  return *this;
 }
 
-Web_StreamingBuffer Web_StreamingBuffer::operator+=(const String& a)          {
+Web_StreamingBuffer& Web_StreamingBuffer::operator+=(const String& a)          {
   return addString(a);
 }
 
-Web_StreamingBuffer Web_StreamingBuffer::operator+=(PGM_P str) {
+Web_StreamingBuffer& Web_StreamingBuffer::operator+=(PGM_P str) {
   ++flashStringCalls;
 
   if (!str) { return *this; // return if the pointer is void
   }
+  const size_t length = strlen_P(str);
 
-  if (lowMemorySkip) { return *this; }
-  int flush_step = CHUNKED_BUFFER_SIZE - this->buf.length();
+  flashStringData += length;
+  append_P(str, length);
+  return *this;
+}
 
-  if (flush_step < 1) { flush_step = 0; }
-  unsigned int pos          = 0;
-  const unsigned int length = strlen_P((PGM_P)str);
+Web_StreamingBuffer& Web_StreamingBuffer::addString(const String& a) {
+  append(a.c_str(), a.length());
+  return *this;
+}
 
-  if (length == 0) { return *this; }
-  flashStringData += length;
+float Web_StreamingBuffer::getBytesPerMsec() const {
+  if (lastStreamDuration == 0) { return 0.0; }
+  return static_cast<float>(lastStreamBytes) / lastStreamDuration;
+}
+
+void Web_StreamingBuffer::append(const char *data, size_t length) {
+  if (lowMemorySkip) { return; }
 
-  while (pos < length) {
-    if (flush_step == 0) {
-      sendContentBlocking(this->buf);
-      flush_step = CHUNKED_BUFFER_SIZE;
+  while (length > 0) {
+    if (bufLength == CHUNKED_BUFFER_SIZE) {
+      trackTotalMem();
+      sendContentBlocking();
     }
-    this->buf += (char)pgm_read_byte(&str[pos]);
-    ++pos;
-    --flush_step;
+    size_t step = CHUNKED_BUFFER_SIZE - bufLength;
+
+    if (step > length) { step = length; }
+    memcpy(buf + bufLength, data, step);
+    bufLength += step;
+    data      += step;
+    length    -= step;
   }
-  checkFull();
-  return *this;
 }
 
-Web_StreamingBuffer Web_StreamingBuffer::addString(const String& a) {
-  if (lowMemorySkip) { return *this; }
-  int flush_step = CHUNKED_BUFFER_SIZE - this->buf.length();
+void Web_StreamingBuffer::append_P(PGM_P data, size_t length) {
+  if (lowMemorySkip) { return; }
 
-  if (flush_step < 1) { flush_step = 0; }
-  int pos          = 0;
-  const int length = a.length();
-
-  while (pos < length) {
-    if (flush_step == 0) {
-      sendContentBlocking(this->buf);
-      flush_step = CHUNKED_BUFFER_SIZE;
+  while (length > 0) {
+    if (bufLength == CHUNKED_BUFFER_SIZE) {
+      trackTotalMem();
+      sendContentBlocking();
     }
-    this->buf += a[pos];
-    ++pos;
-    --flush_step;
+    size_t step = CHUNKED_BUFFER_SIZE - bufLength;
+
+    if (step > length) { step = length; }
+    memcpy_P(buf + bufLength, data, step);
+    bufLength += step;
+    data      += step;
+    length    -= step;
   }
-  checkFull();
-  return *this;
 }
 
 void Web_StreamingBuffer::flush() {
   if (lowMemorySkip) {
-    this->buf = "";
-  } else {
-    sendContentBlocking(this->buf);
+    bufLength = 0;
+  } else if (bufLength > 0) {
+    // An empty chunk would end the stream.
+    sendContentBlocking();
   }
 }
 
 void Web_StreamingBuffer::checkFull(void) {
-  if (lowMemorySkip) { this->buf = ""; }
+  if (lowMemorySkip) { bufLength = 0; }
 
-  if (this->buf.length() > CHUNKED_BUFFER_SIZE) {
+  if (bufLength >= CHUNKED_BUFFER_SIZE) {
     trackTotalMem();
-    sendContentBlocking(this->buf);
+    sendContentBlocking();
   }
 }
 
@@ -136,7 +155,8 @@ void Web_StreamingBuffer::startStream(bool json, const String& origin) {
   initialRam   = ESP.getFreeHeap();
   beforeTXRam  = initialRam;
   sentBytes    = 0;
-  buf          = "";
+  bufLength    = 0;
+  streamStart  = millis();
 
   if (beforeTXRam < 3000) {
     lowMemorySkip = true;
@@ -168,10 +188,13 @@ void Web_StreamingBuffer::trackCoreMem() {
 
 void Web_StreamingBuffer::endStream(void) {
   if (!lowMemorySkip) {
-    if (buf.length() > 0) { sendContentBlocking(buf); }
-    buf = "";
-    sendContentBlocking(buf);
-    finalRam = ESP.getFreeHeap();
+    if (bufLength > 0) { sendContentBlocking(); }
+
+    // Empty chunk marks the end of the stream
+    sendContentBlocking();
+    finalRam           = ESP.getFreeHeap();
+    lastStreamBytes    = sentBytes;
+    lastStreamDuration = timePassedSince(streamStart);
 
     /*
         if (loglevelActiveFor(LOG_LEVEL_DEBUG)) {
@@ -191,10 +214,10 @@ void Web_StreamingBuffer::endStream(void) {
 
 
 
-void Web_StreamingBuffer::sendContentBlocking(String& data) {
-  checkRAM(F("sendContentBlocking"));
+void Web_StreamingBuffer::sendContentBlocking() {
+  checkRAM(RamProbe::sendContentBlocking);
   uint32_t freeBeforeSend = ESP.getFreeHeap();
-  const uint32_t length   = data.length();
+  const uint32_t length   = bufLength;
 #ifndef BUILD_NO_DEBUG
   addLog(LOG_LEVEL_DEBUG_DEV, String("sendcontent free: ") + freeBeforeSend + " chunk size:" + length);
 #endif // ifndef BUILD_NO_DEBUG
@@ -210,7 +233,15 @@ void Web_StreamingBuffer::sendContentBlocking(String& data) {
   // do chunked transfer encoding ourselves (WebServer doesn't support it)
   web_server.sendContent(size);
 
-  if (length > 0) { web_server.sendContent(data); }
+  if (length > 0) {
+    String data;
+    data.reserve(length);
+
+    for (size_t i = 0; i < length; ++i) {
+      data += buf[i];
+    }
+    web_server.sendContent(data);
+  }
   web_server.sendContent("\r\n");
 #else // ESP8266 2.4.0rc2 and higher and the ESP32 webserver supports chunked http transfer
   unsigned int timeout = 0;
@@ -219,7 +250,10 @@ void Web_StreamingBuffer::sendContentBlocking(String& data) {
 
   if (freeBeforeSend < 4000) { timeout = 1000; }
   const uint32_t beginWait = millis();
-  web_server.sendContent(data);
+
+  // Send the chunk without copying it into a String.
+  // sendContent_P() also accepts a pointer to RAM.
+  web_server.sendContent_P(buf, length);
 
   while ((ESP.getFreeHeap() < freeBeforeSend) &&
          !timeOutReached(beginWait + timeout)) {
@@ -227,18 +261,18 @@ void Web_StreamingBuffer::sendContentBlocking(String& data) {
       duringTXRam = ESP.getFreeHeap();
     }
     trackCoreMem();
-    checkRAM(F("duringDataTX"));
+    checkRAM(RamProbe::duringDataTX);
     delay(1);
   }
 #endif // if defined(ESP8266) && defined(ARDUINO_ESP8266_RELEASE_2_3_0)
 
   sentBytes += length;
-  data                = "";
+  bufLength  = 0;
   delay(0);
 }
 
 void Web_StreamingBuffer::sendHeaderBlocking(bool json, const String& origin) {
-  checkRAM(F("sendHeaderBlocking"));
+  checkRAM(RamProbe::sendHeaderBlocking);
   web_server.client().flush();
   String contenttype;
 
@@ -278,7 +312,7 @@ void Web_StreamingBuffer::sendHeaderBlocking(bool json, const String& origin) {
   // dont wait on 2.3.0. Memory returns just too slow.
   while ((ESP.getFreeHeap() < freeBeforeSend) &&
          !timeOutReached(beginWait + timeout)) {
-    checkRAM(F("duringHeaderTX"));
+    checkRAM(RamProbe::duringHeaderTX);
     delay(1);
   }
 #endif // if defined(ESP8266) && defined(ARDUINO_ESP8266_RELEASE_2_3_0)
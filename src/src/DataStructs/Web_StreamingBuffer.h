@@ -10,6 +10,9 @@
 // ********************************************************************************
 
 
+#define CHUNKED_BUFFER_SIZE          400
+
+
 class Web_StreamingBuffer {
 private:
 
@@ -27,24 +30,35 @@ public:
   uint32_t flashStringCalls;
   uint32_t flashStringData;
 
+  // Size and duration of the last completed stream
+  unsigned int  lastStreamBytes;
+  unsigned long lastStreamDuration; // msec
+
 private:
 
-  String buf;
+  // The chunk being filled, sent when full.
+  char   buf[CHUNKED_BUFFER_SIZE];
+  size_t bufLength;
+  unsigned long streamStart;
 
 public:
 
   Web_StreamingBuffer(void);
 
-  Web_StreamingBuffer operator=(String& a);
-  Web_StreamingBuffer operator=(const String& a);
-  Web_StreamingBuffer operator+=(char a);
-  Web_StreamingBuffer operator+=(long unsigned int a);
-  Web_StreamingBuffer operator+=(float a);
-  Web_StreamingBuffer operator+=(int a);
-  Web_StreamingBuffer operator+=(uint32_t a);
-  Web_StreamingBuffer operator+=(const String& a);
-  Web_StreamingBuffer operator+=(PGM_P str);
-  Web_StreamingBuffer addString(const String& a);
+  // Append operators return a reference, so chained appends do not copy the buffer.
+  // Numerical values are formatted directly into the chunk.
+  Web_StreamingBuffer& operator=(const String& a);
+  Web_StreamingBuffer& operator+=(char a);
+  Web_StreamingBuffer& operator+=(long unsigned int a);
+  Web_StreamingBuffer& operator+=(float a);
+  Web_StreamingBuffer& operator+=(int a);
+  Web_StreamingBuffer& operator+=(uint32_t a);
+  Web_StreamingBuffer& operator+=(const String& a);
+  Web_StreamingBuffer& operator+=(PGM_P str);
+  Web_StreamingBuffer& addString(const String& a);
+
+  // Throughput of the last completed stream in bytes/msec.
+  float getBytesPerMsec() const;
 
   void flush();
 
@@ -58,6 +72,12 @@ public:
 
 private:
 
+  void append(const char *data,
+              size_t      length);
+
+  void append_P(PGM_P  data,
+                size_t length);
+
   void startStream(bool json, const String& origin);
 
   void trackTotalMem();
@@ -70,7 +90,7 @@ public:
 
 private: 
 
-  void sendContentBlocking(String& data);
+  void sendContentBlocking();
   void sendHeaderBlocking(bool          json,
                           const String& origin = "");
 
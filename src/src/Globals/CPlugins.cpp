@@ -52,7 +52,7 @@ bool CPluginCall(CPlugin::Function Function, struct EventStruct *event, String&
             newSize = newSize + 8 - (newSize % 8);
             Protocol.resize(newSize);
           }
-          checkRAM(F("CPluginCallADD"), x);
+          checkRAM(RamProbe::CPluginCallADD, x);
           String dummy;
           CPluginCall(x, Function, event, dummy);
         }
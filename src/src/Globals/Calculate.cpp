@@ -0,0 +1,3 @@
+#include "../Globals/Calculate.h"
+
+CalculateCache calculateCache;
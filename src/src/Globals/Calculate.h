@@ -0,0 +1,8 @@
+#ifndef GLOBALS_CALCULATE_H
+#define GLOBALS_CALCULATE_H
+
+#include "../Helpers/Calculate.h"
+
+extern CalculateCache calculateCache;
+
+#endif // GLOBALS_CALCULATE_H
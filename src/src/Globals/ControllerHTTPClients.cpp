@@ -0,0 +1,3 @@
+#include "../Globals/ControllerHTTPClients.h"
+
+std::map<int, ControllerHTTPClient> controllerHTTPClients;
@@ -0,0 +1,11 @@
+#ifndef GLOBALS_CONTROLLERHTTPCLIENTS_H
+#define GLOBALS_CONTROLLERHTTPCLIENTS_H
+
+#include "../DataStructs/ControllerHTTPClient.h"
+
+#include <map>
+
+// Persistent HTTP connections, per controller number (CPlugin ID)
+extern std::map<int, ControllerHTTPClient> controllerHTTPClients;
+
+#endif // GLOBALS_CONTROLLERHTTPCLIENTS_H
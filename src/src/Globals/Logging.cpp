@@ -8,4 +8,4 @@ LogStruct Logging;
 uint8_t highest_active_log_level = 0;
 bool log_to_serial_disabled = false;
 
-std::deque<char> serialWriteBuffer;
\ No newline at end of file
+SerialWriteBuffer serialWriteBuffer;
\ No newline at end of file
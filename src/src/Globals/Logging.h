@@ -3,7 +3,8 @@
 
 
 #include <stdint.h>
-#include <deque>
+
+#include "../DataStructs/SerialWriteBuffer.h"
 
 extern uint8_t highest_active_log_level;
 extern bool log_to_serial_disabled;
@@ -14,6 +15,6 @@ extern LogStruct Logging;
 /*********************************************************************************************\
  * Buffer for outputting logs via serial port.
 \*********************************************************************************************/
-extern std::deque<char> serialWriteBuffer;
+extern SerialWriteBuffer serialWriteBuffer;
 
 #endif // GLOBALS_LOGGING_H
\ No newline at end of file
@@ -4,4 +4,5 @@
 
 
 RTCStruct RTC;
+uint32_t  RTC_UserVar_dirty = 0;
 
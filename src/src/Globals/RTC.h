@@ -5,4 +5,7 @@
 
 extern RTCStruct RTC;
 
+// Tasks of which UserVar has changed since the last write to RTC memory, one bit per task.
+extern uint32_t RTC_UserVar_dirty;
+
 #endif // GLOBALS_RTC_H
\ No newline at end of file
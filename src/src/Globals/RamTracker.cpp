@@ -4,6 +4,30 @@
 #include "../../ESPEasy_fdwdecl.h"
 #include "Statistics.h"
 
+/********************************************************************************************\
+   Probes of checkRAM()
+ \*********************************************************************************************/
+const __FlashStringHelper* getRamProbeName(RamProbe probe) {
+  switch (probe) {
+    case RamProbe::None: break;
+#define RAM_PROBE_NAME(name) case RamProbe::name: return F(#name);
+    RAM_PROBE_LIST(RAM_PROBE_NAME)
+#undef RAM_PROBE_NAME
+  }
+  return F("");
+}
+
+String RamProbeCall::toString() const {
+  String result = getRamProbeName(probe);
+
+  if (arg != RAM_PROBE_NO_ARG) {
+    result += F(" (");
+    result += arg;
+    result += ')';
+  }
+  return result;
+}
+
 #ifndef BUILD_NO_RAM_TRACKER
 RamTracker myRamTracker;
 
@@ -15,31 +39,21 @@ void checkRAMtoLog(void){
   myRamTracker.getTraceBuffer();
 }
 
-void checkRAM(const String &flashString, int a ) {
-  checkRAM(flashString, String(a));
-}
+void checkRAM(RamProbe probe, int arg) {
+  const RamProbeCall call(probe, arg);
+  const uint32_t     freeRAM = FreeMem();
 
-void checkRAM(const String &flashString, const String &a ) {
-  String s = flashString;
-  s += " (";
-  s += a;
-  s += ')';
-  checkRAM(s);
-}
+  myRamTracker.registerRamState(call, freeRAM);
 
-void checkRAM( const String &descr ) {
-  myRamTracker.registerRamState(descr);
-  
-  uint32_t freeRAM = FreeMem();
   if (freeRAM <= lowestRAM)
   {
-    lowestRAM = freeRAM;
-    lowestRAMfunction = descr;
+    lowestRAM         = freeRAM;
+    lowestRAMfunction = call;
   }
   uint32_t freeStack = getFreeStackWatermark();
   if (freeStack <= lowestFreeStack) {
-    lowestFreeStack = freeStack;
-    lowestFreeStackfunction = descr;
+    lowestFreeStack         = freeStack;
+    lowestFreeStackfunction = call;
   }
 }
 
@@ -67,43 +81,27 @@ unsigned int RamTracker::bestCaseTrace(void) {
 }
 
 RamTracker::RamTracker(void) {
-  readPtr  = 0;
   writePtr = 0;
 
   for (int i = 0; i < TRACES; i++) {
-    traces[i]       = "";
     tracesMemory[i] = 0xffffffff; // init with best case memory values, so they get replaced if memory goes lower
   }
-
-  for (int i = 0; i < TRACEENTRIES; i++) {
-    nextAction[i]            = "startup";
-    nextActionStartMemory[i] = ESP.getFreeHeap(); // init with best case memory values, so they get replaced if memory goes lower
-  }
 }
 
-void RamTracker::registerRamState(const String& s) {   // store function
-  nextAction[writePtr]            = s;                 // name and mem
-  nextActionStartMemory[writePtr] = ESP.getFreeHeap(); // in cyclic buffer.
-  int bestCase = bestCaseTrace();                      // find best case memory trace
-
-  if (ESP.getFreeHeap() < tracesMemory[bestCase]) {    // compare to current memory value
-    traces[bestCase] = "";
-    readPtr          = writePtr + 1;                   // read out buffer, oldest value first
-
-    if (readPtr >= TRACEENTRIES) { 
-      readPtr = 0;        // read pointer wrap around
-    }
-    tracesMemory[bestCase] = ESP.getFreeHeap();        // store new lowest value of that trace
+void RamTracker::registerRamState(const RamProbeCall& call, uint32_t freeHeap) { // store probe
+  nextAction[writePtr].call     = call;                                         // and mem
+  nextAction[writePtr].freeHeap = freeHeap;                                     // in cyclic buffer.
+  int bestCase = bestCaseTrace();                                               // find best case memory trace
 
-    for (int i = 0; i < TRACEENTRIES; i++) {           // tranfer cyclic buffer strings and mem values to this trace
-      traces[bestCase] += nextAction[readPtr];
-      traces[bestCase] += "-> ";
-      traces[bestCase] += String(nextActionStartMemory[readPtr]);
-      traces[bestCase] += ' ';
-      readPtr++;
+  if (freeHeap < tracesMemory[bestCase]) {                                      // compare to current memory value
+    tracesMemory[bestCase] = freeHeap;                                          // store new lowest value of that trace
+    unsigned int readPtr = writePtr + 1;                                        // read out buffer, oldest value first
 
+    for (int i = 0; i < TRACEENTRIES; i++) {                                    // tranfer cyclic buffer to this trace
       if (readPtr >= TRACEENTRIES) { readPtr = 0; // wrap around read pointer
       }
+      traces[bestCase][i] = nextAction[readPtr];
+      readPtr++;
     }
   }
   writePtr++;
@@ -112,21 +110,29 @@ void RamTracker::registerRamState(const String& s) {   // store function
   }
 }
 
- // return giant strings, one line per trace. Add stremToWeb method to avoid large strings.
+// Log the traces, one line per trace.
 void RamTracker::getTraceBuffer() {
 #ifndef BUILD_NO_DEBUG
 
   if (loglevelActiveFor(LOG_LEVEL_DEBUG_DEV)) {
-    String retval = "Memtrace\n";
+    addLog(LOG_LEVEL_DEBUG_DEV, F("Memtrace"));
 
     for (int i = 0; i < TRACES; i++) {
-      retval += String(i);
+      String retval = String(i);
       retval += ": lowest: ";
       retval += String(tracesMemory[i]);
       retval += "  ";
-      retval += traces[i];
+
+      for (int j = 0; j < TRACEENTRIES; j++) {
+        const Entry& entry = traces[i][j];
+
+        if (entry.call.probe == RamProbe::None) { continue; }
+        retval += entry.call.toString();
+        retval += "-> ";
+        retval += String(entry.freeHeap);
+        retval += ' ';
+      }
       addLog(LOG_LEVEL_DEBUG_DEV, retval);
-      retval = "";
     }
   }
 #endif // ifndef BUILD_NO_DEBUG
@@ -136,12 +142,6 @@ void RamTracker::getTraceBuffer() {
 
 void checkRAMtoLog(void) {}
 
-void checkRAM(const String& flashString,
-              int           a) {}
-
-void checkRAM(const String& flashString,
-              const String& a) {}
-
-void checkRAM(const String& descr) {}
+void checkRAM(RamProbe, int) {}
 
-#endif // BUILD_NO_RAM_TRACKER
\ No newline at end of file
+#endif // BUILD_NO_RAM_TRACKER
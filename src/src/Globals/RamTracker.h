@@ -8,6 +8,133 @@
 #include <Arduino.h>
 #include "../../ESPEasy_common.h"
 
+/********************************************************************************************\
+   Probes of checkRAM()
+   Each call site uses a compile-time ID, the names are only looked up (from flash) for display.
+   To add a probe, add its name to RAM_PROBE_LIST.
+ \*********************************************************************************************/
+
+// *INDENT-OFF*
+#define RAM_PROBE_LIST(X)          \
+  X(ArduinoOTAInit)                \
+  X(BuildFixes)                    \
+  X(CPluginCallADD)                \
+  X(Calculate)                     \
+  X(Calculate2)                    \
+  X(ClearCustomControllerSettings) \
+  X(ClearInFile)                   \
+  X(ExecuteCommand)                \
+  X(InitFile)                      \
+  X(LoadControllerSettings)        \
+  X(LoadCustomControllerSettings)  \
+  X(LoadCustomTaskSettings)        \
+  X(LoadFromFile)                  \
+  X(LoadNotificationSettings)      \
+  X(LoadSettings)                  \
+  X(LoadTaskSettings)              \
+  X(PluginCall)                    \
+  X(PluginCallUDP)                 \
+  X(PluginCall_s)                  \
+  X(PluginCall_task)               \
+  X(ResetFactory)                  \
+  X(ResetFactory2)                 \
+  X(SaveControllerSettings)        \
+  X(SaveCustomControllerSettings)  \
+  X(SaveCustomTaskSettings)        \
+  X(SaveNotificationSettings)      \
+  X(SaveSettings)                  \
+  X(SaveTaskSettings)              \
+  X(SaveToFile)                    \
+  X(SensorSendTask)                \
+  X(SpiffsSectors)                 \
+  X(addToLog)                      \
+  X(compileRuleSet)                \
+  X(duringDataTX)                  \
+  X(duringHeaderTX)                \
+  X(fileSystemCheck)               \
+  X(flashGuard)                    \
+  X(getPinStateJSON)               \
+  X(handleFileUpload)              \
+  X(handleNotFound)                \
+  X(handle_SDfilelist)             \
+  X(handle_advanced)               \
+  X(handle_config)                 \
+  X(handle_control)                \
+  X(handle_controllers)            \
+  X(handle_custom)                 \
+  X(handle_devices)                \
+  X(handle_download)               \
+  X(handle_factoryreset)           \
+  X(handle_favicon)                \
+  X(handle_filelist)               \
+  X(handle_hardware)               \
+  X(handle_i2cscanner)             \
+  X(handle_login)                  \
+  X(handle_notifications)          \
+  X(handle_pinstates)              \
+  X(handle_root)                   \
+  X(handle_rules)                  \
+  X(handle_rules_backup)           \
+  X(handle_rules_delete)           \
+  X(handle_settingsarchive)        \
+  X(handle_setup)                  \
+  X(handle_static_file)            \
+  X(handle_sysinfo)                \
+  X(handle_sysvars)                \
+  X(handle_timingstats)            \
+  X(handle_upload_post)            \
+  X(handle_wifiscanner)            \
+  X(hardwareInit)                  \
+  X(loadFromFS)                    \
+  X(parseCommandString)            \
+  X(parseTemplate2)                \
+  X(parseTemplate3)                \
+  X(parseTemplate_padded)          \
+  X(play_rtttl)                    \
+  X(play_rtttl2)                   \
+  X(prepare_deepSleep)             \
+  X(progMemMD5check)               \
+  X(remoteConfig)                  \
+  X(ruleMatch)                     \
+  X(ruleMatch2)                    \
+  X(rulesProcessing)               \
+  X(rulesProcessingFile)           \
+  X(rulesProcessingFile2)          \
+  X(sendContentBlocking)           \
+  X(sendData)                      \
+  X(sendHeaderBlocking)            \
+  X(sendWebPage)                   \
+  X(setControllerEnableStatus)     \
+  X(setTaskEnableStatus)           \
+  X(setup)                         \
+  X(taskClear)                     \
+  X(transformValue)                \
+  X(transformValue2)
+// *INDENT-ON*
+
+enum class RamProbe : uint16_t {
+  None = 0,
+#define RAM_PROBE_ENUM(name) name,
+  RAM_PROBE_LIST(RAM_PROBE_ENUM)
+#undef RAM_PROBE_ENUM
+};
+
+// Optional argument of a probe not set
+#define RAM_PROBE_NO_ARG  INT16_MIN
+
+const __FlashStringHelper* getRamProbeName(RamProbe probe);
+
+// A call to checkRAM(), like "PluginCall (2)"
+struct RamProbeCall {
+  RamProbeCall(RamProbe probe = RamProbe::None, int arg = RAM_PROBE_NO_ARG) :
+    probe(probe), arg(arg) {}
+
+  String toString() const;
+
+  RamProbe probe;
+  int16_t  arg;
+};
+
 /********************************************************************************************\
    RamTracker class
  \*********************************************************************************************/
@@ -16,11 +143,15 @@
 class RamTracker {
 private:
 
-  String traces[TRACES];                            // trace of latest memory checks
+  struct Entry {
+    RamProbeCall call;
+    uint32_t     freeHeap = 0;
+  };
+
+  Entry traces[TRACES][TRACEENTRIES];               // trace of latest memory checks
   unsigned int tracesMemory[TRACES];                // lowest memory for that  trace
-  unsigned int readPtr, writePtr;                   // pointer to cyclic buffer
-  String nextAction[TRACEENTRIES];                  // buffer to record the names of functions before they are transfered to a trace
-  unsigned int nextActionStartMemory[TRACEENTRIES]; // memory levels for the functions.
+  unsigned int writePtr;                            // pointer to cyclic buffer
+  Entry nextAction[TRACEENTRIES];                   // buffer to record the probes before they are transfered to a trace
 
   unsigned int bestCaseTrace(void);
 
@@ -28,31 +159,24 @@ public:
 
   RamTracker(void);
 
-  void registerRamState(const String& s);
+  void registerRamState(const RamProbeCall& call, uint32_t freeHeap);
 
-  // return giant strings, one line per trace. Add stremToWeb method to avoid large strings.
+  // Log the traces, one line per trace.
   void getTraceBuffer();
 };
 
 extern RamTracker myRamTracker; // instantiate class. (is global now)
+#endif // BUILD_NO_RAM_TRACKER
 
 
 /********************************************************************************************\
    Global convenience functions calling RamTracker
  \*********************************************************************************************/
 
-#endif // BUILD_NO_RAM_TRACKER
-
 void checkRAMtoLog(void);
 
-void checkRAM(const String& flashString,
-              int           a);
-
-void checkRAM(const String& flashString,
-              const String& a);
-
-void checkRAM(const String& descr);
-
+void checkRAM(RamProbe probe,
+              int      arg = RAM_PROBE_NO_ARG);
 
 
 #endif // GLOBALS_RAMTRACKER_H
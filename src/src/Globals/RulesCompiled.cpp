@@ -0,0 +1,3 @@
+#include "../Globals/RulesCompiled.h"
+
+RulesCompiledFile compiledRuleSets[RULESETS_MAX];
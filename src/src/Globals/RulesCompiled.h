@@ -0,0 +1,9 @@
+#ifndef GLOBALS_RULESCOMPILED_H
+#define GLOBALS_RULESCOMPILED_H
+
+#include "../DataStructs/ESPEasyLimits.h"
+#include "../DataStructs/RulesCompiled.h"
+
+extern RulesCompiledFile compiledRuleSets[RULESETS_MAX];
+
+#endif // GLOBALS_RULESCOMPILED_H
@@ -2,10 +2,12 @@
 
 #include <Arduino.h>
 
-uint32_t lowestRAM = 0;
-String   lowestRAMfunction;
-uint32_t lowestFreeStack = 0;
-String   lowestFreeStackfunction;
+#include "../Globals/RamTracker.h"
+
+uint32_t     lowestRAM = 0;
+RamProbeCall lowestRAMfunction;
+uint32_t     lowestFreeStack = 0;
+RamProbeCall lowestFreeStackfunction;
 
 uint8_t lastBootCause                           = BOOT_CAUSE_MANUAL_REBOOT;
 unsigned long lastMixedSchedulerId_beforereboot = 0;
@@ -4,6 +4,7 @@
 #include <stdint.h>
 
 class String;
+struct RamProbeCall;
 
 #define BOOT_CAUSE_MANUAL_REBOOT            0
 #define BOOT_CAUSE_COLD_BOOT                1
@@ -11,9 +12,9 @@ class String;
 #define BOOT_CAUSE_EXT_WD                  10
 
 extern uint32_t lowestRAM;
-extern String   lowestRAMfunction;
+extern RamProbeCall lowestRAMfunction;
 extern uint32_t lowestFreeStack;
-extern String   lowestFreeStackfunction;
+extern RamProbeCall lowestFreeStackfunction;
 
 extern uint8_t lastBootCause;
 extern unsigned long lastMixedSchedulerId_beforereboot;
@@ -0,0 +1,416 @@
+#include "../Helpers/Calculate.h"
+
+#include <math.h>
+
+
+// Marker for a left parenthesis on the operator stack.
+#define CALCULATE_LEFT_PARENTHESIS  0xFF
+
+namespace {
+bool isUnaryOperator(CalculateToken::Op op)
+{
+  return op == CalculateToken::Op::Not || op == CalculateToken::Op::Negate;
+}
+
+int operatorPrecedence(CalculateToken::Op op)
+{
+  switch (op) {
+    case CalculateToken::Op::Not:          return 7;
+    case CalculateToken::Op::Power:        return 6;
+    case CalculateToken::Op::Multiply:
+    case CalculateToken::Op::Divide:
+    case CalculateToken::Op::Modulo:       return 5;
+    case CalculateToken::Op::Negate:
+    case CalculateToken::Op::Add:
+    case CalculateToken::Op::Subtract:     return 4;
+    case CalculateToken::Op::Less:
+    case CalculateToken::Op::LessEqual:
+    case CalculateToken::Op::Greater:
+    case CalculateToken::Op::GreaterEqual: return 3;
+    case CalculateToken::Op::Equal:
+    case CalculateToken::Op::NotEqual:     return 2;
+    case CalculateToken::Op::And:          return 1;
+    case CalculateToken::Op::Or:           return 0;
+    case CalculateToken::Op::Value:
+    case CalculateToken::Op::Variable:
+      break;
+  }
+  return -1;
+}
+
+// Parse the binary operator at pos.
+// Returns the number of characters used, or 0 when it is not a (valid) operator.
+int parseBinaryOperator(const char *pos, CalculateToken::Op& op, int& error)
+{
+  switch (pos[0]) {
+    case '+': op = CalculateToken::Op::Add;      return 1;
+    case '-': op = CalculateToken::Op::Subtract; return 1;
+    case '*': op = CalculateToken::Op::Multiply; return 1;
+    case '/': op = CalculateToken::Op::Divide;   return 1;
+    case '%': op = CalculateToken::Op::Modulo;   return 1;
+    case '^': op = CalculateToken::Op::Power;    return 1;
+    case '<':
+
+      if (pos[1] == '=') { op = CalculateToken::Op::LessEqual; return 2; }
+
+      if (pos[1] == '>') { op = CalculateToken::Op::NotEqual; return 2; }
+      op = CalculateToken::Op::Less;
+      return 1;
+    case '>':
+
+      if (pos[1] == '=') { op = CalculateToken::Op::GreaterEqual; return 2; }
+      op = CalculateToken::Op::Greater;
+      return 1;
+    case '=':
+      op = CalculateToken::Op::Equal;
+      return (pos[1] == '=') ? 2 : 1;
+    case '!':
+
+      if (pos[1] == '=') { op = CalculateToken::Op::NotEqual; return 2; }
+      break;
+    case '&':
+
+      if (pos[1] == '&') { op = CalculateToken::Op::And; return 2; }
+      error = CALCULATE_ERROR_BAD_OPERATOR;
+      break;
+    case '|':
+
+      if (pos[1] == '|') { op = CalculateToken::Op::Or; return 2; }
+      error = CALCULATE_ERROR_BAD_OPERATOR;
+      break;
+  }
+  return 0;
+}
+
+float apply_operator(CalculateToken::Op op, float first, float second)
+{
+  switch (op) {
+    case CalculateToken::Op::Add:          return first + second;
+    case CalculateToken::Op::Subtract:     return first - second;
+    case CalculateToken::Op::Multiply:     return first * second;
+    case CalculateToken::Op::Divide:       return first / second;
+    case CalculateToken::Op::Modulo:
+    {
+      const int divisor = static_cast<int>(round(second));
+
+      if (divisor == 0) { return 0; }
+      return static_cast<int>(round(first)) % divisor;
+    }
+    case CalculateToken::Op::Power:        return pow(first, second);
+    case CalculateToken::Op::Less:         return (first < second) ? 1 : 0;
+    case CalculateToken::Op::LessEqual:    return (first <= second) ? 1 : 0;
+    case CalculateToken::Op::Greater:      return (first > second) ? 1 : 0;
+    case CalculateToken::Op::GreaterEqual: return (first >= second) ? 1 : 0;
+    case CalculateToken::Op::Equal:        return (first == second) ? 1 : 0;
+    case CalculateToken::Op::NotEqual:     return (first != second) ? 1 : 0;
+    case CalculateToken::Op::And:          return (first != 0 && second != 0) ? 1 : 0;
+    case CalculateToken::Op::Or:           return (first != 0 || second != 0) ? 1 : 0;
+    default:
+      break;
+  }
+  return 0;
+}
+
+float apply_unary_operator(CalculateToken::Op op, float first)
+{
+  switch (op) {
+    case CalculateToken::Op::Not:    return (round(first) == 0) ? 1 : 0;
+    case CalculateToken::Op::Negate: return -first;
+    default:
+      break;
+  }
+  return 0;
+}
+
+uint32_t hashExpression(const char *input)
+{
+  // FNV-1a
+  uint32_t hash = 2166136261u;
+
+  while (*input != '\0') {
+    hash ^= static_cast<uint8_t>(*input);
+    hash *= 16777619u;
+    ++input;
+  }
+  return hash;
+}
+} // namespace
+
+
+void CalculateProgram::clear()
+{
+  tokens.clear();
+}
+
+bool CalculateProgram::isEmpty() const
+{
+  return tokens.empty();
+}
+
+int CalculateProgram::compile(const char *input, const char *const *variableNames, uint8_t nrVariables)
+{
+  clear();
+
+  const char *pos = input;
+
+  if (*pos == '=') {
+    ++pos;
+  }
+
+  uint8_t opStack[CALCULATE_OPERATOR_STACK_SIZE]; // operator stack
+  size_t  sl            = 0;                      // stack length
+  int     depth         = 0;                      // value stack depth when executing
+  bool    expectOperand = true;
+  bool    afterOperator = false;
+
+  // Emit an operator to the program and keep track of the value stack depth.
+  // Missing operands will be 0 when executing.
+  auto emitOperator = [&](CalculateToken::Op op) {
+                        tokens.emplace_back(op);
+
+                        if (isUnaryOperator(op)) {
+                          if (depth == 0) { depth = 1; }
+                        } else {
+                          depth = (depth >= 2) ? depth - 1 : 1;
+                        }
+                      };
+
+  while (*pos != '\0') {
+    const char c = *pos;
+
+    if (c == ' ') {
+      ++pos;
+      continue;
+    }
+
+    // If the token is a number, then add it to the program.
+    // A '-' right after an operator is part of the number.
+    if (isdigit(c) || (c == '.') ||
+        ((c == '-') && afterOperator && (isdigit(pos[1]) || (pos[1] == '.'))))
+    {
+      if (!expectOperand) {
+        clear();
+        return CALCULATE_ERROR_BAD_OPERATOR;
+      }
+      char   token[CALCULATE_TOKEN_LENGTH];
+      size_t tokenLength = 0;
+      token[tokenLength++] = c;
+      ++pos;
+
+      // Spaces within a number are ignored.
+      while (isdigit(*pos) || (*pos == '.') || (*pos == ' ')) {
+        if (*pos != ' ') {
+          if (tokenLength >= (CALCULATE_TOKEN_LENGTH - 1)) {
+            clear();
+            return CALCULATE_ERROR_STACK_OVERFLOW;
+          }
+          token[tokenLength++] = *pos;
+        }
+        ++pos;
+      }
+      token[tokenLength] = 0;
+      tokens.emplace_back(CalculateToken::Op::Value, atof(token));
+
+      if (++depth > CALCULATE_STACK_SIZE) {
+        clear();
+        return CALCULATE_ERROR_STACK_OVERFLOW;
+      }
+      expectOperand = false;
+      afterOperator = false;
+      continue;
+    }
+
+    // Variables are handled like a number.
+    if (expectOperand && (nrVariables > 0)) {
+      uint8_t varIndex = 0;
+      size_t  varLength = 0;
+
+      for (; varIndex < nrVariables; ++varIndex) {
+        varLength = strlen(variableNames[varIndex]);
+
+        if (strncmp(pos, variableNames[varIndex], varLength) == 0) {
+          break;
+        }
+      }
+
+      if (varIndex < nrVariables) {
+        tokens.emplace_back(CalculateToken::Op::Variable, 0.0f, varIndex);
+
+        if (++depth > CALCULATE_STACK_SIZE) {
+          clear();
+          return CALCULATE_ERROR_STACK_OVERFLOW;
+        }
+        expectOperand = false;
+        afterOperator = false;
+        pos          += varLength;
+        continue;
+      }
+    }
+
+    // If the token is a left parenthesis, then push it onto the stack.
+    if (c == '(') {
+      if (!expectOperand) {
+        clear();
+        return CALCULATE_ERROR_BAD_OPERATOR;
+      }
+
+      if (sl >= CALCULATE_OPERATOR_STACK_SIZE) {
+        clear();
+        return CALCULATE_ERROR_STACK_OVERFLOW;
+      }
+      opStack[sl++] = CALCULATE_LEFT_PARENTHESIS;
+      afterOperator = false;
+      ++pos;
+      continue;
+    }
+
+    // If the token is a right parenthesis:
+    // Until the token at the top of the stack is a left parenthesis,
+    // pop operators off the stack onto the program
+    if (c == ')') {
+      while (sl > 0 && opStack[sl - 1] != CALCULATE_LEFT_PARENTHESIS) {
+        emitOperator(static_cast<CalculateToken::Op>(opStack[--sl]));
+      }
+
+      // If the stack runs out without finding a left parenthesis, then there are mismatched parentheses.
+      if (sl == 0) {
+        clear();
+        return CALCULATE_ERROR_PARENTHESES_MISMATCHED;
+      }
+
+      // Pop the left parenthesis from the stack, but not onto the program.
+      --sl;
+      expectOperand = false;
+      afterOperator = false;
+      ++pos;
+      continue;
+    }
+
+    CalculateToken::Op op;
+    int error = CALCULATE_ERROR_UNKNOWN_TOKEN;
+
+    if (expectOperand && ((c == '!') || (c == '-') || (c == '+')) && (pos[1] != '=')) {
+      // Unary operator, push it onto the stack.
+      // A leading '-' has the same precedence as subtraction, like "0 - ..."
+      if (c != '+') {
+        if (sl >= CALCULATE_OPERATOR_STACK_SIZE) {
+          clear();
+          return CALCULATE_ERROR_STACK_OVERFLOW;
+        }
+        opStack[sl++] = static_cast<uint8_t>(c == '!' ? CalculateToken::Op::Not : CalculateToken::Op::Negate);
+      }
+      afterOperator = true;
+      ++pos;
+      continue;
+    }
+
+    const int opLength = parseBinaryOperator(pos, op, error);
+
+    if (opLength == 0) {
+      clear();
+      return error;
+    }
+
+    // While there is an operator token, op2, at the top of the stack
+    // with precedence greater than or equal to op1 (all binary operators are left-associative),
+    // pop op2 off the stack, onto the program.
+    while (sl > 0 && opStack[sl - 1] != CALCULATE_LEFT_PARENTHESIS &&
+           operatorPrecedence(static_cast<CalculateToken::Op>(opStack[sl - 1])) >= operatorPrecedence(op)) {
+      emitOperator(static_cast<CalculateToken::Op>(opStack[--sl]));
+    }
+
+    // push op1 onto the stack.
+    if (sl >= CALCULATE_OPERATOR_STACK_SIZE) {
+      clear();
+      return CALCULATE_ERROR_STACK_OVERFLOW;
+    }
+    opStack[sl++] = static_cast<uint8_t>(op);
+    expectOperand = true;
+    afterOperator = true;
+    pos          += opLength;
+  }
+
+  // When there are no more tokens to read:
+  // While there are still operator tokens in the stack:
+  while (sl > 0) {
+    if (opStack[sl - 1] == CALCULATE_LEFT_PARENTHESIS) {
+      clear();
+      return CALCULATE_ERROR_PARENTHESES_MISMATCHED;
+    }
+    emitOperator(static_cast<CalculateToken::Op>(opStack[--sl]));
+  }
+  tokens.shrink_to_fit();
+  return CALCULATE_OK;
+}
+
+float CalculateProgram::execute(const float *variables) const
+{
+  // Stack depth is checked when compiling.
+  float stack[CALCULATE_STACK_SIZE];
+  int   sp = 0;
+
+  for (auto it = tokens.begin(); it != tokens.end(); ++it) {
+    if (it->op == CalculateToken::Op::Value) {
+      stack[sp++] = it->value;
+    } else if (it->op == CalculateToken::Op::Variable) {
+      stack[sp++] = (variables != nullptr) ? variables[it->index] : 0.0f;
+    } else if (isUnaryOperator(it->op)) {
+      const float first = (sp > 0) ? stack[--sp] : 0.0f;
+      stack[sp++] = apply_unary_operator(it->op, first);
+    } else {
+      const float second = (sp > 0) ? stack[--sp] : 0.0f;
+      const float first  = (sp > 0) ? stack[--sp] : 0.0f;
+      stack[sp++] = apply_operator(it->op, first, second);
+    }
+  }
+  return (sp > 0) ? stack[sp - 1] : 0.0f;
+}
+
+CalculateCache::CalculateCache() {}
+
+int CalculateCache::calculate(const char *input, float& result)
+{
+  const uint32_t hash = hashExpression(input);
+  Entry *entry        = nullptr;
+
+  for (size_t i = 0; i < CALCULATE_CACHE_SIZE && entry == nullptr; ++i) {
+    if ((_entries[i].lastUsed != 0) && (_entries[i].hash == hash) &&
+        (strcmp(_entries[i].expression.c_str(), input) == 0)) {
+      entry = &_entries[i];
+    }
+  }
+
+  if (entry != nullptr) {
+    ++hits;
+  } else {
+    ++misses;
+
+    // Replace the least recently used entry
+    entry = &_entries[0];
+
+    for (size_t i = 1; i < CALCULATE_CACHE_SIZE; ++i) {
+      if (_entries[i].lastUsed < entry->lastUsed) {
+        entry = &_entries[i];
+      }
+    }
+    entry->expression = input;
+    entry->hash       = hash;
+    entry->error      = entry->program.compile(input);
+  }
+  entry->lastUsed = ++_useCounter;
+
+  if (entry->error != CALCULATE_OK) {
+    return entry->error;
+  }
+  result = entry->program.execute();
+  return CALCULATE_OK;
+}
+
+void CalculateCache::clear()
+{
+  for (size_t i = 0; i < CALCULATE_CACHE_SIZE; ++i) {
+    _entries[i].expression = String();
+    _entries[i].program.clear();
+    _entries[i].lastUsed = 0;
+  }
+}
@@ -0,0 +1,124 @@
+#ifndef HELPERS_CALCULATE_H
+#define HELPERS_CALCULATE_H
+
+#include <Arduino.h>
+
+#include <vector>
+
+/********************************************************************************************\
+   Calculate function for simple expressions
+
+   An expression is compiled once into a flat postfix program, which can be executed
+   many times without parsing the text again.
+   Compiled programs are kept in a small LRU cache, keyed by the expression text.
+   A program may contain named variables (e.g. "%value%"), which are bound when executing.
+ \*********************************************************************************************/
+#define CALCULATE_OK                            0
+#define CALCULATE_ERROR_STACK_OVERFLOW          1
+#define CALCULATE_ERROR_BAD_OPERATOR            2
+#define CALCULATE_ERROR_PARENTHESES_MISMATCHED  3
+#define CALCULATE_ERROR_UNKNOWN_TOKEN           4
+
+#define CALCULATE_STACK_SIZE                    10 // Max. depth of the value stack
+#define CALCULATE_OPERATOR_STACK_SIZE           32
+#define CALCULATE_TOKEN_LENGTH                  25 // Max. length of a numerical value
+
+#ifndef CALCULATE_CACHE_SIZE
+# ifdef ESP32
+#  define CALCULATE_CACHE_SIZE                  16
+# else // ifdef ESP32
+#  define CALCULATE_CACHE_SIZE                  8
+# endif // ifdef ESP32
+#endif // ifndef CALCULATE_CACHE_SIZE
+
+
+// operators
+// precedence   operators         associativity
+// 7            !                 right to left
+// 6            ^                 left to right
+// 5            * / %             left to right
+// 4            + - (also unary)  left to right
+// 3            < <= > >=         left to right
+// 2            == = != <>        left to right
+// 1            &&                left to right
+// 0            ||                left to right
+struct CalculateToken {
+  enum class Op : uint8_t {
+    Value,
+    Variable,
+    Add,
+    Subtract,
+    Multiply,
+    Divide,
+    Modulo,
+    Power,
+    Less,
+    LessEqual,
+    Greater,
+    GreaterEqual,
+    Equal,
+    NotEqual,
+    And,
+    Or,
+    Not,
+    Negate
+  };
+
+  CalculateToken(Op operation, float val = 0.0f, uint8_t varIndex = 0) : value(val), op(operation), index(varIndex) {}
+
+  float   value;
+  Op      op;
+  uint8_t index; // Variable index
+};
+
+
+struct CalculateProgram {
+  // Parse the expression and store it as postfix program.
+  // Occurrences of variableNames[i] in the expression refer to variables[i] in execute().
+  // Returns one of the CALCULATE_* values.
+  int  compile(const char        *input,
+               const char *const *variableNames = nullptr,
+               uint8_t            nrVariables   = 0);
+
+  // Run the program. Only allowed on a program which compiled without error.
+  // Re-entrant, the value stack is allocated on the stack.
+  float execute(const float *variables = nullptr) const;
+
+  bool  isEmpty() const;
+
+  void clear();
+
+  std::vector<CalculateToken>tokens;
+};
+
+
+struct CalculateCache {
+  CalculateCache();
+
+  // Compile the expression (when not present in the cache) and execute it.
+  // Returns one of the CALCULATE_* values.
+  int  calculate(const char *input,
+                 float     & result);
+
+  void clear();
+
+  // Statistics
+  unsigned long hits   = 0;
+  unsigned long misses = 0;
+
+private:
+
+  struct Entry {
+    String           expression;
+    CalculateProgram program;
+    uint32_t         hash     = 0;
+    uint32_t         lastUsed = 0;
+    int              error    = CALCULATE_OK;
+  };
+
+  Entry _entries[CALCULATE_CACHE_SIZE];
+  uint32_t _useCounter = 0;
+};
+
+
+#endif // HELPERS_CALCULATE_H
@@ -70,84 +70,10 @@ void SystemVariables::parseSystemVariables(String& s, boolean useURLencode)
 
     switch (enumval)
     {
-      case BSSID:             value = String((wifiStatus == ESPEASY_WIFI_DISCONNECTED) ? F("00:00:00:00:00:00") : WiFi.BSSIDstr()); break;
-      case CR:                value = "\r"; break;
-      case IP:                value = getValue(LabelType::IP_ADDRESS); break;
-      case IP4:               value = String( (int) WiFi.localIP()[3] ); break; // 4th IP octet
-      #ifdef USES_MQTT
-      case ISMQTT:            value = String(MQTTclient_connected); break;
-      #else // ifdef USES_MQTT
-      case ISMQTT:            value = "0"; break;
-      #endif // ifdef USES_MQTT
-
-      #ifdef USES_P037
-      case ISMQTTIMP:         value = String(P037_MQTTImport_connected); break;
-      #else // ifdef USES_P037
-      case ISMQTTIMP:         value = "0"; break;
-      #endif // USES_P037
-
-
-      case ISNTP:             value = String(statusNTPInitialized); break;
-      case ISWIFI:            value = String(wifiStatus); break; // 0=disconnected, 1=connected, 2=got ip, 3=services initialized
-      case LCLTIME:           value = getValue(LabelType::LOCAL_TIME); break;
-      case LCLTIME_AM:        value = node_time.getDateTimeString_ampm('-', ':', ' '); break;
-      case LF:                value = "\n"; break;
-      case MAC:               value = getValue(LabelType::STA_MAC); break;
-    #ifdef ESP8266
-      case MAC_INT:           value = String(ESP.getChipId()); break; // Last 24 bit of MAC address as integer, to be used in rules.
-    #else // ifdef ESP8266
-      case MAC_INT:           value = ""; break;                      // FIXME TD-er: Must find proper altrnative for ESP32.
-    #endif // ifdef ESP8266
-      case RSSI:              value = getValue(LabelType::WIFI_RSSI); break;
-      case SPACE:             value = " "; break;
-      case SSID:              value = (wifiStatus == ESPEASY_WIFI_DISCONNECTED) ? F("--") : WiFi.SSID(); break;
-      case SUNRISE:           SMART_REPL_T(SystemVariables::toString(enumval), replSunRiseTimeString); break;
-      case SUNSET:            SMART_REPL_T(SystemVariables::toString(enumval), replSunSetTimeString); break;
-      case SYSBUILD_DATE:     value = get_build_date(); break;
-      case SYSBUILD_DESCR:    value = getValue(LabelType::BUILD_DESC); break;
-      case SYSBUILD_FILENAME: value = getValue(LabelType::BINARY_FILENAME); break;
-      case SYSBUILD_GIT:      value = getValue(LabelType::GIT_BUILD); break;
-      case SYSBUILD_TIME:     value = get_build_time(); break;
-      case SYSDAY:            value = String(node_time.day()); break;
-      case SYSDAY_0:          value = timeReplacement_leadZero(node_time.day()); break;
-      case SYSHEAP:           value = String(ESP.getFreeHeap()); break;
-      case SYSHOUR:           value = String(node_time.hour()); break;
-      case SYSHOUR_0:         value = timeReplacement_leadZero(node_time.hour()); break;
-      case SYSLOAD:           value = String(getCPUload()); break;
-      case SYSMIN:            value = String(node_time.minute()); break;
-      case SYSMIN_0:          value = timeReplacement_leadZero(node_time.minute()); break;
-      case SYSMONTH:          value = String(node_time.month()); break;
-      case SYSNAME:           value = Settings.getHostname(); break;
-      case SYSSEC:            value = String(node_time.second()); break;
-      case SYSSEC_0:          value = timeReplacement_leadZero(node_time.second()); break;
-      case SYSSEC_D:          value = String(((node_time.hour() * 60) + node_time.minute()) * 60 + node_time.second()); break;
-      case SYSSTACK:          value = getValue(LabelType::FREE_STACK); break;
-      case SYSTIME:           value = node_time.getTimeString(':'); break;
-      case SYSTIME_AM:        value = node_time.getTimeString_ampm(':'); break;
-      case SYSTM_HM:          value = node_time.getTimeString(':', false); break;
-      case SYSTM_HM_AM:       value = node_time.getTimeString_ampm(':', false); break;
-      case SYSWEEKDAY:        value = String(node_time.weekday()); break;
-      case SYSWEEKDAY_S:      value = node_time.weekday_str(); break;
-      case SYSYEAR_0:
-      case SYSYEAR:           value = String(node_time.year()); break;
-      case SYSYEARS:          value = timeReplacement_leadZero(node_time.year() % 100); break;
-      case SYS_MONTH_0:       value = timeReplacement_leadZero(node_time.month()); break;
-      case S_CR:              value = F("\\r"); break;
-      case S_LF:              value = F("\\n"); break;
-      case UNIT_sysvar:       value = getValue(LabelType::UNIT_NR); break;
-      case UNIXDAY:           value = String(node_time.getUnixTime() / 86400); break;
-      case UNIXDAY_SEC:       value = String(node_time.getUnixTime() % 86400); break;
-      case UNIXTIME:          value = String(node_time.getUnixTime()); break;
-      case UPTIME:            value = String(wdcounter / 2); break;
-      #if FEATURE_ADC_VCC
-      case VCC:               value = String(vcc); break;
-      #else // if FEATURE_ADC_VCC
-      case VCC:               value = String(-1); break;
-      #endif // if FEATURE_ADC_VCC
-      case WI_CH:             value = String((wifiStatus == ESPEASY_WIFI_DISCONNECTED) ? 0 : WiFi.channel()); break;
-
-      case UNKNOWN:
-        break;
+      case SUNRISE: SMART_REPL_T(SystemVariables::toString(enumval), replSunRiseTimeString); break;
+      case SUNSET:  SMART_REPL_T(SystemVariables::toString(enumval), replSunSetTimeString); break;
+      case UNKNOWN: break;
+      default:      value = getSystemVariableValue(enumval); break;
     }
 
     switch (enumval)
@@ -192,6 +118,94 @@ void SystemVariables::parseSystemVariables(String& s, boolean useURLencode)
 #undef SMART_REPL_T
 
 
+String SystemVariables::getSystemVariableValue(SystemVariables::Enum enumval)
+{
+  String value;
+
+  switch (enumval)
+  {
+    case BSSID:             value = String((wifiStatus == ESPEASY_WIFI_DISCONNECTED) ? F("00:00:00:00:00:00") : WiFi.BSSIDstr()); break;
+    case CR:                value = "\r"; break;
+    case IP:                value = getValue(LabelType::IP_ADDRESS); break;
+    case IP4:               value = String( (int) WiFi.localIP()[3] ); break; // 4th IP octet
+    #ifdef USES_MQTT
+    case ISMQTT:            value = String(MQTTclient_connected); break;
+    #else // ifdef USES_MQTT
+    case ISMQTT:            value = "0"; break;
+    #endif // ifdef USES_MQTT
+
+    #ifdef USES_P037
+    case ISMQTTIMP:         value = String(P037_MQTTImport_connected); break;
+    #else // ifdef USES_P037
+    case ISMQTTIMP:         value = "0"; break;
+    #endif // USES_P037
+
+
+    case ISNTP:             value = String(statusNTPInitialized); break;
+    case ISWIFI:            value = String(wifiStatus); break; // 0=disconnected, 1=connected, 2=got ip, 3=services initialized
+    case LCLTIME:           value = getValue(LabelType::LOCAL_TIME); break;
+    case LCLTIME_AM:        value = node_time.getDateTimeString_ampm('-', ':', ' '); break;
+    case LF:                value = "\n"; break;
+    case MAC:               value = getValue(LabelType::STA_MAC); break;
+  #ifdef ESP8266
+    case MAC_INT:           value = String(ESP.getChipId()); break; // Last 24 bit of MAC address as integer, to be used in rules.
+  #else // ifdef ESP8266
+    case MAC_INT:           value = ""; break;                      // FIXME TD-er: Must find proper altrnative for ESP32.
+  #endif // ifdef ESP8266
+    case RSSI:              value = getValue(LabelType::WIFI_RSSI); break;
+    case SPACE:             value = " "; break;
+    case SSID:              value = (wifiStatus == ESPEASY_WIFI_DISCONNECTED) ? F("--") : WiFi.SSID(); break;
+    case SUNRISE:           value = node_time.getSunriseTimeString(':'); break;
+    case SUNSET:            value = node_time.getSunsetTimeString(':'); break;
+    case SYSBUILD_DATE:     value = get_build_date(); break;
+    case SYSBUILD_DESCR:    value = getValue(LabelType::BUILD_DESC); break;
+    case SYSBUILD_FILENAME: value = getValue(LabelType::BINARY_FILENAME); break;
+    case SYSBUILD_GIT:      value = getValue(LabelType::GIT_BUILD); break;
+    case SYSBUILD_TIME:     value = get_build_time(); break;
+    case SYSDAY:            value = String(node_time.day()); break;
+    case SYSDAY_0:          value = timeReplacement_leadZero(node_time.day()); break;
+    case SYSHEAP:           value = String(ESP.getFreeHeap()); break;
+    case SYSHOUR:           value = String(node_time.hour()); break;
+    case SYSHOUR_0:         value = timeReplacement_leadZero(node_time.hour()); break;
+    case SYSLOAD:           value = String(getCPUload()); break;
+    case SYSMIN:            value = String(node_time.minute()); break;
+    case SYSMIN_0:          value = timeReplacement_leadZero(node_time.minute()); break;
+    case SYSMONTH:          value = String(node_time.month()); break;
+    case SYSNAME:           value = Settings.getHostname(); break;
+    case SYSSEC:            value = String(node_time.second()); break;
+    case SYSSEC_0:          value = timeReplacement_leadZero(node_time.second()); break;
+    case SYSSEC_D:          value = String(((node_time.hour() * 60) + node_time.minute()) * 60 + node_time.second()); break;
+    case SYSSTACK:          value = getValue(LabelType::FREE_STACK); break;
+    case SYSTIME:           value = node_time.getTimeString(':'); break;
+    case SYSTIME_AM:        value = node_time.getTimeString_ampm(':'); break;
+    case SYSTM_HM:          value = node_time.getTimeString(':', false); break;
+    case SYSTM_HM_AM:       value = node_time.getTimeString_ampm(':', false); break;
+    case SYSWEEKDAY:        value = String(node_time.weekday()); break;
+    case SYSWEEKDAY_S:      value = node_time.weekday_str(); break;
+    case SYSYEAR_0:
+    case SYSYEAR:           value = String(node_time.year()); break;
+    case SYSYEARS:          value = timeReplacement_leadZero(node_time.year() % 100); break;
+    case SYS_MONTH_0:       value = timeReplacement_leadZero(node_time.month()); break;
+    case S_CR:              value = F("\\r"); break;
+    case S_LF:              value = F("\\n"); break;
+    case UNIT_sysvar:       value = getValue(LabelType::UNIT_NR); break;
+    case UNIXDAY:           value = String(node_time.getUnixTime() / 86400); break;
+    case UNIXDAY_SEC:       value = String(node_time.getUnixTime() % 86400); break;
+    case UNIXTIME:          value = String(node_time.getUnixTime()); break;
+    case UPTIME:            value = String(wdcounter / 2); break;
+    #if FEATURE_ADC_VCC
+    case VCC:               value = String(vcc); break;
+    #else // if FEATURE_ADC_VCC
+    case VCC:               value = String(-1); break;
+    #endif // if FEATURE_ADC_VCC
+    case WI_CH:             value = String((wifiStatus == ESPEASY_WIFI_DISCONNECTED) ? 0 : WiFi.channel()); break;
+
+    case UNKNOWN:
+      break;
+  }
+  return value;
+}
+
 SystemVariables::Enum SystemVariables::nextReplacementEnum(const String& str, SystemVariables::Enum last_tested)
 {
   if (str.indexOf('%') == -1) {
@@ -76,6 +76,10 @@ public:
 
   static String toString(Enum enumval);
 
+  // Current value of the system variable, not URL encoded.
+  // Sunrise and sunset are returned without offset.
+  static String getSystemVariableValue(Enum enumval);
+
   static void parseSystemVariables(String& s, boolean useURLencode);
 
 
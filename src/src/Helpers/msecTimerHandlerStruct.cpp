@@ -8,7 +8,8 @@
 #define MAX_SCHEDULER_WAIT_TIME 5 // Max delay used in the scheduler for passing idle time.
 
   msecTimerHandlerStruct::msecTimerHandlerStruct() : get_called(0), get_called_ret_id(0), max_queue_length(0),
-    last_exec_time_usec(0), total_idle_time_usec(0),  idle_time_pct(0.0), is_idle(false), eco_mode(true)
+    last_exec_time_usec(0), total_idle_time_usec(0),  idle_time_pct(0.0), is_idle(false), eco_mode(true),
+    _timer_ids(MSEC_TIMER_HANDLER_RESERVE)
   {
     last_log_start_time = millis();
   }
@@ -18,9 +19,14 @@
   }
 
   void msecTimerHandlerStruct::registerAt(unsigned long id, unsigned long timer) {
-    timer_id_couple item(id, timer);
+    if (id == 0) { return; }
 
-    insert(item);
+    // Make sure only one is present with the same id.
+    _timer_ids.set(id, timer);
+  }
+
+  bool msecTimerHandlerStruct::cancel(unsigned long id) {
+    return _timer_ids.remove(id);
   }
 
   // Check if timeout has been reached and also return its set timer.
@@ -36,8 +42,8 @@
       }
       return 0;
     }
-    timer_id_couple item = _timer_ids.front();
-    const long passed    = timePassedSince(item._timer);
+    const TimerIdHeap::Entry& item = _timer_ids.top();
+    const long passed              = timePassedSince(item.timer);
 
     if (passed < 0) {
       // No timeOutReached
@@ -60,10 +66,11 @@
     unsigned long size = _timer_ids.size();
 
     if (size > max_queue_length) { max_queue_length = size; }
-    _timer_ids.pop_front();
-    timer = item._timer;
+    timer = item.timer;
+    const unsigned long id = item.id;
+    _timer_ids.pop();
     ++get_called_ret_id;
-    return item._id;
+    return id;
   }
 
 
@@ -101,33 +108,6 @@
     return idle_time_pct;
   }
 
-  struct match_id {
-    match_id(unsigned long id) : _id(id) {}
-
-    bool operator()(const timer_id_couple& item) {
-      return _id == item._id;
-    }
-
-    unsigned long _id;
-  };
-
-  void msecTimerHandlerStruct::insert(const timer_id_couple& item) {
-    if (item._id == 0) { return; }
-
-    // Make sure only one is present with the same id.
-    _timer_ids.remove_if(match_id(item._id));
-    const bool mustSort = !_timer_ids.empty();
-    _timer_ids.push_front(item);
-
-    if (mustSort) {
-      _timer_ids.sort(); // TD-er: Must check if this is an expensive operation.
-    }
-
-    // It should be a relative light operation, to insert into a sorted list.
-    // Perhaps it is better to use std::set ????
-    // Keep in mind: order is based on timer, uniqueness is based on id.
-  }
-
   void msecTimerHandlerStruct::recordIdle() {
     if (is_idle) { return; }
     last_exec_time_usec = micros();
@@ -2,9 +2,13 @@
 #define HELPERS_MSECTIMERHANDLERSTRUCT_H
 
 
-#include <list>
+#include "../DataStructs/TimerIdHeap.h"
 
-#include "../DataStructs/timer_id_couple.h"
+#ifndef MSEC_TIMER_HANDLER_RESERVE
+
+// Initial capacity of the timer queue, will grow when needed.
+# define MSEC_TIMER_HANDLER_RESERVE  32
+#endif // ifndef MSEC_TIMER_HANDLER_RESERVE
 
 class String;
 
@@ -15,6 +19,10 @@ struct msecTimerHandlerStruct {
 
   void registerAt(unsigned long id, unsigned long timer);
 
+  // Remove a scheduled timer.
+  // Return false when no timer with given id was scheduled.
+  bool cancel(unsigned long id);
+
   // Check if timeout has been reached and also return its set timer.
   // Return 0 if no item has reached timeout moment.
   unsigned long getNextId(unsigned long& timer);
@@ -27,8 +35,6 @@ struct msecTimerHandlerStruct {
 
 private:
 
-  void insert(const timer_id_couple& item);
-
   void recordIdle();
 
   void recordRunning();
@@ -46,8 +52,8 @@ private:
   bool          is_idle;
   bool          eco_mode;
 
-  // The list of set timers
-  std::list<timer_id_couple>_timer_ids;
+  // The set timers, ordered by timer
+  TimerIdHeap _timer_ids;
 };
 
 #endif // HELPERS_MSECTIMERHANDLERSTRUCT_H
\ No newline at end of file
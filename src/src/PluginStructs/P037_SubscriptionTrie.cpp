@@ -0,0 +1,142 @@
+#include "P037_SubscriptionTrie.h"
+
+
+#ifdef USES_P037
+
+namespace {
+// Return the end of the topic level starting at level ('/' or end of string)
+const char* levelEnd(const char *level) {
+  while (*level != '\0' && *level != '/') {
+    ++level;
+  }
+  return level;
+}
+
+// Return the start of the next topic level, or nullptr when it was the last level.
+// A trailing '/' does not start a new level.
+const char* nextLevel(const char *end) {
+  if ((*end == '\0') || (*(end + 1) == '\0')) {
+    return nullptr;
+  }
+  return end + 1;
+}
+
+bool levelEquals(const String& level, const char *topicLevel, size_t length) {
+  return level.length() == length && strncmp(level.c_str(), topicLevel, length) == 0;
+}
+} // namespace
+
+void P037_SubscriptionTrie::clear() {
+  nodes.clear();
+  slots.clear();
+  nextSlot.clear();
+}
+
+bool P037_SubscriptionTrie::empty() const {
+  return slots.empty();
+}
+
+void P037_SubscriptionTrie::add(const String& subscription,
+                                taskIndex_t   taskIndex,
+                                byte          valueIndex,
+                                const String& valueName) {
+  String sub = subscription;
+
+  sub.trim();
+
+  if (sub.length() == 0) { return; }
+
+  if (nodes.empty()) {
+    nodes.emplace_back(String());
+  }
+  const char *level = sub.c_str();
+
+  if (*level == '/') { ++level; }
+  uint16_t node = 0;
+
+  while (level != nullptr) {
+    const char *end = levelEnd(level);
+    node = findOrAddChild(node, level, end - level);
+
+    if ((node == NO_NODE) || nodes[node].level.equals(F("#"))) {
+      // Levels after '#' are not valid.
+      break;
+    }
+    level = nextLevel(end);
+  }
+
+  if (node == NO_NODE) { return; }
+  slots.emplace_back(taskIndex, valueIndex, valueName);
+  nextSlot.push_back(nodes[node].firstSlot);
+  nodes[node].firstSlot = slots.size() - 1;
+}
+
+void P037_SubscriptionTrie::match(const char                         *topic,
+                                  std::vector<const P037_SubscriptionSlot *>& result) const {
+  if (nodes.empty() || (topic == nullptr)) { return; }
+
+  if (*topic == '/') { ++topic; }
+  matchLevel(0, (*topic == '\0') ? nullptr : topic, result);
+}
+
+uint16_t P037_SubscriptionTrie::findOrAddChild(uint16_t parent, const char *level, size_t length) {
+  uint16_t child = nodes[parent].firstChild;
+
+  while (child != NO_NODE) {
+    if (levelEquals(nodes[child].level, level, length)) {
+      return child;
+    }
+    child = nodes[child].nextSibling;
+  }
+
+  if (nodes.size() >= NO_NODE) { return NO_NODE; }
+  String str;
+
+  str.reserve(length);
+
+  for (size_t i = 0; i < length; ++i) {
+    str += level[i];
+  }
+  nodes.emplace_back(str);
+  child                    = nodes.size() - 1;
+  nodes[child].nextSibling = nodes[parent].firstChild;
+  nodes[parent].firstChild = child;
+  return child;
+}
+
+// level is the start of the topic level to match with the children of parent,
+// or nullptr when all levels of the topic are matched.
+void P037_SubscriptionTrie::matchLevel(uint16_t                              parent,
+                                       const char                           *level,
+                                       std::vector<const P037_SubscriptionSlot *>& result) const {
+  const char *end    = (level == nullptr) ? nullptr : levelEnd(level);
+  const char *next   = (end == nullptr) ? nullptr : nextLevel(end);
+  const size_t length = (level == nullptr) ? 0 : end - level;
+
+  for (uint16_t child = nodes[parent].firstChild; child != NO_NODE; child = nodes[child].nextSibling) {
+    const String& childLevel = nodes[child].level;
+
+    if (childLevel.equals(F("#"))) {
+      // Matches the remaining levels, also when there are none left.
+      addSlots(child, result);
+      continue;
+    }
+
+    if (level == nullptr) { continue; }
+
+    if (childLevel.equals(F("+")) || levelEquals(childLevel, level, length)) {
+      if (next == nullptr) {
+        addSlots(child, result);
+      }
+      matchLevel(child, next, result);
+    }
+  }
+}
+
+void P037_SubscriptionTrie::addSlots(uint16_t node, std::vector<const P037_SubscriptionSlot *>& result) const {
+  for (uint16_t slot = nodes[node].firstSlot; slot != NO_NODE; slot = nextSlot[slot]) {
+    result.push_back(&slots[slot]);
+  }
+}
+
+#endif // ifdef USES_P037
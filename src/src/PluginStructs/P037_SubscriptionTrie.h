@@ -0,0 +1,86 @@
+#ifndef PLUGINSTRUCTS_P037_SUBSCRIPTIONTRIE_H
+#define PLUGINSTRUCTS_P037_SUBSCRIPTIONTRIE_H
+
+#include "../../_Plugin_Helper.h"
+
+#ifdef USES_P037
+
+# include <vector>
+
+
+// Task value which is set by a matching MQTT message
+struct P037_SubscriptionSlot {
+  P037_SubscriptionSlot(taskIndex_t task, byte value, const String& valueName) :
+    taskIndex(task), valueIndex(value), name(valueName) {}
+
+  taskIndex_t taskIndex;
+  byte        valueIndex;
+  String      name; // "taskname#valuename", used in the log and the rules event
+};
+
+
+/*********************************************************************************************\
+* P037_SubscriptionTrie
+*
+* The subscriptions of all MQTT Import tasks, compiled into a tree of topic levels.
+* An incoming topic is matched level by level, so only the subscriptions sharing the
+* levels already matched are checked, without loading the task settings per message.
+*
+* Subscriptions follow the MQTT topic filter rules:
+* - '+' matches exactly one topic level
+* - '#' matches the remaining levels (also none), must be the last level
+* A leading and a trailing '/' are ignored, so "/home/temp/" matches "home/temp".
+\*********************************************************************************************/
+class P037_SubscriptionTrie {
+public:
+
+  void   clear();
+
+  bool   empty() const;
+
+  // Add the subscription of a task value.
+  void   add(const String& subscription,
+             taskIndex_t   taskIndex,
+             byte          valueIndex,
+             const String& valueName);
+
+  // Collect the task values of which the subscription matches the topic.
+  void   match(const char                         *topic,
+               std::vector<const P037_SubscriptionSlot *>& result) const;
+
+  // Number of task values with a subscription
+  size_t size() const {
+    return slots.size();
+  }
+
+private:
+
+  static const uint16_t NO_NODE = 0xFFFF;
+
+  struct Node {
+    explicit Node(const String& topicLevel) : level(topicLevel) {}
+
+    String   level;                 // Topic level, "+" or "#"
+    uint16_t firstChild  = NO_NODE;
+    uint16_t nextSibling = NO_NODE;
+    uint16_t firstSlot   = NO_NODE; // First slot of which the subscription ends at this node
+  };
+
+  uint16_t findOrAddChild(uint16_t      parent,
+                          const char   *level,
+                          size_t        length);
+
+  void     matchLevel(uint16_t                              parent,
+                      const char                           *level,
+                      std::vector<const P037_SubscriptionSlot *>& result) const;
+
+  void     addSlots(uint16_t                              node,
+                    std::vector<const P037_SubscriptionSlot *>& result) const;
+
+  std::vector<Node>                  nodes; // nodes[0] is the root
+  std::vector<P037_SubscriptionSlot> slots;
+  std::vector<uint16_t>              nextSlot; // Next slot ending at the same node, per slot
+};
+
+#endif // ifdef USES_P037
+#endif // PLUGINSTRUCTS_P037_SUBSCRIPTIONTRIE_H
@@ -0,0 +1,258 @@
+// Generated by tools/pio/generate-web-static-gz.py from the files in static/
+// Do not edit, changes will be overwritten.
+
+#ifndef STATIC_WEBSTATICDATA_GZ_H
+#define STATIC_WEBSTATICDATA_GZ_H
+
+static const char WEB_STATIC_CONTENT_TYPE_CSS[] PROGMEM = "text/css";
+static const char WEB_STATIC_CONTENT_TYPE_JS[] PROGMEM = "application/javascript";
+
+
+// espeasy_default.min.css: 5275 bytes, gzip compressed 1694 bytes
+static const char DATA_ESPEASY_DEFAULT_MIN_CSS_GZ_URL[] PROGMEM = "/static/espeasy_default.min.css";
+static const char DATA_ESPEASY_DEFAULT_MIN_CSS_GZ_HASH[] PROGMEM = "fc81eb7b";
+static const uint8_t DATA_ESPEASY_DEFAULT_MIN_CSS_GZ[] PROGMEM = {
+  0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xad,0x18,0xdb,0x8e,0x9b,0x38,0xf4,0x7d,0xbf,0x02,
+  0xa9,0x1a,0x4d,0xbb,0x02,0x44,0xc8,0x65,0x12,0xf2,0xd2,0xee,0x4c,0xf2,0xb4,0xfb,0x0d,0x95,0x01,0x13,
+  0xac,0x01,0x1b,0x19,0x67,0x92,0x14,0xb1,0xdf,0xbe,0xc7,0x06,0x83,0xb9,0x64,0x3a,0x5b,0x55,0x51,0x3b,
+  0xe6,0xf8,0xf8,0xdc,0x6f,0xb6,0x1b,0x65,0xac,0xc4,0xa1,0xa0,0x76,0xba,0xb0,0x53,0xdf,0x4e,0x97,0x55,
+  0xc2,0xa8,0x70,0x2e,0x98,0x9c,0x52,0x11,0x3c,0x79,0x5e,0x2d,0x37,0x36,0x55,0xc4,0x32,0xc6,0x83,0x4f,
+  0xde,0xd3,0x4b,0xed,0x46,0x29,0x8e,0x5e,0x73,0xc4,0x5f,0x03,0x94,0x08,0xcc,0x6d,0x37,0x66,0xa2,0xff,
+  0x04,0x54,0x2a,0x30,0x15,0xc1,0xe3,0x63,0xed,0x86,0x67,0x21,0x18,0xb5,0xdd,0x1c,0xd3,0x73,0x25,0xf0,
+  0x55,0x38,0x31,0x8e,0x18,0x47,0x82,0x30,0x1a,0x50,0x46,0x71,0xed,0xc6,0xe4,0xed,0x7b,0xd6,0x62,0x24,
+  0x19,0x43,0x22,0xc8,0x70,0x22,0x80,0x8b,0x96,0x4c,0x61,0xf0,0x76,0x8f,0x4b,0xb9,0xf6,0xad,0x34,0x49,
+  0x92,0xd4,0x7f,0x56,0x21,0xbb,0x3a,0x25,0xf9,0x41,0xe8,0x29,0x08,0x19,0x8f,0x31,0x77,0x00,0xb2,0x57,
+  0x6a,0x24,0x28,0x27,0xd9,0x2d,0x28,0x11,0x2d,0x9d,0x12,0x73,0x92,0x34,0x60,0xc0,0xc6,0xc1,0xc2,0x2f,
+  0xc4,0x1e,0xc4,0x3e,0x11,0x1a,0x78,0xfb,0x02,0xc5,0xb1,0xa4,0x20,0xf5,0xad,0x0c,0xa4,0x4d,0x8f,0xb4,
+  0x2d,0xae,0x16,0x6c,0xf7,0x46,0xea,0xc8,0x00,0xb0,0x0a,0x51,0xf4,0x7a,0xe2,0xec,0x4c,0x63,0xa7,0x95,
+  0x6e,0xb5,0x5a,0x69,0x41,0x8f,0xc7,0x63,0xc7,0xca,0x72,0x56,0xc5,0xb5,0xe3,0xb7,0x29,0xae,0x35,0xd0,
+  0x9b,0x9e,0x3e,0x1c,0x0e,0x7b,0x83,0x50,0x7b,0x1a,0xe4,0xb9,0x2a,0x02,0x56,0x2f,0xf2,0x4a,0x92,0xd8,
+  0x98,0x22,0x79,0x20,0x52,0xc4,0x62,0x6c,0xbf,0x86,0xb1,0x5d,0x70,0x6c,0x97,0x28,0x2f,0x6c,0x21,0xec,
+  0x6b,0x5e,0x54,0xa6,0x61,0x72,0x46,0x59,0x59,0xa0,0x08,0xdb,0xdd,0xca,0xb4,0x10,0xce,0xb5,0x07,0x67,
+  0x04,0x84,0x50,0xd8,0x37,0xf6,0x56,0x8e,0x6c,0xd7,0x0e,0x47,0x31,0x39,0x97,0x52,0xa8,0x19,0xe5,0x4d,
+  0xcd,0xa5,0x12,0x52,0x1d,0xcd,0xc2,0x4d,0x71,0x56,0xd8,0x7d,0x70,0xd9,0x84,0x16,0x67,0x61,0x97,0x38,
+  0xc3,0x91,0xb0,0x65,0xec,0x20,0x8e,0x51,0xd5,0xb2,0x69,0x68,0x9f,0x38,0xba,0x69,0xc6,0xa5,0xb8,0x65,
+  0x38,0x28,0x59,0x46,0x62,0x0d,0xba,0x90,0x58,0xa4,0xc1,0xc2,0xe0,0x91,0x11,0xfa,0xea,0x02,0x18,0x57,
+  0x31,0x29,0x8b,0x0c,0xdd,0x02,0x42,0x01,0x86,0x9d,0x30,0x63,0xd1,0xeb,0x5e,0x45,0x28,0xca,0xc8,0x89,
+  0x06,0x11,0x84,0x30,0xe6,0xfb,0x96,0x84,0xe7,0x3d,0x0c,0x69,0x70,0x1c,0x4f,0x6d,0x02,0xc0,0x81,0x36,
+  0xd5,0xd0,0x26,0x6b,0xef,0xa1,0xd3,0xde,0x07,0xed,0xa5,0xe3,0x3e,0xaa,0x6f,0x6f,0x56,0xcd,0x21,0x48,
+  0xd9,0x1b,0x64,0x5b,0x2f,0x44,0xf0,0x69,0xb9,0xd9,0xd5,0x8a,0x4a,0xb3,0xd7,0xd2,0x9a,0x20,0x6a,0x0f,
+  0x46,0x51,0x54,0xdf,0x61,0x3a,0xc1,0xc5,0x18,0xdf,0x73,0x22,0xe4,0x45,0x43,0x46,0x19,0xb6,0xa5,0xd5,
+  0x18,0x39,0x47,0xd7,0xd6,0x09,0x6b,0xcf,0x83,0x63,0xcd,0x7a,0x2b,0x8d,0x29,0xf7,0xe9,0x39,0x0f,0x41,
+  0xb2,0x79,0xac,0x85,0x5c,0x83,0x7d,0x20,0x1c,0x11,0x78,0x08,0xca,0x4c,0xb7,0xf4,0x47,0xf9,0xa7,0xc5,
+  0x71,0x64,0xe5,0x08,0x96,0x6b,0x19,0x7b,0x67,0x5e,0x82,0xdc,0x05,0x23,0xd2,0x8d,0x06,0x99,0xca,0xc9,
+  0xd9,0x0f,0xe7,0x5c,0xca,0x88,0x69,0xcc,0xa3,0xa2,0xd7,0xc9,0xcb,0x19,0xe0,0x05,0x87,0xaf,0x44,0x4c,
+  0x37,0x74,0xf0,0x34,0x51,0xd3,0xd8,0xa5,0x61,0x2e,0x8d,0xd3,0x7e,0x0b,0x56,0xc8,0xc2,0xc2,0x4a,0xa2,
+  0xaa,0x1d,0xc7,0x19,0x94,0xbd,0x37,0xbc,0x1f,0x53,0x33,0x84,0xb3,0x94,0x1d,0xab,0xa1,0xf0,0x7b,0x06,
+  0x79,0x49,0xc4,0xcd,0x24,0x86,0x42,0x08,0xf4,0xb3,0xc0,0x46,0xfc,0x40,0x99,0x2c,0x51,0x98,0xcd,0xc5,
+  0xe5,0x89,0xe3,0x9b,0x81,0x79,0xc7,0xbd,0x69,0x53,0xf3,0x7d,0x69,0x3e,0xa5,0xcb,0x0c,0xbf,0x7d,0xa3,
+  0x54,0xe3,0x21,0x89,0x69,0x08,0xdf,0xc4,0x59,0xa3,0xc2,0xbf,0xef,0x72,0x93,0x81,0x37,0x56,0x3a,0x50,
+  0x07,0x70,0xfc,0xfe,0xc9,0xb9,0xfe,0xd3,0xa5,0xb2,0x72,0xcd,0x9c,0x89,0x7e,0xca,0x49,0x37,0x32,0x23,
+  0xc2,0x06,0x2e,0x36,0x69,0x4c,0xd8,0xcb,0xd0,0x11,0x1c,0x5a,0x4c,0xc2,0x78,0x1e,0x70,0x26,0x90,0xc0,
+  0x9f,0x57,0xeb,0x18,0x9f,0xbe,0x74,0x11,0x74,0x6f,0xbf,0x2d,0xa0,0xaa,0x6a,0x59,0xb2,0x9f,0x0d,0x4b,
+  0x97,0x67,0x2d,0x21,0xc1,0x96,0xaa,0xdc,0xb7,0xee,0x59,0x78,0xda,0x3d,0x4f,0xb0,0x90,0xee,0x58,0xca,
+  0xbf,0x77,0xe8,0xb7,0x69,0x05,0x7e,0xfa,0x24,0x18,0x2a,0x45,0x8e,0xcb,0x12,0x9d,0x70,0xd7,0xb2,0x6d,
+  0x37,0x63,0xa7,0x37,0x82,0x2f,0xb2,0x40,0x7c,0xa0,0xb2,0xde,0x21,0x53,0x4d,0x0b,0xae,0x61,0xca,0xdf,
+  0x91,0x71,0x6d,0x4e,0x85,0x0c,0x4a,0x5f,0x1e,0xf8,0x5e,0x9f,0x66,0xca,0x16,0x3b,0x59,0x93,0xfe,0x4f,
+  0xa6,0xf9,0xbf,0x90,0x6a,0x9d,0xb2,0xb3,0xe9,0x33,0xad,0xf5,0x3a,0xa1,0x36,0x1f,0x4e,0xa8,0xcd,0xd0,
+  0x72,0xc3,0x8c,0xba,0xcf,0x7e,0x98,0x4f,0xfe,0x38,0xcc,0xef,0x1f,0x54,0xe9,0x34,0x9c,0xde,0x3e,0x9c,
+  0x4c,0xf7,0xd8,0x8c,0xe8,0x8c,0xf3,0xc7,0xb7,0x46,0x88,0x66,0x03,0x33,0x12,0x60,0x6a,0xc7,0xad,0x36,
+  0xe3,0xb6,0x0d,0xfc,0x6d,0xdf,0x51,0xa4,0xdd,0xba,0x48,0xee,0xfb,0x98,0x39,0xeb,0x3c,0xfe,0x7d,0x8e,
+  0x48,0x8c,0xac,0x67,0x46,0x41,0x17,0xfc,0x68,0xff,0xc3,0x28,0x8a,0x98,0x31,0xf9,0xf4,0x7d,0x08,0x7a,
+  0x8f,0x37,0xed,0x72,0x46,0xfb,0x1a,0xa4,0xc1,0xbb,0xc3,0x91,0x39,0x10,0xb5,0xd1,0xbb,0x04,0x9d,0xfa,
+  0x09,0xd6,0x1c,0xb8,0x9e,0xb4,0x8a,0xfe,0xd6,0x1f,0x45,0xb8,0xb3,0x50,0x85,0x39,0x87,0x6f,0x5d,0x7d,
+  0x4d,0x11,0xe5,0x24,0xd5,0xbb,0x2b,0x21,0x57,0x1c,0xcf,0x4c,0x33,0x6f,0xa4,0x24,0x21,0xc9,0x64,0x84,
+  0xa7,0x24,0x86,0x06,0xbc,0xff,0xe1,0x10,0x1a,0xe3,0x6b,0xb0,0x18,0xaa,0xe4,0x96,0x29,0xbb,0x54,0x3a,
+  0x1b,0x11,0x25,0x79,0x33,0xb2,0x27,0x28,0xc6,0x84,0x5a,0xee,0xba,0xb4,0xe5,0x92,0x9d,0x85,0x5c,0x5b,
+  0x3e,0xfc,0xb7,0xff,0x18,0x96,0x21,0x82,0x5a,0x66,0xb8,0xfe,0xaa,0xf9,0xbc,0xe2,0x5b,0xc2,0x11,0x88,
+  0x60,0x35,0x14,0xaa,0x84,0xb3,0xbc,0xea,0x72,0xfe,0xa1,0x4f,0xcf,0x5a,0xb0,0xca,0xb0,0xa6,0x86,0xbb,
+  0xbb,0xba,0xfe,0xfa,0x7b,0xa8,0xcc,0xcb,0x04,0xaa,0x0c,0xc8,0x8d,0x8e,0xf5,0xf4,0x3c,0x83,0xcb,0x58,
+  0xa4,0x5f,0x23,0xe2,0x66,0xf8,0x0d,0x67,0xdf,0x3d,0x7d,0x15,0x3b,0x2e,0xe4,0x4f,0x83,0x17,0x1d,0xf8,
+  0xf9,0x78,0xdc,0xad,0x35,0xd8,0xd7,0xe0,0xdd,0xcb,0xf3,0xe1,0x78,0xd0,0xe0,0xa5,0x06,0x7f,0x5b,0x1d,
+  0x9f,0x9f,0x76,0x1a,0xbc,0xea,0x88,0xf8,0xdf,0xfe,0x5a,0x76,0xe0,0x5d,0x07,0x5e,0x7b,0xb5,0xd9,0x30,
+  0x26,0x61,0xef,0x3f,0xc9,0xdf,0x7e,0x20,0xa1,0x4e,0xdf,0xf5,0x52,0xc6,0xab,0x2c,0x68,0x70,0x93,0xbb,
+  0x04,0xe8,0x2c,0x58,0xad,0x13,0xf5,0xdd,0x11,0x55,0xc8,0xa9,0xc6,0xcd,0xcf,0x99,0x20,0x9c,0x5d,0x2c,
+  0x91,0xda,0x0d,0x84,0x42,0xbb,0x43,0x19,0x7c,0xdf,0xb9,0x7b,0x0d,0xfa,0xd9,0xa7,0xed,0x76,0x6b,0x5e,
+  0x48,0x46,0xb7,0x5c,0xf3,0x3e,0xb6,0x57,0x29,0xe3,0xe8,0x6b,0x6c,0x9b,0x3a,0x93,0x64,0x1a,0xc9,0x35,
+  0x10,0xca,0xe8,0xa5,0x19,0x2a,0x4a,0x1c,0xe8,0x85,0x16,0x01,0xea,0x8b,0x91,0xca,0x2b,0x7f,0x30,0xf6,
+  0x3e,0x4c,0x54,0xe6,0x23,0x95,0xe3,0xd1,0x37,0xaf,0xcc,0xcb,0xe0,0x08,0xb7,0x6a,0x1d,0x20,0xed,0x3f,
+  0xa1,0x3c,0xd8,0x35,0x0b,0xde,0x4f,0x15,0x06,0xae,0x01,0x15,0xa9,0x13,0xa5,0x24,0x8b,0x3f,0x43,0xa0,
+  0xd0,0x2f,0x33,0x8e,0x78,0x39,0x1c,0x36,0xc7,0x63,0xed,0xa6,0xc0,0x24,0x93,0x8c,0x24,0xcb,0x29,0x5a,
+  0x1c,0x26,0x89,0xe7,0x3d,0x41,0xdc,0xa2,0x22,0xc5,0x90,0x23,0x30,0x8c,0x35,0x7f,0xd5,0xbb,0xc0,0xf4,
+  0xc0,0x71,0x2b,0x7f,0x9d,0xc0,0xf2,0x6e,0x0e,0x37,0x01,0xe8,0x02,0x94,0x09,0x5c,0x19,0x51,0xd0,0x54,
+  0x57,0x35,0xc1,0x10,0x01,0xea,0x40,0xa7,0x34,0x09,0xeb,0x07,0x03,0x95,0x6f,0x30,0xb8,0x58,0xed,0x28,
+  0xf6,0xf2,0xf2,0xa2,0x03,0x77,0xe7,0xcd,0xf4,0xef,0xa6,0xc2,0xaa,0xd7,0x08,0x00,0x37,0x4d,0xbc,0xaf,
+  0xa5,0x6e,0xc8,0xe2,0x9b,0x62,0x60,0xdc,0x05,0x76,0xaa,0xbb,0x4b,0x68,0x88,0xc0,0x61,0x9a,0x12,0xa1,
+  0x29,0xe6,0x44,0x28,0x1a,0xeb,0xb5,0x46,0xa9,0x06,0x93,0xa1,0x1a,0xef,0x0a,0xc8,0x14,0x2a,0xa6,0x6d,
+  0xc5,0x52,0xcf,0x01,0x30,0x21,0x0e,0x86,0x30,0x75,0xbd,0x6e,0xfe,0x99,0xef,0x08,0xe3,0xdb,0x77,0xd3,
+  0xd7,0x52,0x22,0xb0,0xa3,0x9a,0x20,0xf4,0xfd,0x0b,0x47,0x45,0x23,0x84,0x8b,0x22,0x39,0x47,0xcd,0x99,
+  0x1f,0x52,0x68,0x98,0x5f,0xd0,0xf1,0x94,0xd5,0x2c,0xb5,0xd7,0x87,0x79,0x43,0x69,0xe6,0xb2,0xfa,0x72,
+  0x98,0xa2,0x7d,0x6f,0x5f,0x1b,0xcc,0x21,0xa4,0x76,0x01,0xd0,0xdd,0x63,0x30,0x85,0xef,0x24,0xa9,0x8c,
+  0x0b,0x77,0xf3,0x3c,0x34,0xd3,0x83,0xb7,0xde,0x4c,0x0f,0x6e,0x2f,0xb1,0xbe,0xd9,0x3b,0xa5,0x2d,0xd4,
+  0x65,0x13,0x65,0x98,0x0b,0xdb,0xbd,0x20,0x4e,0x61,0xa3,0x1a,0x0e,0x9d,0x8b,0xb5,0x71,0x46,0x65,0xac,
+  0xf1,0x0c,0xa5,0xa4,0x08,0x79,0x15,0x65,0x18,0xf1,0x00,0x4e,0xa4,0x2d,0xb5,0x19,0xc1,0x92,0xd5,0x6a,
+  0xb9,0xdc,0xd4,0x1d,0x9b,0x19,0x8c,0x24,0x42,0x8b,0xa7,0xfe,0x0d,0x6c,0x3c,0xa6,0xf6,0x23,0x83,0x2f,
+  0x15,0x51,0x2f,0x18,0x7a,0xda,0x1c,0x8f,0xc6,0x4a,0x6c,0x15,0x40,0x4d,0xbc,0xb9,0xcb,0xb2,0x27,0xdc,
+  0xfa,0xc5,0xf0,0x43,0x09,0xc3,0x32,0xa0,0x55,0xba,0x50,0x3b,0x57,0x55,0xaa,0xcd,0xea,0xf4,0x35,0xc7,
+  0x31,0x41,0x56,0x19,0x49,0x77,0x58,0x88,0xc6,0xd6,0xe7,0x7e,0x74,0xda,0x6d,0x40,0x80,0x2f,0x95,0x1a,
+  0x20,0xa4,0x4b,0x33,0x14,0xe2,0x6c,0xe4,0xd0,0x36,0x33,0xba,0x69,0x6b,0xf1,0x76,0x31,0x86,0xaf,0x95,
+  0x9c,0xe6,0xea,0x3f,0xfe,0x03,0x85,0x6a,0x35,0xf0,0x9b,0x14,0x00,0x00
+};
+static const WebStaticFile WEB_STATIC_ESPEASY_DEFAULT_MIN_CSS = {
+  DATA_ESPEASY_DEFAULT_MIN_CSS_GZ_URL, WEB_STATIC_CONTENT_TYPE_CSS, DATA_ESPEASY_DEFAULT_MIN_CSS_GZ_HASH, DATA_ESPEASY_DEFAULT_MIN_CSS_GZ, sizeof(DATA_ESPEASY_DEFAULT_MIN_CSS_GZ)
+};
+
+
+// fetch_and_parse_log.min.js: 2367 bytes, gzip compressed 1066 bytes
+#ifdef WEBSERVER_LOG
+static const char DATA_FETCH_AND_PARSE_LOG_MIN_JS_GZ_URL[] PROGMEM = "/static/fetch_and_parse_log.min.js";
+static const char DATA_FETCH_AND_PARSE_LOG_MIN_JS_GZ_HASH[] PROGMEM = "3dad168c";
+static const uint8_t DATA_FETCH_AND_PARSE_LOG_MIN_JS_GZ[] PROGMEM = {
+  0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xa5,0x55,0x51,0x73,0xda,0x38,0x10,0xfe,0x2b,0x8a,
+  0x1e,0xa8,0x74,0xd6,0x19,0xc8,0x4d,0x5f,0x0c,0x82,0x69,0x9b,0xdc,0x34,0x33,0x34,0xed,0x5c,0x69,0xef,
+  0x01,0x98,0x8c,0xb1,0x17,0xe3,0x8b,0x90,0x3c,0x92,0x20,0x61,0x82,0xff,0xfb,0xad,0x6d,0x48,0x42,0x9a,
+  0xf4,0x9a,0xb9,0x17,0x6c,0x6b,0xb5,0xdf,0x7e,0xbb,0xfb,0xed,0xb2,0x58,0xeb,0xc4,0xe7,0x46,0x93,0x0c,
+  0xfc,0x7b,0x6b,0x6e,0x1c,0x58,0xc6,0xef,0x36,0xb1,0x25,0x20,0x8c,0xd4,0xf1,0x26,0xcf,0x62,0x6f,0x6c,
+  0xb8,0x46,0xc3,0xbb,0x0c,0xb4,0x17,0x5e,0x9a,0x70,0x15,0xfb,0x64,0xc9,0xda,0xcc,0x14,0x60,0xe3,0x5d,
+  0xb2,0xb4,0x66,0x05,0x3b,0x17,0x2f,0x62,0x9b,0xef,0x16,0xb9,0x85,0x85,0xb9,0xdd,0xad,0x5c,0x0e,0x3b,
+  0x6f,0xf3,0x14,0x9d,0xd8,0x50,0x4e,0xdb,0x9c,0x4f,0xdb,0xc3,0xa9,0xfb,0x8d,0x4d,0xd3,0x80,0xb7,0x73,
+  0xbe,0xdb,0x4d,0x66,0x3d,0x0b,0x7e,0x6d,0x75,0x7b,0x7f,0xaf,0x9d,0x87,0x1e,0x9c,0x67,0x7e,0xd2,0x9d,
+  0xf1,0xe1,0x9d,0x8e,0x57,0x10,0xd1,0x8b,0x73,0x2a,0x36,0x60,0x1d,0xb2,0x8c,0x18,0xc8,0xf6,0x74,0x6e,
+  0x37,0x13,0x12,0xcd,0x82,0x06,0x28,0x0b,0xe1,0x16,0x12,0x66,0x6a,0x3c,0x8e,0x8e,0xbb,0x1d,0xa5,0x65,
+  0x44,0x3f,0xd4,0xac,0xa8,0x94,0xb2,0x42,0x6b,0xb5,0xf4,0x5a,0xa9,0x13,0x89,0x00,0xf7,0xf4,0xa7,0xf3,
+  0xcf,0x5f,0xfe,0xda,0x9d,0xa7,0x19,0x4c,0xdb,0x0d,0x16,0xbf,0x0f,0xfa,0xb9,0xca,0xec,0x21,0x2e,0x20,
+  0x44,0x19,0x31,0x8f,0x58,0xa7,0xb3,0xe1,0xa4,0x42,0x14,0xd5,0xeb,0x2c,0x9a,0x3c,0xd4,0x28,0x2e,0x8a,
+  0x4b,0x74,0x16,0x47,0x27,0xdf,0x1b,0x04,0x41,0x7f,0x1f,0xd2,0x99,0xf8,0x91,0xc4,0x3e,0xc2,0x81,0x41,
+  0xce,0x79,0xab,0xe5,0x43,0x57,0xa8,0x3c,0x01,0xd6,0x15,0x5d,0x51,0x85,0xe6,0xa2,0xa1,0xe5,0x27,0x9d,
+  0xd9,0x3d,0xa7,0x8a,0x44,0xc9,0xcb,0xaa,0x57,0xf3,0xa6,0x73,0xf2,0x71,0x13,0x45,0xb2,0xb6,0x16,0x6b,
+  0xba,0x3f,0x90,0xfb,0x3b,0x61,0x05,0x14,0x1c,0x3e,0xf6,0x58,0x3d,0xf6,0xd8,0x2a,0x9f,0x58,0xfb,0xdd,
+  0x53,0x3e,0xf4,0x70,0xeb,0xc7,0xe6,0x2c,0x47,0x66,0xf1,0x56,0xd2,0x73,0x6b,0x8d,0x8d,0x08,0x0d,0x8e,
+  0xa3,0x04,0x94,0xe4,0x8e,0x68,0xe3,0x89,0x5b,0x17,0x85,0xb1,0x1e,0xd2,0x13,0xf2,0x45,0x41,0xec,0x80,
+  0x78,0xbb,0x25,0x31,0x59,0x99,0x14,0xac,0x26,0x37,0x30,0x3f,0xb0,0x0e,0x69,0xf4,0x04,0xfc,0x4f,0xc0,
+  0xd2,0xe4,0x3a,0x23,0xca,0x64,0x04,0xc1,0x6d,0x0e,0x2e,0x0c,0x43,0x2a,0x52,0x93,0xac,0x57,0x78,0x10,
+  0x62,0xa2,0xe7,0x0a,0xaa,0xd7,0xf7,0xdb,0x8b,0x94,0xd1,0xc4,0x14,0xdb,0x31,0x82,0x5c,0x75,0x29,0x0f,
+  0x73,0xad,0xc1,0x7e,0x1c,0x7f,0x1a,0xc9,0x23,0x5c,0xa1,0x8c,0x29,0xce,0x60,0x84,0xbf,0xac,0x0b,0x7f,
+  0x88,0x0e,0xef,0x55,0xb5,0xc3,0x18,0x23,0xd8,0x80,0x92,0x1a,0x6e,0xc8,0x3b,0x6b,0xe3,0x2d,0xa3,0xdf,
+  0x34,0xea,0x3d,0xa5,0xa2,0x49,0x13,0x9f,0x17,0x7a,0x61,0xf0,0x71,0x06,0xf3,0x75,0x76,0x78,0x92,0x4f,
+  0xc6,0x02,0x7e,0x7c,0xd3,0x29,0x2c,0x72,0x5d,0xdf,0xff,0x95,0xf7,0xc6,0xf9,0x0c,0x36,0x94,0xf7,0x16,
+  0x87,0xf1,0x7b,0xc4,0x0d,0x07,0xaf,0x99,0x40,0x2f,0x74,0x2f,0x77,0x97,0xf1,0x25,0x8a,0xbb,0xd5,0x62,
+  0x46,0x76,0x79,0x2d,0x20,0x29,0x01,0x3f,0x41,0x62,0x12,0x5c,0xb8,0xc4,0x1a,0xa5,0xb0,0x58,0x57,0x7e,
+  0x5b,0x80,0x84,0xbe,0x7c,0xdb,0xe9,0x0c,0x69,0xbc,0xf6,0x86,0x46,0xd4,0xad,0x8c,0xf1,0x4b,0x5a,0x27,
+  0x6a,0x25,0xa5,0x42,0xc9,0x8e,0x70,0xd2,0x81,0xbf,0xd0,0x1e,0xec,0x26,0x56,0xec,0x40,0x01,0xc7,0x5e,
+  0x0d,0x3a,0xc3,0x04,0x9b,0x65,0xef,0x8d,0x8e,0x47,0x2c,0x08,0xcc,0xa0,0x3b,0x54,0xb2,0x1b,0x2d,0xaa,
+  0xbe,0x30,0xda,0xc6,0x92,0xfd,0xe3,0x8c,0xc6,0x52,0xfb,0x25,0xe8,0x07,0x04,0xe4,0x7d,0xda,0xe9,0xe0,
+  0xc4,0x99,0xd0,0xf9,0xd8,0xaf,0xdd,0xd0,0x84,0xd5,0x45,0xf6,0xcc,0xc5,0xba,0xf4,0xbd,0x85,0xb1,0xac,
+  0x49,0x49,0x63,0x4a,0x1a,0x19,0x72,0x5c,0x30,0x9d,0x9e,0xef,0x9b,0x70,0x64,0xb2,0x50,0xdb,0xf3,0xa6,
+  0xfd,0xbd,0x20,0xf0,0x1c,0x15,0x74,0xa7,0x64,0x63,0xd9,0x9f,0x4f,0xfc,0x2c,0xf4,0xf9,0x0a,0x97,0x46,
+  0xbc,0x2a,0xca,0xa4,0x9e,0x29,0xc0,0x4c,0x24,0xd4,0x52,0x2e,0xb1,0xe8,0xb1,0x52,0xdb,0x3b,0x3a,0xc6,
+  0xea,0x34,0xdd,0x3c,0x91,0x52,0x61,0x30,0xfb,0x13,0x20,0xa1,0x03,0x49,0xfb,0x69,0xbe,0x21,0x89,0x8a,
+  0x9d,0x93,0xaa,0x12,0xc8,0x15,0x0d,0x7e,0xf0,0xa8,0x0d,0x95,0xe8,0x53,0x49,0x03,0x1b,0xbc,0x19,0xf4,
+  0x17,0x46,0x7b,0x92,0x18,0x65,0xb0,0xdc,0x19,0x8a,0x89,0x0e,0xde,0x04,0x2f,0x07,0x0a,0x68,0xd4,0x6f,
+  0x57,0x2e,0x03,0xf2,0x0c,0x7a,0x25,0xdf,0x80,0xf6,0xdb,0x48,0x64,0x40,0x79,0x09,0x7b,0xc6,0xe3,0xf1,
+  0x48,0xd0,0x2a,0x8d,0xaa,0x66,0x2f,0x0e,0x8b,0x94,0xaf,0x9c,0x16,0x04,0x7b,0xed,0x7c,0x55,0xed,0x7a,
+  0xa5,0x4f,0x20,0x35,0xaa,0xb8,0x92,0x62,0x25,0xd1,0x46,0xbd,0x57,0x46,0xbf,0x4c,0xf6,0xe1,0x1a,0xc2,
+  0x24,0x4b,0x48,0xae,0x21,0x15,0x5d,0x29,0x8f,0xdc,0x5b,0xad,0xba,0x20,0xb6,0xd5,0x7a,0x09,0xc7,0xf2,
+  0xb0,0xb9,0x8d,0xda,0x36,0xdf,0x73,0xb8,0x61,0x77,0x73,0x58,0xe2,0xa6,0xc6,0x35,0x76,0x3c,0x43,0xe5,
+  0xcf,0x72,0x6a,0xb6,0xdd,0x15,0xd6,0xba,0x6e,0xfd,0x71,0x35,0xb0,0x39,0x19,0xa2,0x54,0x6b,0xf1,0xb0,
+  0x55,0x26,0x4d,0xcb,0xbe,0x82,0xf7,0x68,0x71,0x7f,0xc3,0x7c,0xb4,0xb7,0xcc,0x50,0x36,0xec,0xd0,0xf4,
+  0x67,0xec,0x01,0xe5,0x54,0x3c,0x9d,0x46,0x71,0xb4,0x27,0x3a,0xbc,0xe4,0x51,0x62,0xb4,0x33,0x0a,0x42,
+  0x8c,0xc8,0x90,0x81,0xb9,0x76,0x44,0xe5,0xd7,0xb8,0x6e,0x97,0x60,0x81,0xdc,0xc4,0x0e,0x97,0x6e,0x61,
+  0xcd,0x1c,0xd3,0x08,0xc9,0xd7,0x7a,0x2c,0xc9,0x07,0x5c,0xc2,0x51,0xad,0xb8,0x66,0x4e,0x11,0x27,0x6c,
+  0x66,0xe7,0xf1,0x88,0xbe,0xba,0xb3,0xf5,0xc8,0x0c,0x06,0x8d,0x96,0x51,0xe1,0x2e,0xce,0x00,0xb3,0xec,
+  0xf7,0xf7,0x12,0xfe,0x5f,0x2d,0xff,0x35,0x36,0x8d,0xdb,0xd8,0x14,0xf2,0x35,0xf7,0x3f,0x42,0x9e,0x2d,
+  0xbd,0x00,0xf9,0x16,0xff,0x17,0xfe,0xbb,0xe6,0xb8,0x45,0xbb,0xbc,0x14,0xc0,0xcb,0x7f,0x01,0x04,0x75,
+  0x07,0x88,0x3f,0x09,0x00,0x00
+};
+static const WebStaticFile WEB_STATIC_FETCH_AND_PARSE_LOG_MIN_JS = {
+  DATA_FETCH_AND_PARSE_LOG_MIN_JS_GZ_URL, WEB_STATIC_CONTENT_TYPE_JS, DATA_FETCH_AND_PARSE_LOG_MIN_JS_GZ_HASH, DATA_FETCH_AND_PARSE_LOG_MIN_JS_GZ, sizeof(DATA_FETCH_AND_PARSE_LOG_MIN_JS_GZ)
+};
+#endif // ifdef WEBSERVER_LOG
+
+
+// github_clipboard.min.js: 605 bytes, gzip compressed 406 bytes
+#ifdef WEBSERVER_GITHUB_COPY
+static const char DATA_GITHUB_CLIPBOARD_MIN_JS_GZ_URL[] PROGMEM = "/static/github_clipboard.min.js";
+static const char DATA_GITHUB_CLIPBOARD_MIN_JS_GZ_HASH[] PROGMEM = "b232047d";
+static const uint8_t DATA_GITHUB_CLIPBOARD_MIN_JS_GZ[] PROGMEM = {
+  0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x65,0x92,0x61,0x6f,0xdb,0x20,0x10,0x86,0xff,0x0a,
+  0x43,0x5a,0x03,0xb5,0xeb,0x24,0xfb,0x18,0x4a,0x27,0x35,0x8b,0xb6,0x48,0x9b,0x34,0x6d,0xd5,0xbe,0xd8,
+  0x5e,0x85,0xed,0x4b,0x8b,0x84,0x39,0x84,0x71,0x14,0x6b,0xc9,0x7f,0x1f,0x4e,0x9b,0xa4,0xda,0xf8,0x80,
+  0x80,0x7b,0xef,0xe1,0xde,0x83,0x4d,0x6f,0xeb,0xa0,0xd1,0x92,0x0e,0xc2,0x67,0x1d,0x9e,0xfb,0x6a,0x69,
+  0xb4,0xab,0x50,0xf9,0x86,0xf1,0x3f,0x5b,0xe5,0x09,0x48,0xba,0xfa,0xf9,0x9d,0xac,0x54,0x37,0x90,0x3d,
+  0x59,0xdb,0x0d,0xfa,0x56,0x1d,0x53,0xf6,0x85,0x25,0x37,0xe3,0xd8,0xbf,0xcc,0x85,0xa5,0xa2,0x55,0xbb,
+  0x47,0x83,0xe8,0xe4,0x7c,0x36,0x13,0x51,0xca,0x46,0x04,0xca,0xb9,0xc0,0xdb,0x53,0x48,0x60,0x92,0xbc,
+  0xa0,0xad,0xa4,0x35,0xba,0xe1,0x01,0x76,0xe1,0x91,0x26,0x98,0x06,0xd9,0x60,0xdd,0xb7,0x60,0x43,0xf6,
+  0x04,0x61,0x65,0x60,0x5c,0xde,0x0f,0xeb,0x86,0x59,0x2e,0xf4,0x86,0xd9,0xde,0x18,0x29,0x03,0x47,0x79,
+  0x62,0x25,0x73,0x01,0xa6,0x83,0x23,0x4d,0x49,0xba,0xa7,0x02,0xdf,0x7f,0x90,0x72,0x76,0x75,0xc5,0x54,
+  0x22,0x69,0xac,0x88,0xa7,0x90,0xc8,0x90,0x69,0x6b,0xc1,0x7f,0x79,0xf8,0xf6,0x35,0xf3,0xe0,0x8c,0xaa,
+  0x81,0x4d,0x6f,0xf3,0xfb,0xaa,0xcc,0x7f,0xf8,0xb2,0xe8,0xae,0x8b,0xe9,0xc7,0xbb,0xe9,0x93,0x6e,0xd3,
+  0x63,0x4a,0xa2,0x0e,0x07,0x90,0x0c,0x24,0xbc,0x51,0x17,0xd3,0xfc,0x53,0x53,0xe6,0x6b,0x5d,0xe6,0xbf,
+  0xb6,0xff,0xe7,0xf0,0xb7,0xe0,0xdf,0x77,0xe5,0xf5,0x6b,0x8c,0x72,0x31,0x16,0x67,0x2e,0xd6,0x6a,0x0f,
+  0x2a,0xc0,0xab,0x3b,0x46,0x43,0x74,0xaf,0xe2,0x51,0x14,0x9a,0xac,0x0b,0x83,0x89,0x0d,0x77,0xd8,0xe9,
+  0xb1,0xc5,0x0b,0xa2,0xaa,0x0e,0x4d,0x1f,0x40,0x18,0xd8,0x84,0x05,0xb9,0x89,0x6d,0x9d,0xb9,0x9d,0x20,
+  0x01,0xdd,0x79,0x47,0x53,0x73,0xf1,0x27,0x21,0x3d,0xdf,0x54,0x61,0x33,0x64,0xca,0x39,0xb0,0xcd,0xf2,
+  0x59,0x9b,0x86,0x19,0x1e,0xa5,0x1d,0x18,0xa8,0x03,0xe3,0x17,0x1d,0xec,0xa0,0x5e,0x62,0xdb,0x2a,0xdb,
+  0xb0,0xe3,0x8b,0x50,0xfe,0x0f,0xc4,0x43,0x8b,0x5b,0x38,0x43,0x94,0x01,0x1f,0xd8,0x64,0x89,0x4e,0x43,
+  0xb3,0x20,0x74,0x92,0x40,0x32,0xa1,0xb1,0x28,0x52,0x9f,0x7e,0xcf,0xbb,0x09,0x3f,0xfc,0x05,0x0b,0xe0,
+  0x55,0x44,0x5d,0x02,0x00,0x00
+};
+static const WebStaticFile WEB_STATIC_GITHUB_CLIPBOARD_MIN_JS = {
+  DATA_GITHUB_CLIPBOARD_MIN_JS_GZ_URL, WEB_STATIC_CONTENT_TYPE_JS, DATA_GITHUB_CLIPBOARD_MIN_JS_GZ_HASH, DATA_GITHUB_CLIPBOARD_MIN_JS_GZ, sizeof(DATA_GITHUB_CLIPBOARD_MIN_JS_GZ)
+};
+#endif // ifdef WEBSERVER_GITHUB_COPY
+
+
+// update_sensor_values_device_page.min.js: 1149 bytes, gzip compressed 538 bytes
+#ifdef WEBSERVER_DEVICES
+static const char DATA_UPDATE_SENSOR_VALUES_DEVICE_PAGE_MIN_JS_GZ_URL[] PROGMEM = "/static/update_sensor_values_device_page.min.js";
+static const char DATA_UPDATE_SENSOR_VALUES_DEVICE_PAGE_MIN_JS_GZ_HASH[] PROGMEM = "ef3ce85e";
+static const uint8_t DATA_UPDATE_SENSOR_VALUES_DEVICE_PAGE_MIN_JS_GZ[] PROGMEM = {
+  0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xad,0x94,0x5d,0x6f,0xdb,0x20,0x14,0x86,0xff,0x8a,
+  0xc7,0x45,0x05,0x32,0x65,0xf1,0xaa,0xdd,0xc4,0xa5,0x91,0xb6,0xb6,0x5a,0xa5,0x2c,0x9b,0xd4,0x68,0x37,
+  0x55,0x55,0x51,0xfb,0x38,0xf1,0x82,0xc1,0xe2,0xe0,0x64,0x51,0xe4,0xff,0x3e,0x9c,0xe6,0xb3,0x6b,0xd7,
+  0x5d,0xec,0x06,0x01,0xe7,0xe5,0xe1,0x70,0xe0,0xa5,0x68,0x4c,0xe6,0x4b,0x6b,0x22,0x6d,0x6d,0x7d,0x09,
+  0xc3,0xd0,0x52,0xe0,0xc8,0x56,0x73,0xe5,0x22,0xc5,0x35,0xb7,0xb2,0x97,0x96,0x38,0x52,0x23,0x8a,0xec,
+  0xe4,0x84,0xa2,0x4c,0x18,0x37,0x8d,0xd6,0x52,0x42,0x18,0x82,0x4c,0xe0,0x8c,0xa5,0x9d,0xd8,0x48,0x04,
+  0x7f,0x63,0x3c,0xb8,0xb9,0xd2,0xb4,0xd8,0x70,0x29,0x5b,0xd9,0x8b,0xde,0x20,0xd3,0xa0,0xdc,0x2e,0x68,
+  0x58,0x3f,0x8e,0xf1,0x22,0x19,0x58,0x99,0xf4,0x69,0x01,0x3e,0x9b,0x52,0xf2,0xfe,0x27,0x5a,0x33,0x98,
+  0x97,0xb0,0x08,0x20,0x83,0xd6,0x35,0x75,0xae,0x3c,0x10,0x26,0xfc,0x14,0xcc,0x1e,0xb8,0xc9,0xcd,0xa6,
+  0x1f,0x7a,0x3d,0x29,0x25,0x0a,0xf4,0xca,0x37,0x38,0x40,0xd1,0x01,0xe8,0x0b,0xf2,0xc2,0xba,0x90,0x28,
+  0x8a,0xf1,0x78,0xc8,0x55,0x38,0x8e,0x3a,0x47,0x71,0xbb,0xde,0x02,0x85,0x06,0x33,0xf1,0xd3,0x54,0xc5,
+  0x31,0x2b,0x0b,0xba,0x9b,0xbf,0x53,0xf7,0x62,0xaa,0xf0,0xdb,0xc2,0x7c,0x77,0xb6,0x06,0xe7,0x97,0x94,
+  0x8c,0x15,0xce,0x7e,0x28,0xdd,0x00,0x12,0xc6,0x3a,0xa6,0x0e,0x2c,0x7d,0x7e,0xb4,0x66,0xaf,0xd9,0x92,
+  0x75,0x20,0x7b,0xb7,0x5c,0x59,0xf9,0x8a,0xf0,0x4e,0xdf,0x8b,0x75,0xaf,0xcd,0x54,0x57,0x08,0x08,0x15,
+  0x93,0x20,0x8c,0xaa,0xa0,0x2d,0x4a,0xa3,0xb4,0x5e,0xae,0x42,0x6a,0x64,0xbc,0xac,0xe1,0xca,0x39,0xeb,
+  0xc8,0x3b,0x29,0x2d,0x5b,0x79,0xa8,0xea,0xf5,0xba,0x37,0xc1,0x3c,0x87,0xac,0xac,0x94,0xc6,0x37,0xe5,
+  0x23,0x77,0xb9,0x91,0xf2,0x3d,0xbe,0x56,0x0e,0xe1,0x5a,0x5b,0xe5,0xe9,0x6e,0x32,0x54,0xd9,0x5e,0x97,
+  0xbf,0x20,0xa7,0x47,0xec,0xa7,0x97,0xe0,0x24,0x99,0x77,0xa3,0x07,0x12,0xd3,0x3f,0x36,0x1b,0x35,0xd5,
+  0x23,0xb8,0xd3,0x84,0xc5,0xe4,0xc5,0xf8,0xb3,0xdc,0x77,0x72,0xee,0x37,0xd4,0xae,0x30,0xff,0x97,0xdc,
+  0xc8,0xdc,0x66,0x4d,0x05,0xc6,0x8b,0x09,0xf8,0x2b,0x0d,0x5d,0xf7,0xd3,0xf2,0x26,0xa7,0x8e,0xf1,0xec,
+  0xd5,0xa0,0x67,0x69,0x67,0x84,0x70,0x1b,0x4d,0x70,0x42,0x23,0x4a,0x63,0xc0,0x7d,0x19,0x7f,0x1d,0xca,
+  0x7d,0x99,0xf8,0x46,0x91,0x05,0x45,0x76,0xa0,0xf8,0xdb,0x1d,0x84,0xf3,0xc5,0xa4,0x4f,0x58,0xdb,0x6e,
+  0x1f,0xed,0x73,0xf7,0xf0,0x23,0xb3,0xf6,0x58,0xcb,0xfa,0x99,0x0d,0x38,0x0d,0x42,0xdb,0x09,0x25,0x21,
+  0x30,0xc3,0x48,0x97,0x33,0x88,0x82,0x19,0x1c,0x44,0x0b,0x85,0x91,0x8a,0x6a,0x67,0x1f,0x43,0xfe,0x22,
+  0xba,0x5d,0x3b,0x26,0xfa,0x6c,0x73,0xe8,0x47,0x24,0xde,0x5a,0x28,0x70,0xc4,0xd3,0x1b,0x3c,0x74,0xcf,
+  0x21,0x19,0x45,0x05,0x88,0x6a,0x12,0x0e,0x06,0xf2,0x23,0x9c,0xfd,0x43,0x66,0xe1,0x03,0x49,0x58,0xcb,
+  0x81,0xb5,0x07,0xa1,0xf0,0x69,0x84,0x60,0xfa,0x1b,0xc1,0xc6,0x87,0x60,0x7d,0x04,0x00,0x00
+};
+static const WebStaticFile WEB_STATIC_UPDATE_SENSOR_VALUES_DEVICE_PAGE_MIN_JS = {
+  DATA_UPDATE_SENSOR_VALUES_DEVICE_PAGE_MIN_JS_GZ_URL, WEB_STATIC_CONTENT_TYPE_JS, DATA_UPDATE_SENSOR_VALUES_DEVICE_PAGE_MIN_JS_GZ_HASH, DATA_UPDATE_SENSOR_VALUES_DEVICE_PAGE_MIN_JS_GZ, sizeof(DATA_UPDATE_SENSOR_VALUES_DEVICE_PAGE_MIN_JS_GZ)
+};
+#endif // ifdef WEBSERVER_DEVICES
+
+
+// All static files, to register their URL with the web server
+static const WebStaticFile *const webStaticFiles[] = {
+  &WEB_STATIC_ESPEASY_DEFAULT_MIN_CSS,
+#ifdef WEBSERVER_LOG
+  &WEB_STATIC_FETCH_AND_PARSE_LOG_MIN_JS,
+#endif // ifdef WEBSERVER_LOG
+#ifdef WEBSERVER_GITHUB_COPY
+  &WEB_STATIC_GITHUB_CLIPBOARD_MIN_JS,
+#endif // ifdef WEBSERVER_GITHUB_COPY
+#ifdef WEBSERVER_DEVICES
+  &WEB_STATIC_UPDATE_SENSOR_VALUES_DEVICE_PAGE_MIN_JS,
+#endif // ifdef WEBSERVER_DEVICES
+};
+
+#endif // STATIC_WEBSTATICDATA_GZ_H
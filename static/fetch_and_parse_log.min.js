@@ -0,0 +1 @@
+function getBrowser(){var e,o=navigator.userAgent,t=o.match(/(opera|chrome|safari|firefox|msie|trident(?=\/))\/?\s*(\d+)/i)||[];return/trident/i.test(t[1])?{name:"IE",version:(e=/\brv[ :]+(\d+)/g.exec(o)||[])[1]||""}:"Chrome"===t[1]&&null!=(e=o.match(/\bOPR|Edge\/(\d+)/))?{name:"Opera",version:e[1]}:(t=t[2]?[t[1],t[2]]:[navigator.appName,navigator.appVersion,"-?"],null!=(e=o.match(/version\/(\d+)/i))&&t.splice(1,1,e[1]),{name:t[0],version:t[1]})}var browser=getBrowser(),currentBrowser=browser.name+browser.version;(browser.name=browser.version<12)?textToDisplay="Error: "+currentBrowser+" is not supported! Please try a modern web browser.":textToDisplay="Fetching log entries...",document.getElementById("copyText_1").innerHTML=textToDisplay,loopDeLoop(1e3,0);var logLevel=new Array("Unused","Error","Info","Debug","Debug More","Undefined","Undefined","Undefined","Undefined","Debug Dev");function loopDeLoop(e,o){var t,n;isNaN(o)&&(o=1),null==e&&(e=1e3),scrolling_type=e<=500?"auto":"smooth";var r="",l=0,s=setInterval(function(){l>0?clearInterval(s):(++o>1?l=1:fetch("/logjson").then(function(o){200===o.status?o.json().then(function(o){var l;for(null==n&&(n=""),t=0;t<o.Log.nrEntries;++t)try{l=o.Log.Entries[t].timestamp}catch(e){l=e.name}finally{"TypeError"!==l&&(r=o.Log.Entries[t].timestamp,n+="<div class=level_"+o.Log.Entries[t].level+" id="+r+'><font color="gray">'+o.Log.Entries[t].timestamp+":</font> "+o.Log.Entries[t].text+"</div>")}e=o.Log.TTL,""!==n&&("Fetching log entries..."==document.getElementById("copyText_1").innerHTML&&(document.getElementById("copyText_1").innerHTML=""),document.getElementById("copyText_1").innerHTML+=n),n="",autoscroll_on=document.getElementById("autoscroll").checked,1==autoscroll_on&&""!==r&&document.getElementById(r).scrollIntoView({behavior:scrolling_type}),document.getElementById("current_loglevel").innerHTML="Logging: "+logLevel[o.Log.SettingsWebLogLevel]+" ("+o.Log.SettingsWebLogLevel+")",clearInterval(s),loopDeLoop(e,0)}):console.log("Looks like there was a problem. Status Code: "+o.status)}).catch(function(o){document.getElementById("copyText_1").innerHTML+="<div>>> "+o.message+" <<</div>",autoscroll_on=document.getElementById("autoscroll").checked,document.getElementById("copyText_1").scrollTop=document.getElementById("copyText_1").scrollHeight,e=5e3,clearInterval(s),loopDeLoop(e,0)}),l=1)},e)}
\ No newline at end of file
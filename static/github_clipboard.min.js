@@ -0,0 +1 @@
+function setGithubClipboard(){var e="ESP Easy | Information |\n -----|-----|\n";max_loop=100;for(var o=1;o<max_loop;o++){var n="copyText_"+o,t=document.getElementById(n);if(null==t)o=max_loop+1;else{var a="|";o%2==0&&(a+="\n"),e+=t.innerHTML.replace(/<[Bb][Rr]\s*\/?>/gim,"\n")+a}}e=(e=e.replace(/<\/[Dd][Ii][Vv]\s*\/?>/gim,"\n")).replace(/<[^>]*>/gim,"");var l=document.createElement("textarea");l.style="position: absolute;left: -1000px; top: -1000px",l.innerHTML=e,document.body.appendChild(l),l.select(),document.execCommand("copy"),document.body.removeChild(l),alert('Copied: "'+e+'" to clipboard!')}
\ No newline at end of file
@@ -0,0 +1 @@
+function loopDeLoop(e,s){var a,l,o=0;isNaN(s)&&(s=1),null==e&&(e=1e3);var n=setInterval(function(){o>0?clearInterval(n):++s>1?o=1:(fetch("/json?view=sensorupdate").then(function(s){var o;200===s.status?s.json().then(function(s){for(e=s.TTL,a=0;a<s.Sensors.length;a++)if(s.Sensors[a].hasOwnProperty("TaskValues"))for(l=0;l<s.Sensors[a].TaskValues.length;l++)try{o=s.Sensors[a].TaskValues[l].Value}catch(e){o=e.name}finally{if("TypeError"!==o){tempValue=s.Sensors[a].TaskValues[l].Value,decimalsValue=s.Sensors[a].TaskValues[l].NrDecimals,tempValue=parseFloat(tempValue).toFixed(decimalsValue);var r="value_"+(s.Sensors[a].TaskNumber-1)+"_"+(s.Sensors[a].TaskValues[l].ValueNumber-1),t="valuename_"+(s.Sensors[a].TaskNumber-1)+"_"+(s.Sensors[a].TaskValues[l].ValueNumber-1),u=document.getElementById(r),c=document.getElementById(t);null!==u&&(u.innerHTML=tempValue),null!==c&&(c.innerHTML=s.Sensors[a].TaskValues[l].Name+":")}}e=s.TTL,clearInterval(n),loopDeLoop(e,0)}):console.log("Looks like there was a problem. Status Code: "+s.status)}).catch(function(s){console.log(s.message),e=5e3,clearInterval(n),loopDeLoop(e,0)}),o=1)},e)}loopDeLoop(1e3,0);
\ No newline at end of file
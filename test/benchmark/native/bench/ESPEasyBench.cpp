@@ -0,0 +1,389 @@
+/*********************************************************************************************\
+* ESPEasy native benchmark
+*
+* Runs the portable parts of the firmware on the host and reports per benchmark:
+* - operations per second (events/s for the rules benchmarks)
+* - heap allocations per operation
+* - peak heap usage, relative to the heap in use when the benchmark started
+*
+* Usage: espeasy_bench [-q] [-v] [filter]
+*   -q      Run less iterations (quick check)
+*   -v      Log rules processing (LOG_LEVEL_INFO)
+*   filter  Only run benchmarks of which the name contains filter
+*
+* The rules files are read from ESPEASY_BENCH_RULES_DIR (test/benchmark).
+\*********************************************************************************************/
+
+#include "HostClock.h"
+#include "HostHeap.h"
+#include "HostStubs.h"
+
+#include "src/ControllerQueue/DelayQueueRing.h"
+#include "src/ControllerQueue/MQTT_queue_arena.h"
+#include "src/ControllerQueue/SimpleQueueElement_string_only.h"
+#include "src/DataStructs/TimerIdHeap.h"
+#include "src/Globals/Calculate.h"
+#include "src/Globals/Plugins.h"
+#include "src/Globals/RulesCompiled.h"
+
+#include <chrono>
+
+#ifndef ESPEASY_BENCH_RULES_DIR
+# define ESPEASY_BENCH_RULES_DIR "."
+#endif // ifndef ESPEASY_BENCH_RULES_DIR
+
+namespace {
+bool quickRun = false;
+bool failed   = false;
+
+struct BenchResult {
+  unsigned long operations = 0;
+  double        seconds    = 0.0;
+  uint64_t      allocations = 0;
+  int64_t       peakHeap    = 0;
+};
+
+class BenchRun {
+public:
+
+  BenchRun() {
+    hostHeap_resetPeak();
+    _start = hostHeap_getStats();
+    _begin = std::chrono::steady_clock::now();
+  }
+
+  BenchResult finish(unsigned long operations) const {
+    BenchResult res;
+
+    res.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - _begin).count();
+    const HostHeapStats stats = hostHeap_getStats();
+
+    res.operations  = operations;
+    res.allocations = stats.allocations - _start.allocations;
+    res.peakHeap    = stats.peakBytes - _start.liveBytes;
+    return res;
+  }
+
+private:
+
+  HostHeapStats _start;
+  std::chrono::steady_clock::time_point _begin;
+};
+
+void report(const char *name, const char *unit, const BenchResult& res) {
+  const double perSec    = (res.seconds > 0.0) ? res.operations / res.seconds : 0.0;
+  const double allocsPer = (res.operations > 0) ? static_cast<double>(res.allocations) / res.operations : 0.0;
+
+  printf("%-20s %10lu %-6s %12.0f %s/s %9.2f allocs/op %8lld bytes peak heap\n",
+         name, res.operations, unit, perSec, unit, allocsPer,
+         static_cast<long long>(res.peakHeap));
+}
+
+void check(bool condition, const char *name, const char *message) {
+  if (!condition) {
+    printf("%-20s FAILED: %s\n", name, message);
+    failed = true;
+  }
+}
+
+unsigned long getRulesProcessingCount() {
+  unsigned long minVal = 0;
+  unsigned long maxVal = 0;
+
+  return miscStats[RULES_PROCESSING].getMinMax(minVal, maxVal);
+}
+
+void resetRulesState() {
+  hostCommands_reset();
+  eventQueue.clear();
+
+  for (int i = 0; i < CUSTOM_VARS_MAX; ++i) {
+    customFloatVar[i] = 0.0f;
+  }
+}
+
+// Process all queued events and expire the rules timers on the virtual clock,
+// until no event or timer is left.
+void runRules(unsigned long maxVirtualMillis) {
+  const unsigned long start = millis();
+
+  while (true) {
+    while (processNextEvent()) {}
+
+    const unsigned long next = hostCommands_nextTimer();
+
+    if ((next == 0) || (timePassedSince(start) > static_cast<long>(maxVirtualMillis))) {
+      return;
+    }
+    const long wait = timeDiff(millis(), next);
+
+    if (wait > 0) {
+      hostClock_advance(wait);
+    }
+    rulesTimers();
+  }
+}
+
+void setupRules() {
+  ESPEASY_FS.setRoot(ESPEASY_BENCH_RULES_DIR);
+  Settings.UseRules = true;
+  checkRuleSets();
+  hostClock_setVirtual(true);
+}
+
+/*********************************************************************************************\
+* rules1.txt: LED blink test, driven by 3 rules timers and GPIO monitor events.
+* Ends when timer 3 has run 60 times (60 seconds virtual time).
+\*********************************************************************************************/
+void benchRules1() {
+  const char *name      = "rules1_replay";
+  const int   nrReplays = quickRun ? 5 : 100;
+  const unsigned long eventsBefore = getRulesProcessingCount();
+
+  BenchRun run;
+
+  for (int i = 0; i < nrReplays; ++i) {
+    resetRulesState();
+    String event = F("StartTest1");
+    rulesProcessing(event);
+    runRules(600000);
+    check(customFloatVar[2] == -1.0f, name, "test did not end (timer 3 not stopped)");
+  }
+  report(name, "events", run.finish(getRulesProcessingCount() - eventsBefore));
+}
+
+/*********************************************************************************************\
+* rules2.txt: compare operators on event values and conditions on variables.
+\*********************************************************************************************/
+void benchRules2() {
+  const char *name      = "rules2_replay";
+  const int   nrReplays = quickRun ? 100 : 5000;
+  const unsigned long eventsBefore = getRulesProcessingCount();
+
+  BenchRun run;
+
+  for (int i = 0; i < nrReplays; ++i) {
+    resetRulesState();
+    eventQueue.add(F("StartTest2"));
+    eventQueue.add(F("StartTest3"));
+    runRules(0);
+    check(customFloatVar[2] == 101.0f, name, "Let,3,[VAR#2]+2 did not result in 101");
+  }
+  report(name, "events", run.finish(getRulesProcessingCount() - eventsBefore));
+}
+
+/*********************************************************************************************\
+* Synthetic event stream, like generated by tasks with rules events enabled.
+* Most events do not match any trigger, some match a trigger with compare condition.
+\*********************************************************************************************/
+void benchEventStream() {
+  const char *name     = "synthetic_events";
+  const int   nrEvents = quickRun ? 2000 : 100000;
+  const unsigned long eventsBefore = getRulesProcessingCount();
+
+  resetRulesState();
+  const String events[] = {
+    F("bme#Temperature=21.50"),
+    F("bme#Humidity=55.10"),
+    F("bme#Pressure=1013.25"),
+    F("Test=9"),
+    F("Test=11"),
+    F("Clock#Time=Mon,12:00"),
+    F("WiFi#Connected"),
+    F("MQTT#Connected")
+  };
+  const int nrEventTypes = sizeof(events) / sizeof(events[0]);
+
+  BenchRun run;
+
+  for (int i = 0; i < nrEvents; ++i) {
+    eventQueue.add(events[i % nrEventTypes]);
+
+    if ((i % 16) == 15) {
+      while (processNextEvent()) {}
+    }
+  }
+
+  while (processNextEvent()) {}
+  report(name, "events", run.finish(getRulesProcessingCount() - eventsBefore));
+}
+
+/*********************************************************************************************\
+* Calculate(): expressions as used in rules and task formulas.
+\*********************************************************************************************/
+void benchCalculate() {
+  const char *name = "calculate";
+  const int   nrRuns = quickRun ? 2000 : 200000;
+  const char *expressions[] = {
+    "5.00+1",
+    "(21.5*9/5)+32",
+    "1013.25-(12*0.12)",
+    "2^3*1.5",
+    "100/3%7",
+    "-(5+3)/2-1"
+  };
+  const int nrExpressions = sizeof(expressions) / sizeof(expressions[0]);
+  float     sum           = 0.0f;
+
+  BenchRun run;
+
+  for (int i = 0; i < nrRuns; ++i) {
+    float result = 0.0f;
+    Calculate(expressions[i % nrExpressions], &result);
+    sum += result;
+  }
+  report(name, "calls", run.finish(nrRuns));
+  check(sum != 0.0f, name, "all results are 0");
+}
+
+/*********************************************************************************************\
+* Scheduler timers: replay of periodic task, controller and rules timers in the TimerIdHeap.
+* Some timers are cancelled and started again later, like "TimerSet,N,0" of a rules timer.
+\*********************************************************************************************/
+void benchTimerIdHeap() {
+  const char *name     = "timer_heap_replay";
+  const int   nrTimers = 48;
+  const unsigned long nrExpired = quickRun ? 20000 : 2000000;
+
+  TimerIdHeap   heap(nrTimers);
+  unsigned long now = 0;
+
+  for (int i = 0; i < nrTimers; ++i) {
+    heap.set(i + 1, now + 10 + i * 7);
+  }
+  unsigned long expired   = 0;
+  unsigned long cancelled = 0; // Id of the cancelled timer, 0 when none
+
+  BenchRun run;
+
+  while (expired < nrExpired) {
+    const TimerIdHeap::Entry entry = heap.top();
+    now = entry.timer;
+    heap.pop();
+    ++expired;
+
+    // Interval depends on the id, some timers are rescheduled before they expire.
+    const unsigned long id = entry.id;
+    heap.set(id, now + 20 + (id % 13) * 50);
+
+    if ((expired % 7) == 0) {
+      heap.set(((id * 31) % nrTimers) + 1, now + 5);
+    }
+
+    if ((expired % 11) == 0) {
+      if (cancelled != 0) {
+        heap.set(cancelled, now + 30);
+        cancelled = 0;
+      } else {
+        const unsigned long cancelId = ((id * 17) % nrTimers) + 1;
+
+        if ((cancelId != id) && heap.remove(cancelId)) {
+          cancelled = cancelId;
+        }
+      }
+    }
+  }
+  report(name, "timers", run.finish(expired));
+
+  if (cancelled != 0) {
+    heap.set(cancelled, now);
+  }
+  check(!heap.remove(nrTimers + 1), name, "removed a timer which was never set");
+  check(heap.size() == static_cast<size_t>(nrTimers), name, "timers lost");
+}
+
+/*********************************************************************************************\
+* Controller delay queues: push and pop of messages, the queue is kept half full.
+\*********************************************************************************************/
+void benchMQTTQueue() {
+  const char *name       = "mqtt_queue";
+  const int   nrMessages = quickRun ? 10000 : 1000000;
+  const int   depth      = 16;
+
+  MQTT_queue_arena queue;
+  queue.setCapacity(depth);
+  const char *topic   = "domoticz/in/bme/Temperature";
+  const char *payload = "21.50";
+
+  BenchRun run;
+
+  for (int i = 0; i < nrMessages; ++i) {
+    if (!queue.push_back(MQTT_queue_element(0, topic, payload, false))) {
+      check(false, name, "queue full");
+      return;
+    }
+
+    if (queue.size() > (depth / 2)) {
+      queue.pop_front();
+    }
+  }
+  report(name, "msgs", run.finish(nrMessages));
+}
+
+void benchStringQueue() {
+  const char *name       = "string_queue";
+  const int   nrMessages = quickRun ? 10000 : 1000000;
+  const int   depth      = 16;
+
+  DelayQueueRing<simple_queue_element_string_only> queue;
+  queue.setCapacity(depth);
+  const String request = F("/json.htm?type=command&param=udevice&idx=12&nvalue=0&svalue=21.50");
+
+  BenchRun run;
+
+  for (int i = 0; i < nrMessages; ++i) {
+    if (!queue.push_back(simple_queue_element_string_only(0, request))) {
+      check(false, name, "queue full");
+      return;
+    }
+
+    if (queue.size() > (depth / 2)) {
+      queue.pop_front();
+    }
+  }
+  report(name, "msgs", run.finish(nrMessages));
+}
+
+struct Benchmark {
+  const char *name;
+  void (*run)();
+};
+
+const Benchmark benchmarks[] = {
+  { "rules1_replay",     benchRules1       },
+  { "rules2_replay",     benchRules2       },
+  { "synthetic_events",  benchEventStream  },
+  { "calculate",         benchCalculate    },
+  { "timer_heap_replay", benchTimerIdHeap  },
+  { "mqtt_queue",        benchMQTTQueue    },
+  { "string_queue",      benchStringQueue  }
+};
+} // namespace
+
+int main(int argc, char *argv[]) {
+  const char *filter = nullptr;
+
+  for (int i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "-q") == 0) {
+      quickRun = true;
+    } else if (strcmp(argv[i], "-v") == 0) {
+      hostLogLevel = LOG_LEVEL_INFO;
+    } else {
+      filter = argv[i];
+    }
+  }
+
+  if (!hostHeap_tracking()) {
+    printf("Allocation tracking not supported on this platform, allocs/op and peak heap will be 0\n");
+  }
+  // Heap in use at this point is not counted by ESP.getFreeHeap()
+  hostHeap_setBaseline();
+  setupRules();
+
+  for (size_t i = 0; i < sizeof(benchmarks) / sizeof(benchmarks[0]); ++i) {
+    if ((filter == nullptr) || (strstr(benchmarks[i].name, filter) != nullptr)) {
+      benchmarks[i].run();
+    }
+  }
+  return failed ? 1 : 0;
+}
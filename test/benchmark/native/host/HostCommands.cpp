@@ -0,0 +1,163 @@
+#include "HostStubs.h"
+
+#include "src/Commands/InternalCommands.h"
+#include "src/Globals/Plugins.h"
+#include "src/Helpers/ESPEasy_time_calc.h"
+
+HostCommandStats hostCommandStats;
+
+namespace {
+const int HOST_GPIO_MAX = 17;
+
+bool gpioState[HOST_GPIO_MAX];
+bool gpioMonitor[HOST_GPIO_MAX];
+
+// Same as parseStringToEndKeepCase(Line, 2)
+String getArgumentsToEnd(const char *Line) {
+  const char *pos = Line;
+
+  while (*pos != '\0' && *pos != ',' && *pos != ' ') {
+    ++pos;
+  }
+
+  if (*pos != '\0') {
+    ++pos;
+  }
+  String res(pos);
+
+  res.trim();
+  return res;
+}
+
+int getIntArgument(const char *Line, unsigned int argc) {
+  String TmpStr1;
+
+  if (!GetArgv(Line, TmpStr1, argc)) {
+    return 0;
+  }
+  float result = 0.0f;
+
+  if (TmpStr1[0] == '=') {
+    Calculate(TmpStr1.c_str() + 1, &result);
+  } else {
+    result = TmpStr1.toFloat();
+  }
+  return static_cast<int>(result);
+}
+
+void setGpio(int pin, bool state) {
+  if ((pin < 0) || (pin >= HOST_GPIO_MAX)) {
+    return;
+  }
+
+  if (gpioMonitor[pin] && (gpioState[pin] != state)) {
+    String event = F("GPIO#");
+    event += pin;
+    event += '=';
+    event += state ? 1 : 0;
+    eventQueue.add(event);
+    ++hostCommandStats.events;
+  }
+  gpioState[pin] = state;
+}
+
+void sendEvent(EventValueSource::Enum source, const char *Line, bool async) {
+  String eventName = getArgumentsToEnd(Line);
+
+  eventName.replace('$', '#');
+  ++hostCommandStats.events;
+
+  if (!async && (source == EventValueSource::Enum::VALUE_SOURCE_RULES)) {
+    rulesProcessing(eventName);
+  } else {
+    eventQueue.add(eventName);
+  }
+}
+} // namespace
+
+void hostCommands_reset() {
+  hostCommandStats = HostCommandStats();
+
+  for (int i = 0; i < HOST_GPIO_MAX; ++i) {
+    gpioState[i]   = false;
+    gpioMonitor[i] = false;
+  }
+
+  for (int i = 0; i < RULES_TIMER_MAX; ++i) {
+    RulesTimer[i] = rulesTimerStatus();
+  }
+}
+
+unsigned long hostCommands_nextTimer() {
+  unsigned long next = 0;
+
+  for (int i = 0; i < RULES_TIMER_MAX; ++i) {
+    const unsigned long timestamp = RulesTimer[i].timestamp;
+
+    if (!RulesTimer[i].paused && (timestamp != 0)) {
+      if ((next == 0) || (timeDiff(timestamp, next) < 0)) {
+        next = timestamp;
+      }
+    }
+  }
+  return next;
+}
+
+bool ExecuteCommand_all(EventValueSource::Enum source, const char *Line) {
+  String cmd;
+
+  if (!GetArgv(Line, cmd, 1)) {
+    return false;
+  }
+  cmd.toLowerCase();
+  ++hostCommandStats.commands;
+
+  if (cmd.equals(F("let"))) {
+    const int varNr = getIntArgument(Line, 2);
+    String    TmpStr1;
+
+    if ((varNr > 0) && (varNr <= CUSTOM_VARS_MAX) && GetArgv(Line, TmpStr1, 3)) {
+      float result = 0.0f;
+      Calculate(TmpStr1.c_str(), &result);
+      customFloatVar[varNr - 1] = result;
+    }
+  } else if (cmd.equals(F("event"))) {
+    sendEvent(source, Line, false);
+  } else if (cmd.equals(F("asyncevent"))) {
+    sendEvent(source, Line, true);
+  } else if (cmd.equals(F("timerset"))) {
+    const int timerNr = getIntArgument(Line, 2);
+    const int seconds = getIntArgument(Line, 3);
+
+    if ((timerNr < 1) || (timerNr > RULES_TIMER_MAX)) {
+      return false;
+    }
+    rulesTimerStatus& timer = RulesTimer[timerNr - 1];
+    timer.paused = false;
+
+    if (seconds > 0) {
+      timer.interval  = seconds * 1000;
+      timer.timestamp = millis() + timer.interval;
+    } else {
+      timer.interval  = 0;
+      timer.timestamp = 0;
+    }
+  } else if (cmd.equals(F("monitor"))) {
+    const int pin = getIntArgument(Line, 3);
+
+    if ((pin >= 0) && (pin < HOST_GPIO_MAX)) {
+      gpioMonitor[pin] = true;
+    }
+  } else if (cmd.equals(F("gpio"))) {
+    setGpio(getIntArgument(Line, 2), getIntArgument(Line, 3) != 0);
+  } else if (cmd.equals(F("gpiotoggle"))) {
+    const int pin = getIntArgument(Line, 2);
+
+    if ((pin >= 0) && (pin < HOST_GPIO_MAX)) {
+      setGpio(pin, !gpioState[pin]);
+    }
+  } else {
+    ++hostCommandStats.ignored;
+  }
+  return true;
+}
@@ -0,0 +1,136 @@
+#ifndef NATIVE_HOST_HOSTESPEASY_H
+#define NATIVE_HOST_HOSTESPEASY_H
+
+/*********************************************************************************************\
+* Declarations needed to build ESPEasyRules.ino on the host.
+*
+* On the ESP the .ino files are concatenated and the Arduino builder generates the prototypes.
+* ESPEasy-Globals.h pulls in the complete network and hardware stack, so only the parts
+* used by the rules engine are declared here.
+* The functions implemented in other .ino files are replaced by HostStubs.cpp.
+\*********************************************************************************************/
+
+#include "ESPEasy_common.h"
+#include "ESPEasy_Log.h"
+#include "ESPEasy_fdwdecl.h"
+
+#include "src/DataStructs/ESPEasyLimits.h"
+#include "src/DataStructs/EventQueue.h"
+#include "src/DataStructs/ExtraTaskSettingsStruct.h"
+#include "src/DataStructs/RulesCompiled.h"
+#include "src/DataStructs/TimingStats.h"
+#include "src/Globals/Settings.h"
+
+#include <vector>
+
+// Same as in ESPEasy-Globals.h
+struct rulesTimerStatus
+{
+  rulesTimerStatus() : timestamp(0), interval(0), paused(false) {}
+
+  unsigned long timestamp;
+  unsigned int interval; // interval in milliseconds
+  bool paused;
+};
+
+extern rulesTimerStatus RulesTimer[RULES_TIMER_MAX];
+extern EventQueueStruct eventQueue;
+extern boolean activeRuleSets[RULESETS_MAX];
+extern ExtraTaskSettingsStruct ExtraTaskSettings;
+
+#define SPIFFS_CHECK(result, fname) if (!(result)) { return(FileError(__LINE__, fname)); }
+
+/*********************************************************************************************\
+* Other .ino files (replaced by HostStubs.cpp)
+\*********************************************************************************************/
+String FileError(int         line,
+                 const char *fname);
+bool   fileExists(const String& fname);
+String LoadTaskSettings(taskIndex_t TaskIndex);
+String getTaskDeviceName(taskIndex_t TaskIndex);
+bool   validIntFromString(const String& tBuf,
+                          int         & result);
+bool   timeStringToSeconds(const String& tBuf,
+                           int         & time_seconds);
+
+/*********************************************************************************************\
+* ESPEasyRules.ino
+\*********************************************************************************************/
+String EventToFileName(const String& eventName);
+String FileNameToEvent(const String& fileName);
+String getRuleSetFileName(byte rulesSet);
+void   checkRuleSets();
+bool   processNextEvent();
+void   processEventQueue();
+void   rulesProcessing(String& event);
+String rulesProcessingFile(const String& fileName,
+                           String      & event);
+void   compileRulesLine(RulesCompiledFile& rules,
+                        const String     & line);
+void   compileRulesTrigger(RulesCompiledFile& rules);
+bool   compileRuleSet(byte rulesSet);
+bool   compiledRuleMatch(const RulesNode      & node,
+                         const String         & event,
+                         const RulesEventParts& eventParts);
+bool   compiledRuleCondition(const RulesNode          & node,
+                             const String             & event,
+                             byte                       ifBlock,
+                             const __FlashStringHelper *label);
+void   rulesProcessingCompiled(RulesCompiledFile          & rules,
+                               const String               & event,
+                               const RulesEventParts      & eventParts,
+                               const std::vector<uint16_t>& candidates);
+void   rulesProcessingCompiledBlock(RulesCompiledFile    & rules,
+                                    size_t                 onNodeIndex,
+                                    const String         & event,
+                                    const RulesEventParts& eventParts);
+bool   rules_strip_trailing_comments(String& line);
+bool   rules_replace_common_mistakes(const String& from,
+                                     const String& to,
+                                     String      & line);
+bool   check_rules_line_user_errors(String& line);
+bool   get_next_inner_bracket(const String& line,
+                              int         & startIndex,
+                              int         & closingIndex,
+                              char          closingBracket);
+bool   get_next_argument(const String& fullCommand,
+                         int         & index,
+                         String      & argument,
+                         char          separator);
+void   parse_string_commands(String& line);
+void   replace_EventValueN_Argv(String      & line,
+                                const String& argString,
+                                unsigned int  argc);
+void   substitute_eventvalue(String      & line,
+                             const String& event);
+void   parseCompleteNonCommentLine(String& line,
+                                   String& event,
+                                   String& action,
+                                   bool  & match,
+                                   bool  & codeBlock,
+                                   bool  & isCommand,
+                                   byte  & ifBlock,
+                                   byte  & fakeIfBlock);
+void   processMatchedRule(String& action,
+                          String& event,
+                          String& log,
+                          bool  & isCommand,
+                          bool    condition[],
+                          bool    ifBranche[],
+                          byte  & ifBlock,
+                          byte  & fakeIfBlock);
+bool   ruleMatch(const String& event,
+                 const String& rule);
+bool   conditionMatchExtended(String& check);
+bool   findCompareCondition(const String& check,
+                            char        & compare,
+                            int         & posStart,
+                            int         & posEnd);
+bool   compareValues(char  compare,
+                     float Value1,
+                     float Value2);
+bool   conditionMatch(const String& check);
+void   rulesTimers();
+void   createRuleEvents(struct EventStruct *event);
+
+#endif // NATIVE_HOST_HOSTESPEASY_H
@@ -0,0 +1,4 @@
+// Rules engine of the firmware, built as a regular translation unit.
+#include "HostESPEasy.h"
+
+#include "ESPEasyRules.ino"
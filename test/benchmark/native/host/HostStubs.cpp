@@ -0,0 +1,267 @@
+/*********************************************************************************************\
+* Host replacements of the firmware functions used by the rules engine, which are
+* implemented in .ino files that cannot be built on the host (Misc.ino, ESPEasyStorage.ino,
+* ESPEasy_Log.ino, ...).
+* They are kept as simple as possible, the benchmark measures the rules engine itself.
+\*********************************************************************************************/
+
+#include "HostESPEasy.h"
+#include "HostStubs.h"
+
+#include "src/Globals/CPlugins.h"
+#include "src/Globals/Calculate.h"
+#include "src/Globals/Plugins.h"
+#include "src/Helpers/ESPEasy_time.h"
+
+rulesTimerStatus RulesTimer[RULES_TIMER_MAX];
+EventQueueStruct eventQueue;
+boolean activeRuleSets[RULESETS_MAX];
+
+byte hostLogLevel = LOG_LEVEL_NONE;
+
+/*********************************************************************************************\
+* Globals/CPlugins.cpp (needs the controller plugins)
+\*********************************************************************************************/
+controllerIndex_t INVALID_CONTROLLER_INDEX = CONTROLLER_MAX;
+
+/*********************************************************************************************\
+* ESPEasy_time.cpp (needs the network stack)
+\*********************************************************************************************/
+ESPEasy_time::ESPEasy_time() {
+  memset(&tm, 0, sizeof(tm));
+  memset(&tsRise, 0, sizeof(tm));
+  memset(&tsSet, 0, sizeof(tm));
+  memset(&sunRise, 0, sizeof(tm));
+  memset(&sunSet, 0, sizeof(tm));
+}
+
+/*********************************************************************************************\
+* ESPEasy_Log.ino
+\*********************************************************************************************/
+bool loglevelActiveFor(byte logLevel) {
+  return logLevel <= hostLogLevel;
+}
+
+void addToLog(byte, const String& string) {
+  Serial.println(string);
+}
+
+void addToLog(byte logLevel, const __FlashStringHelper *flashString) {
+  addToLog(logLevel, String(flashString));
+}
+
+/*********************************************************************************************\
+* ESPEasyStorage.ino
+\*********************************************************************************************/
+String FileError(int line, const char *fname) {
+  String err = F("FS   : Error while reading/writing ");
+
+  err += fname;
+  err += F(" in ");
+  err += line;
+  addLog(LOG_LEVEL_ERROR, err);
+  return err;
+}
+
+bool fileExists(const String& fname) {
+  return ESPEASY_FS.exists(fname);
+}
+
+fs::File tryOpenFile(const String& fname, const String& mode) {
+  START_TIMER;
+  fs::File f = ESPEASY_FS.open(fname, mode.c_str());
+
+  STOP_TIMER(TRY_OPEN_FILE);
+  return f;
+}
+
+String LoadTaskSettings(taskIndex_t TaskIndex) {
+  ExtraTaskSettings.clear();
+  ExtraTaskSettings.TaskIndex = TaskIndex;
+  return String();
+}
+
+/*********************************************************************************************\
+* Misc.ino
+\*********************************************************************************************/
+String getTaskDeviceName(taskIndex_t) {
+  return String();
+}
+
+unsigned long FreeMem() {
+  return ESP.getFreeHeap();
+}
+
+void backgroundtasks() {}
+
+int Calculate(const char *input, float *result) {
+  return calculateCache.calculate(input, *result);
+}
+
+bool GetArgv(const char *string, String& argvString, unsigned int argc) {
+  // Arguments are separated by ',' or ' ', text between quotes or [] is kept together.
+  argvString = String();
+  unsigned int argc_pos = 1;
+  bool   inQuotes       = false;
+  char   closingChar    = 0;
+  String arg;
+
+  for (const char *c = string; ; ++c) {
+    if (!inQuotes && ((*c == '\0') || (*c == ',') || (*c == ' '))) {
+      arg.trim();
+
+      if (arg.length() > 0) {
+        if (argc_pos == argc) {
+          if ((arg.length() >= 2) && ((arg[0] == '"') || (arg[0] == '\'')) && (arg[arg.length() - 1] == arg[0])) {
+            arg = arg.substring(1, arg.length() - 1);
+          }
+          argvString = arg;
+          return argvString.length() > 0;
+        }
+        ++argc_pos;
+      } else if (*c == ',') {
+        // Empty argument between two commas
+        if (argc_pos == argc) { return false; }
+        ++argc_pos;
+      }
+      arg = String();
+
+      if (*c == '\0') { return false; }
+      continue;
+    }
+
+    if (*c == '\0') { return false; }
+
+    if (!inQuotes && ((*c == '"') || (*c == '\'') || (*c == '['))) {
+      inQuotes    = true;
+      closingChar = (*c == '[') ? ']' : *c;
+    } else if (inQuotes && (*c == closingChar)) {
+      inQuotes = false;
+    }
+    arg += *c;
+  }
+}
+
+namespace {
+bool validNumericalFromString(const String& tBuf, bool mustBeInteger, double& result) {
+  String numerical = tBuf;
+
+  numerical.trim();
+
+  if (numerical.length() == 0) { return false; }
+  const char *begin = numerical.c_str();
+  char *end         = nullptr;
+
+  if (mustBeInteger) {
+    result = strtol(begin, &end, 10);
+  } else {
+    result = strtod(begin, &end);
+  }
+  return end != begin;
+}
+} // namespace
+
+bool validIntFromString(const String& tBuf, int& result) {
+  double value = 0;
+
+  if (!validNumericalFromString(tBuf, true, value)) { return false; }
+  result = static_cast<int>(value);
+  return true;
+}
+
+bool validFloatFromString(const String& tBuf, float& result) {
+  double value = 0;
+
+  if (!validNumericalFromString(tBuf, false, value)) { return false; }
+  result = static_cast<float>(value);
+  return true;
+}
+
+bool timeStringToSeconds(const String&, int&) {
+  // Time of day conditions are not replayed.
+  return false;
+}
+
+String getUnknownString() {
+  return F("Unknown");
+}
+
+String get_formatted_Controller_number(cpluginID_t cpluginID) {
+  String result = F("C");
+
+  if (cpluginID < 100) { result += '0'; }
+
+  if (cpluginID < 10) { result += '0'; }
+  result += cpluginID;
+  return result;
+}
+
+/*********************************************************************************************\
+* Only the template markup used by the benchmark rules is supported:
+* %vN%, %sysheap%, %sysstack%, [VAR#N] and [INT#N] (optional format and URL encoding are ignored)
+\*********************************************************************************************/
+String parseTemplate(String& tmpString) {
+  return parseTemplate(tmpString, false);
+}
+
+String parseTemplate(String& tmpString, bool) {
+  START_TIMER
+  String newString;
+
+  newString.reserve(tmpString.length());
+  const int length = tmpString.length();
+
+  for (int pos = 0; pos < length;) {
+    const char c = tmpString[pos];
+
+    if ((c == '%') || (c == '[')) {
+      const int end = tmpString.indexOf((c == '%') ? '%' : ']', pos + 1);
+
+      if (end > pos) {
+        String marker = tmpString.substring(pos + 1, end);
+        marker.toLowerCase();
+
+        bool replaced = true;
+
+        if (marker.equals(F("sysheap"))) {
+          newString += ESP.getFreeHeap();
+        } else if (marker.equals(F("sysstack"))) {
+          newString += HOST_FREE_STACK;
+        } else if ((c == '%') && (marker.length() > 1) && (marker[0] == 'v') && isDigit(marker[1])) {
+          const int varNr = marker.substring(1).toInt();
+
+          if ((varNr > 0) && (varNr <= CUSTOM_VARS_MAX)) {
+            newString += String(customFloatVar[varNr - 1], 2);
+          } else {
+            replaced = false;
+          }
+        } else if ((c == '[') && (marker.startsWith(F("var#")) || marker.startsWith(F("int#")))) {
+          const int varNr = marker.substring(4).toInt();
+
+          if ((varNr > 0) && (varNr <= CUSTOM_VARS_MAX)) {
+            const float value = customFloatVar[varNr - 1];
+
+            if (marker[0] == 'i') {
+              newString += static_cast<int>(roundf(value));
+            } else {
+              newString += String(value, 2);
+            }
+          } else {
+            replaced = false;
+          }
+        } else {
+          replaced = false;
+        }
+
+        if (replaced) {
+          pos = end + 1;
+          continue;
+        }
+      }
+    }
+    newString += c;
+    ++pos;
+  }
+  STOP_TIMER(PARSE_TEMPLATE_PADDED);
+  return newString;
+}
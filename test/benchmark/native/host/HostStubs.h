@@ -0,0 +1,34 @@
+#ifndef NATIVE_HOST_HOSTSTUBS_H
+#define NATIVE_HOST_HOSTSTUBS_H
+
+#include "HostESPEasy.h"
+
+// Reported as %sysstack%, the host has no meaningful equivalent.
+#define HOST_FREE_STACK  4096
+
+// Log level of the host build, messages are written to stdout.
+extern byte hostLogLevel;
+
+
+/*********************************************************************************************\
+* Command layer of the host build (HostCommands.cpp)
+*
+* Only the commands used by the benchmark rules are executed:
+* Let, Event, AsyncEvent, TimerSet, Monitor, GPIO, GPIOtoggle.
+* Other commands (e.g. LogEntry, PWM) are only counted.
+\*********************************************************************************************/
+struct HostCommandStats {
+  unsigned long commands = 0;
+  unsigned long ignored  = 0;
+  unsigned long events   = 0; // Events sent by the Event/AsyncEvent commands and GPIO monitoring
+};
+
+extern HostCommandStats hostCommandStats;
+
+// Reset command statistics, GPIO states, monitored pins and rules timers.
+void hostCommands_reset();
+
+// Return the first rules timer to expire, or 0 when no timer is active.
+unsigned long hostCommands_nextTimer();
+
+#endif // NATIVE_HOST_HOSTSTUBS_H
@@ -0,0 +1,107 @@
+#ifndef NATIVE_SHIMS_ARDUINO_H
+#define NATIVE_SHIMS_ARDUINO_H
+
+/*********************************************************************************************\
+* Minimal Arduino core for the native host benchmark build.
+*
+* Only what is needed to build the portable ESPEasy modules (src/src/...) on a Linux host.
+* Timing is based on the host steady clock, heap statistics on the allocation tracker
+* (see HostHeap.h).
+\*********************************************************************************************/
+
+#include <ctype.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+
+typedef uint8_t byte;
+typedef bool    boolean;
+
+#define PROGMEM
+#define ICACHE_RAM_ATTR
+#define ICACHE_FLASH_ATTR
+
+class __FlashStringHelper;
+#define FPSTR(pstr_pointer) (reinterpret_cast<const __FlashStringHelper *>(pstr_pointer))
+#define PSTR(s) (s)
+#define F(string_literal) (FPSTR(PSTR(string_literal)))
+
+#define pgm_read_byte(addr)  (*reinterpret_cast<const uint8_t *>(addr))
+#define pgm_read_word(addr)  (*reinterpret_cast<const uint16_t *>(addr))
+#define pgm_read_dword(addr) (*reinterpret_cast<const uint32_t *>(addr))
+#define strlen_P  strlen
+#define strcpy_P  strcpy
+#define strncpy_P strncpy
+#define strcmp_P  strcmp
+#define memcpy_P  memcpy
+
+#ifndef PI
+# define PI 3.1415926535897932384626433832795
+#endif // ifndef PI
+
+#define HEX 16
+#define DEC 10
+
+#define bitRead(value, bit)            (((value) >> (bit)) & 0x01)
+#define bitSet(value, bit)             ((value) |= (1UL << (bit)))
+#define bitClear(value, bit)           ((value) &= ~(1UL << (bit)))
+#define bitWrite(value, bit, bitvalue) ((bitvalue) ? bitSet(value, bit) : bitClear(value, bit))
+
+#include "WString.h"
+
+unsigned long millis();
+unsigned long micros();
+void          delay(unsigned long ms);
+void          yield();
+
+inline bool isDigit(int c)        { return isdigit(c) != 0; }
+inline bool isSpace(int c)        { return isspace(c) != 0; }
+inline bool isAlpha(int c)        { return isalpha(c) != 0; }
+inline bool isAlphaNumeric(int c) { return isalnum(c) != 0; }
+inline bool isPunct(int c)        { return ispunct(c) != 0; }
+inline bool isUpperCase(int c)    { return isupper(c) != 0; }
+inline bool isLowerCase(int c)    { return islower(c) != 0; }
+
+// Simulated chip, heap usage is taken from the allocation tracker.
+class EspClass {
+public:
+
+  uint32_t getFreeHeap();
+  uint32_t getMaxFreeBlockSize();
+  uint32_t getCycleCount();
+  uint32_t getChipId() { return 0x00BEEF; }
+};
+
+extern EspClass ESP;
+
+class Stream {
+public:
+
+  virtual ~Stream() {}
+
+  virtual int available() = 0;
+  virtual int read()      = 0;
+};
+
+class HardwareSerial : public Stream {
+public:
+
+  void   begin(unsigned long) {}
+
+  size_t print(const String& str)   { return write(str.c_str(), str.length()); }
+  size_t println(const String& str) { return print(str) + write("\n", 1); }
+  size_t write(const char *buf,
+               size_t      size);
+
+  int    available() override { return 0; }
+  int    read() override      { return -1; }
+};
+
+extern HardwareSerial Serial;
+
+#endif // NATIVE_SHIMS_ARDUINO_H
@@ -0,0 +1,7 @@
+#ifndef NATIVE_SHIMS_ESP8266WEBSERVER_H
+#define NATIVE_SHIMS_ESP8266WEBSERVER_H
+
+// Network classes are declared in HostNetwork.h
+#include "HostNetwork.h"
+
+#endif // NATIVE_SHIMS_ESP8266WEBSERVER_H
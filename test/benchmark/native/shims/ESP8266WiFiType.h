@@ -0,0 +1,7 @@
+#ifndef NATIVE_SHIMS_ESP8266WIFITYPE_H
+#define NATIVE_SHIMS_ESP8266WIFITYPE_H
+
+// Network classes are declared in HostNetwork.h
+#include "HostNetwork.h"
+
+#endif // NATIVE_SHIMS_ESP8266WIFITYPE_H
@@ -0,0 +1,138 @@
+#include "FS.h"
+
+#include <sys/stat.h>
+
+#include <utility>
+
+fs::FS SPIFFS;
+
+namespace fs {
+File::File(FILE *file, const char *name) : _file(file), _name(name) {}
+
+File::File(File&& other) : _file(other._file), _name(std::move(other._name))
+{
+  other._file = nullptr;
+}
+
+File::~File()
+{
+  close();
+}
+
+File& File::operator=(File&& other)
+{
+  if (this != &other) {
+    close();
+    _file       = other._file;
+    _name       = std::move(other._name);
+    other._file = nullptr;
+  }
+  return *this;
+}
+
+size_t File::write(uint8_t c)
+{
+  return write(&c, 1);
+}
+
+size_t File::write(const uint8_t *buf, size_t size)
+{
+  if (_file == nullptr) { return 0; }
+  return fwrite(buf, 1, size, _file);
+}
+
+int File::read()
+{
+  uint8_t c;
+
+  if (read(&c, 1) != 1) { return -1; }
+  return c;
+}
+
+size_t File::read(uint8_t *buf, size_t size)
+{
+  if (_file == nullptr) { return 0; }
+  return fread(buf, 1, size, _file);
+}
+
+int File::available()
+{
+  if (_file == nullptr) { return 0; }
+  return size() - position();
+}
+
+bool File::seek(uint32_t pos, SeekMode mode)
+{
+  if (_file == nullptr) { return false; }
+  const int whence = (mode == SeekSet) ? SEEK_SET : ((mode == SeekCur) ? SEEK_CUR : SEEK_END);
+
+  return fseek(_file, pos, whence) == 0;
+}
+
+size_t File::position() const
+{
+  if (_file == nullptr) { return 0; }
+  return ftell(_file);
+}
+
+size_t File::size() const
+{
+  if (_file == nullptr) { return 0; }
+  struct stat st;
+
+  if (fstat(fileno(_file), &st) != 0) { return 0; }
+  return st.st_size;
+}
+
+void File::flush()
+{
+  if (_file != nullptr) { fflush(_file); }
+}
+
+void File::close()
+{
+  if (_file != nullptr) {
+    fclose(_file);
+    _file = nullptr;
+  }
+}
+
+File FS::open(const String& path, const char *mode)
+{
+  // Arduino "r+" / "w+" also create the file when not present.
+  String hostMode = mode;
+
+  if (hostMode.equals("r+") && !exists(path)) {
+    hostMode = "w+";
+  }
+  FILE *file = fopen(hostPath(path).c_str(), (hostMode + "b").c_str());
+
+  if (file == nullptr) {
+    return File();
+  }
+  return File(file, path.c_str());
+}
+
+bool FS::exists(const String& path)
+{
+  struct stat st;
+
+  return stat(hostPath(path).c_str(), &st) == 0;
+}
+
+bool FS::remove(const String& path)
+{
+  return ::remove(hostPath(path).c_str()) == 0;
+}
+
+String FS::hostPath(const String& path) const
+{
+  String res = _root;
+
+  if (!path.startsWith("/")) {
+    res += '/';
+  }
+  res += path;
+  return res;
+}
+} // namespace fs
@@ -0,0 +1,83 @@
+#ifndef NATIVE_SHIMS_FS_H
+#define NATIVE_SHIMS_FS_H
+
+#include "Arduino.h"
+
+#include <stdio.h>
+
+/*********************************************************************************************\
+* File system of the native host build.
+* Files are stored in a directory on the host, set with fs::FS::setRoot().
+\*********************************************************************************************/
+namespace fs {
+enum SeekMode {
+  SeekSet = 0,
+  SeekCur = 1,
+  SeekEnd = 2
+};
+
+class File {
+public:
+
+  File() {}
+
+  File(FILE       *file,
+       const char *name);
+  File(const File& other) = delete;
+  File(File&& other);
+  ~File();
+
+  File& operator=(File&& other);
+
+  size_t write(uint8_t c);
+  size_t write(const uint8_t *buf,
+               size_t         size);
+  int    read();
+  size_t read(uint8_t *buf,
+              size_t   size);
+  int    available();
+  bool   seek(uint32_t pos,
+              SeekMode mode = SeekSet);
+  size_t position() const;
+  size_t size() const;
+  void   flush();
+  void   close();
+  String name() const { return _name; }
+
+  operator bool() const { return _file != nullptr; }
+
+private:
+
+  FILE *_file = nullptr;
+  String _name;
+};
+
+class FS {
+public:
+
+  // Directory on the host which is used as root of the file system.
+  void   setRoot(const String& root) { _root = root; }
+
+  File   open(const String& path,
+              const char   *mode);
+  bool   exists(const String& path);
+  bool   remove(const String& path);
+
+  // Path of the file on the host.
+  String hostPath(const String& path) const;
+
+private:
+
+  String _root = ".";
+};
+} // namespace fs
+
+using fs::File;
+using fs::FS;
+using fs::SeekSet;
+using fs::SeekCur;
+using fs::SeekEnd;
+
+extern fs::FS SPIFFS;
+
+#endif // NATIVE_SHIMS_FS_H
@@ -0,0 +1,16 @@
+#ifndef NATIVE_SHIMS_HOSTCLOCK_H
+#define NATIVE_SHIMS_HOSTCLOCK_H
+
+/*********************************************************************************************\
+* Virtual clock of the native host build.
+*
+* When enabled, millis() only advances by hostClock_advance(), so timer driven rules
+* can be replayed without waiting for the real time.
+* micros() always follows the host steady clock, so measured durations stay real.
+\*********************************************************************************************/
+
+void hostClock_setVirtual(bool enabled);
+
+void hostClock_advance(unsigned long ms);
+
+#endif // NATIVE_SHIMS_HOSTCLOCK_H
@@ -0,0 +1,195 @@
+#include "Arduino.h"
+#include "HostClock.h"
+#include "HostHeap.h"
+
+#include <chrono>
+#include <thread>
+
+#ifdef __GLIBC__
+# include <malloc.h>
+
+extern "C" {
+void *__libc_malloc(size_t size);
+void *__libc_calloc(size_t nmemb, size_t size);
+void *__libc_realloc(void *ptr, size_t size);
+void  __libc_free(void *ptr);
+}
+#endif // ifdef __GLIBC__
+
+EspClass       ESP;
+HardwareSerial Serial;
+
+namespace {
+const std::chrono::steady_clock::time_point bootTime = std::chrono::steady_clock::now();
+
+HostHeapStats heapStats;
+int64_t heapBaseline = 0;
+
+bool virtualClock           = false;
+unsigned long virtualMillis = 0;
+
+inline void trackAlloc(void *ptr)
+{
+#ifdef __GLIBC__
+
+  if (ptr != nullptr) {
+    ++heapStats.allocations;
+    heapStats.liveBytes += malloc_usable_size(ptr);
+
+    if (heapStats.liveBytes > heapStats.peakBytes) {
+      heapStats.peakBytes = heapStats.liveBytes;
+    }
+  }
+#endif // ifdef __GLIBC__
+}
+
+inline void trackFree(void *ptr)
+{
+#ifdef __GLIBC__
+
+  if (ptr != nullptr) {
+    ++heapStats.frees;
+    heapStats.liveBytes -= malloc_usable_size(ptr);
+  }
+#endif // ifdef __GLIBC__
+}
+} // namespace
+
+#ifdef __GLIBC__
+
+// Interpose the allocator of the C library to count all allocations.
+extern "C" {
+void* malloc(size_t size)
+{
+  void *ptr = __libc_malloc(size);
+
+  trackAlloc(ptr);
+  return ptr;
+}
+
+void* calloc(size_t nmemb, size_t size)
+{
+  void *ptr = __libc_calloc(nmemb, size);
+
+  trackAlloc(ptr);
+  return ptr;
+}
+
+void* realloc(void *ptr, size_t size)
+{
+  trackFree(ptr);
+  void *res = __libc_realloc(ptr, size);
+
+  if (res == nullptr) {
+    // Original block is still valid when realloc fails.
+    trackAlloc(ptr);
+  } else {
+    trackAlloc(res);
+  }
+  return res;
+}
+
+void free(void *ptr)
+{
+  trackFree(ptr);
+  __libc_free(ptr);
+}
+}
+#endif // ifdef __GLIBC__
+
+bool hostHeap_tracking()
+{
+#ifdef __GLIBC__
+  return true;
+#else // ifdef __GLIBC__
+  return false;
+#endif // ifdef __GLIBC__
+}
+
+void hostHeap_setBaseline()
+{
+  heapBaseline = heapStats.liveBytes;
+  hostHeap_resetPeak();
+}
+
+void hostHeap_resetPeak()
+{
+  heapStats.peakBytes = heapStats.liveBytes;
+}
+
+HostHeapStats hostHeap_getStats()
+{
+  HostHeapStats res = heapStats;
+
+  res.liveBytes -= heapBaseline;
+  res.peakBytes -= heapBaseline;
+  return res;
+}
+
+void hostClock_setVirtual(bool enabled)
+{
+  if (enabled && !virtualClock) {
+    virtualMillis = millis();
+  }
+  virtualClock = enabled;
+}
+
+void hostClock_advance(unsigned long ms)
+{
+  virtualMillis += ms;
+}
+
+unsigned long millis()
+{
+  if (virtualClock) {
+    return virtualMillis;
+  }
+  return std::chrono::duration_cast<std::chrono::milliseconds>(
+    std::chrono::steady_clock::now() - bootTime).count();
+}
+
+unsigned long micros()
+{
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now() - bootTime).count();
+}
+
+void delay(unsigned long ms)
+{
+  if (virtualClock) {
+    virtualMillis += ms;
+    return;
+  }
+
+  if (ms > 0) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+  }
+}
+
+void yield() {}
+
+uint32_t EspClass::getFreeHeap()
+{
+  const int64_t used = hostHeap_getStats().liveBytes;
+
+  if (used >= HOST_HEAP_SIZE) { return 0; }
+
+  if (used <= 0) { return HOST_HEAP_SIZE; }
+  return HOST_HEAP_SIZE - used;
+}
+
+uint32_t EspClass::getMaxFreeBlockSize()
+{
+  return getFreeHeap();
+}
+
+uint32_t EspClass::getCycleCount()
+{
+  // 80 MHz clock
+  return static_cast<uint32_t>(micros() * 80);
+}
+
+size_t HardwareSerial::write(const char *buf, size_t size)
+{
+  return fwrite(buf, 1, size, stdout);
+}
@@ -0,0 +1,36 @@
+#ifndef NATIVE_SHIMS_HOSTHEAP_H
+#define NATIVE_SHIMS_HOSTHEAP_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*********************************************************************************************\
+* Allocation tracker of the native host build.
+*
+* All malloc/free calls of the process (also from operator new/delete) are counted,
+* so the benchmark can report allocations per event and the peak heap usage.
+* ESP.getFreeHeap() is simulated as HOST_HEAP_SIZE minus the bytes allocated
+* since hostHeap_setBaseline().
+\*********************************************************************************************/
+#ifndef HOST_HEAP_SIZE
+# define HOST_HEAP_SIZE  (80 * 1024) // Free heap of an ESP8266 after boot
+#endif // ifndef HOST_HEAP_SIZE
+
+struct HostHeapStats {
+  uint64_t allocations = 0; // Number of malloc/calloc/realloc calls which returned a new block
+  uint64_t frees       = 0;
+  int64_t  liveBytes   = 0; // Allocated bytes, relative to the baseline
+  int64_t  peakBytes   = 0; // Max. of liveBytes since the last hostHeap_resetPeak()
+};
+
+// Is the allocation tracker active on this platform.
+bool          hostHeap_tracking();
+
+// Current allocations will not count as used heap.
+void          hostHeap_setBaseline();
+
+void          hostHeap_resetPeak();
+
+HostHeapStats hostHeap_getStats();
+
+#endif // NATIVE_SHIMS_HOSTHEAP_H
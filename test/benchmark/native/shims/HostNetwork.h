@@ -0,0 +1,79 @@
+#ifndef NATIVE_SHIMS_HOSTNETWORK_H
+#define NATIVE_SHIMS_HOSTNETWORK_H
+
+#include "Arduino.h"
+
+#include <functional>
+#include <memory>
+
+/*********************************************************************************************\
+* Network types of the native host build.
+* Only declarations needed to compile headers which mention them, there is no network stack.
+\*********************************************************************************************/
+class IPAddress {
+public:
+
+  IPAddress() {}
+
+  IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) {
+    _address[0] = a; _address[1] = b; _address[2] = c; _address[3] = d;
+  }
+
+  uint8_t  operator[](int index) const { return _address[index]; }
+  uint8_t& operator[](int index) { return _address[index]; }
+
+  String   toString() const {
+    String res;
+
+    for (int i = 0; i < 4; ++i) {
+      if (i > 0) { res += '.'; }
+      res += _address[i];
+    }
+    return res;
+  }
+
+private:
+
+  uint8_t _address[4] = { 0 };
+};
+
+class WiFiClient {
+public:
+
+  int    connect(const IPAddress&, uint16_t) { return 0; }
+  int    connect(const char *, uint16_t)     { return 0; }
+  size_t write(const uint8_t *, size_t size) { return size; }
+  int    available()                         { return 0; }
+  int    read()                              { return -1; }
+  void   stop() {}
+  uint8_t connected()                        { return 0; }
+  void   setTimeout(unsigned long) {}
+  operator bool()                            { return false; }
+};
+
+class WiFiUDP {
+public:
+
+  uint8_t begin(uint16_t)                         { return 0; }
+  int     beginPacket(const IPAddress&, uint16_t) { return 0; }
+  int     beginPacket(const char *, uint16_t)     { return 0; }
+  int     endPacket()                             { return 0; }
+  size_t  write(const uint8_t *, size_t size)     { return size; }
+  void    stop() {}
+};
+
+enum WiFiMode_t {
+  WIFI_OFF    = 0,
+  WIFI_STA    = 1,
+  WIFI_AP     = 2,
+  WIFI_AP_STA = 3
+};
+
+enum WiFiDisconnectReason {
+  WIFI_DISCONNECT_REASON_UNSPECIFIED = 1
+};
+
+struct WiFiEventHandlerOpaque;
+typedef std::shared_ptr<WiFiEventHandlerOpaque> WiFiEventHandler;
+
+#endif // NATIVE_SHIMS_HOSTNETWORK_H
@@ -0,0 +1,7 @@
+#ifndef NATIVE_SHIMS_I2CDEV_H
+#define NATIVE_SHIMS_I2CDEV_H
+
+// No I2C bus on the native host build.
+#include "Arduino.h"
+
+#endif // NATIVE_SHIMS_I2CDEV_H
@@ -0,0 +1,579 @@
+#include "WString.h"
+
+#include <ctype.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <utility>
+
+namespace {
+String numberToString(long long value)
+{
+  char buf[24];
+
+  snprintf(buf, sizeof(buf), "%lld", value);
+  return String(buf);
+}
+
+String unsignedToString(unsigned long long value, unsigned char base)
+{
+  char buf[72];
+
+  if (base == 16) {
+    snprintf(buf, sizeof(buf), "%llx", value);
+  } else if (base == 2) {
+    int pos = sizeof(buf) - 1;
+    buf[pos] = 0;
+
+    do {
+      buf[--pos] = '0' + (value & 1);
+      value    >>= 1;
+    } while (value != 0);
+    return String(&buf[pos]);
+  } else {
+    snprintf(buf, sizeof(buf), "%llu", value);
+  }
+  return String(buf);
+}
+
+String floatToString(double value, unsigned char decimalPlaces)
+{
+  char buf[64];
+
+  if (isnan(value)) { return String("nan"); }
+
+  if (isinf(value)) { return String("inf"); }
+  snprintf(buf, sizeof(buf), "%.*f", decimalPlaces, value);
+  return String(buf);
+}
+} // namespace
+
+String::String(const char *cstr)
+{
+  init();
+
+  if (cstr != nullptr) {
+    copy(cstr, strlen(cstr));
+  }
+}
+
+String::String(const char *cstr, size_t length)
+{
+  init();
+
+  if (cstr != nullptr) {
+    copy(cstr, length);
+  }
+}
+
+String::String(const String& str)
+{
+  init();
+  copy(str.c_str(), str._len);
+}
+
+String::String(String&& rval)
+{
+  init();
+  move(rval);
+}
+
+String::String(const __FlashStringHelper *str) : String(reinterpret_cast<const char *>(str)) {}
+
+String::String(char c)
+{
+  init();
+  char buf[2] = { c, 0 };
+
+  copy(buf, 1);
+}
+
+String::String(unsigned char value, unsigned char base) : String(unsignedToString(value, base)) {}
+
+String::String(int value, unsigned char base) :
+  String(base == 10 ? numberToString(value) : unsignedToString(static_cast<unsigned int>(value), base)) {}
+
+String::String(unsigned int value, unsigned char base) : String(unsignedToString(value, base)) {}
+
+String::String(long value, unsigned char base) :
+  String(base == 10 ? numberToString(value) : unsignedToString(static_cast<unsigned long>(value), base)) {}
+
+String::String(unsigned long value, unsigned char base) : String(unsignedToString(value, base)) {}
+
+String::String(long long value) : String(numberToString(value)) {}
+
+String::String(unsigned long long value) : String(unsignedToString(value, 10)) {}
+
+String::String(float value, unsigned char decimalPlaces) : String(floatToString(value, decimalPlaces)) {}
+
+String::String(double value, unsigned char decimalPlaces) : String(floatToString(value, decimalPlaces)) {}
+
+String::~String()
+{
+  invalidate();
+}
+
+void String::init()
+{
+  _buffer    = nullptr;
+  _capacity  = WSTRING_SSO_LENGTH;
+  _len       = 0;
+  _sso       = true;
+  _inline[0] = 0;
+}
+
+void String::invalidate()
+{
+  if (!_sso) {
+    free(_buffer);
+  }
+  init();
+}
+
+bool String::reserve(size_t size)
+{
+  if (size <= _capacity) {
+    return true;
+  }
+  return changeBuffer(size);
+}
+
+bool String::changeBuffer(size_t maxStrLen)
+{
+  // Only called to grow, the heap buffer is never moved back inline.
+  char *newBuffer = nullptr;
+
+  if (_sso) {
+    newBuffer = static_cast<char *>(malloc(maxStrLen + 1));
+
+    if (newBuffer == nullptr) { return false; }
+    memcpy(newBuffer, _inline, _len + 1);
+  } else {
+    newBuffer = static_cast<char *>(realloc(_buffer, maxStrLen + 1));
+
+    if (newBuffer == nullptr) { return false; }
+  }
+  _buffer   = newBuffer;
+  _capacity = maxStrLen;
+  _sso      = false;
+  return true;
+}
+
+void String::setLen(size_t len)
+{
+  _len            = len;
+  wbuffer()[_len] = 0;
+}
+
+void String::copy(const char *cstr, size_t length)
+{
+  if (!reserve(length)) {
+    invalidate();
+    return;
+  }
+  memmove(wbuffer(), cstr, length);
+  setLen(length);
+}
+
+void String::move(String& rhs)
+{
+  if (!_sso) {
+    free(_buffer);
+  }
+
+  if (rhs._sso) {
+    init();
+    memcpy(_inline, rhs._inline, rhs._len + 1);
+    _len = rhs._len;
+  } else {
+    _buffer   = rhs._buffer;
+    _capacity = rhs._capacity;
+    _len      = rhs._len;
+    _sso      = false;
+  }
+  rhs.init();
+}
+
+String& String::operator=(const String& rhs)
+{
+  if (this != &rhs) {
+    copy(rhs.c_str(), rhs._len);
+  }
+  return *this;
+}
+
+String& String::operator=(String&& rval)
+{
+  if (this != &rval) {
+    move(rval);
+  }
+  return *this;
+}
+
+String& String::operator=(const char *cstr)
+{
+  if (cstr == nullptr) {
+    invalidate();
+  } else {
+    copy(cstr, strlen(cstr));
+  }
+  return *this;
+}
+
+String& String::operator=(const __FlashStringHelper *str)
+{
+  return operator=(reinterpret_cast<const char *>(str));
+}
+
+String& String::operator=(char c)
+{
+  char buf[2] = { c, 0 };
+
+  copy(buf, 1);
+  return *this;
+}
+
+bool String::concat(const char *cstr, size_t length)
+{
+  if (cstr == nullptr) { return false; }
+
+  if (length == 0) { return true; }
+  const size_t newLen = _len + length;
+
+  if (newLen > _capacity) {
+    // Grow like the ESP8266 core: exact size, the caller should reserve when appending a lot.
+    // Source may point into this string.
+    const char *own = c_str();
+
+    if ((cstr >= own) && (cstr < own + _len)) {
+      const size_t offset = cstr - own;
+
+      if (!reserve(newLen)) { return false; }
+      cstr = c_str() + offset;
+    } else if (!reserve(newLen)) {
+      return false;
+    }
+  }
+  memmove(wbuffer() + _len, cstr, length);
+  setLen(newLen);
+  return true;
+}
+
+bool String::concat(const String& str)           { return concat(str.c_str(), str._len); }
+
+bool String::concat(const char *cstr)            { return cstr != nullptr && concat(cstr, strlen(cstr)); }
+
+bool String::concat(const __FlashStringHelper *str) { return concat(reinterpret_cast<const char *>(str)); }
+
+bool String::concat(char c)                      { return concat(&c, 1); }
+
+bool String::concat(unsigned char value)         { return concat(String(value)); }
+
+bool String::concat(int value)                   { return concat(String(value)); }
+
+bool String::concat(unsigned int value)          { return concat(String(value)); }
+
+bool String::concat(long value)                  { return concat(String(value)); }
+
+bool String::concat(unsigned long value)         { return concat(String(value)); }
+
+bool String::concat(long long value)             { return concat(String(value)); }
+
+bool String::concat(unsigned long long value)    { return concat(String(value)); }
+
+bool String::concat(float value)                 { return concat(String(value)); }
+
+bool String::concat(double value)                { return concat(String(value)); }
+
+int String::compareTo(const String& s) const
+{
+  return strcmp(c_str(), s.c_str());
+}
+
+bool String::equals(const String& s) const
+{
+  return (_len == s._len) && (compareTo(s) == 0);
+}
+
+bool String::equals(const char *cstr) const
+{
+  if (cstr == nullptr) { return _len == 0; }
+  return strcmp(c_str(), cstr) == 0;
+}
+
+bool String::equalsIgnoreCase(const String& s) const
+{
+  if (_len != s._len) { return false; }
+  return strcasecmp(c_str(), s.c_str()) == 0;
+}
+
+bool String::startsWith(const String& prefix) const
+{
+  return startsWith(prefix, 0);
+}
+
+bool String::startsWith(const String& prefix, unsigned int offset) const
+{
+  if ((offset > _len) || (prefix._len > _len - offset)) { return false; }
+  return strncmp(c_str() + offset, prefix.c_str(), prefix._len) == 0;
+}
+
+bool String::endsWith(const String& suffix) const
+{
+  if (suffix._len > _len) { return false; }
+  return strcmp(c_str() + _len - suffix._len, suffix.c_str()) == 0;
+}
+
+char String::charAt(unsigned int index) const
+{
+  return operator[](index);
+}
+
+void String::setCharAt(unsigned int index, char c)
+{
+  if (index < _len) { wbuffer()[index] = c; }
+}
+
+char String::operator[](unsigned int index) const
+{
+  if (index >= _len) { return 0; }
+  return c_str()[index];
+}
+
+char& String::operator[](unsigned int index)
+{
+  static char dummy_writable_char;
+
+  if (index >= _len) {
+    dummy_writable_char = 0;
+    return dummy_writable_char;
+  }
+  return wbuffer()[index];
+}
+
+int String::indexOf(char ch) const
+{
+  return indexOf(ch, 0);
+}
+
+int String::indexOf(char ch, unsigned int fromIndex) const
+{
+  if (fromIndex >= _len) { return -1; }
+  const char *found = static_cast<const char *>(memchr(c_str() + fromIndex, ch, _len - fromIndex));
+
+  return found == nullptr ? -1 : found - c_str();
+}
+
+int String::indexOf(const String& str) const
+{
+  return indexOf(str, 0);
+}
+
+int String::indexOf(const String& str, unsigned int fromIndex) const
+{
+  if (fromIndex >= _len) { return -1; }
+  const char *found = strstr(c_str() + fromIndex, str.c_str());
+
+  return found == nullptr ? -1 : found - c_str();
+}
+
+int String::lastIndexOf(char ch) const
+{
+  return _len == 0 ? -1 : lastIndexOf(ch, _len - 1);
+}
+
+int String::lastIndexOf(char ch, unsigned int fromIndex) const
+{
+  if (_len == 0) { return -1; }
+
+  if (fromIndex >= _len) { fromIndex = _len - 1; }
+
+  for (int i = fromIndex; i >= 0; --i) {
+    if (c_str()[i] == ch) { return i; }
+  }
+  return -1;
+}
+
+int String::lastIndexOf(const String& str) const
+{
+  if (str._len > _len) { return -1; }
+
+  for (int i = _len - str._len; i >= 0; --i) {
+    if (strncmp(c_str() + i, str.c_str(), str._len) == 0) { return i; }
+  }
+  return -1;
+}
+
+String String::substring(unsigned int beginIndex) const
+{
+  return substring(beginIndex, _len);
+}
+
+String String::substring(unsigned int beginIndex, unsigned int endIndex) const
+{
+  if (beginIndex > endIndex) { std::swap(beginIndex, endIndex); }
+
+  if (beginIndex >= _len) { return String(); }
+
+  if (endIndex > _len) { endIndex = _len; }
+  return String(c_str() + beginIndex, endIndex - beginIndex);
+}
+
+void String::replace(char find, char replace)
+{
+  char *buf = wbuffer();
+
+  for (size_t i = 0; i < _len; ++i) {
+    if (buf[i] == find) { buf[i] = replace; }
+  }
+}
+
+void String::replace(const String& find, const String& replace)
+{
+  if ((_len == 0) || (find._len == 0)) { return; }
+
+  if (indexOf(find) == -1) { return; }
+  String result;
+  int    pos  = 0;
+  int    next = 0;
+
+  result.reserve(_len);
+
+  while ((next = indexOf(find, pos)) != -1) {
+    result.concat(c_str() + pos, next - pos);
+    result.concat(replace);
+    pos = next + find._len;
+  }
+  result.concat(c_str() + pos, _len - pos);
+
+  // Arduino replaces in place when the result fits, so only reallocate when growing.
+  if (result._len <= _capacity) {
+    memcpy(wbuffer(), result.c_str(), result._len);
+    setLen(result._len);
+  } else {
+    *this = std::move(result);
+  }
+}
+
+void String::remove(unsigned int index)
+{
+  remove(index, static_cast<unsigned int>(-1));
+}
+
+void String::remove(unsigned int index, unsigned int count)
+{
+  if (index >= _len) { return; }
+
+  if (count > _len - index) { count = _len - index; }
+  char *buf = wbuffer();
+
+  memmove(buf + index, buf + index + count, _len - index - count);
+  setLen(_len - count);
+}
+
+void String::toLowerCase()
+{
+  char *buf = wbuffer();
+
+  for (size_t i = 0; i < _len; ++i) {
+    buf[i] = tolower(static_cast<unsigned char>(buf[i]));
+  }
+}
+
+void String::toUpperCase()
+{
+  char *buf = wbuffer();
+
+  for (size_t i = 0; i < _len; ++i) {
+    buf[i] = toupper(static_cast<unsigned char>(buf[i]));
+  }
+}
+
+void String::trim()
+{
+  if (_len == 0) { return; }
+  char  *buf   = wbuffer();
+  size_t begin = 0;
+  size_t end   = _len;
+
+  while (begin < end && isspace(static_cast<unsigned char>(buf[begin]))) { ++begin; }
+
+  while (end > begin && isspace(static_cast<unsigned char>(buf[end - 1]))) { --end; }
+
+  if (begin > 0) {
+    memmove(buf, buf + begin, end - begin);
+  }
+  setLen(end - begin);
+}
+
+void String::getBytes(unsigned char *buf, unsigned int bufsize, unsigned int index) const
+{
+  if ((buf == nullptr) || (bufsize == 0)) { return; }
+
+  if (index >= _len) {
+    buf[0] = 0;
+    return;
+  }
+  size_t n = bufsize - 1;
+
+  if (n > _len - index) { n = _len - index; }
+  memcpy(buf, c_str() + index, n);
+  buf[n] = 0;
+}
+
+long String::toInt() const
+{
+  return atol(c_str());
+}
+
+float String::toFloat() const
+{
+  return static_cast<float>(atof(c_str()));
+}
+
+double String::toDouble() const
+{
+  return atof(c_str());
+}
+
+String operator+(const String& lhs, const String& rhs)
+{
+  String res(lhs);
+
+  res.concat(rhs);
+  return res;
+}
+
+String operator+(const String& lhs, const char *rhs)
+{
+  String res(lhs);
+
+  res.concat(rhs);
+  return res;
+}
+
+String operator+(const char *lhs, const String& rhs)
+{
+  String res(lhs);
+
+  res.concat(rhs);
+  return res;
+}
+
+String operator+(const String& lhs, char rhs)
+{
+  String res(lhs);
+
+  res.concat(rhs);
+  return res;
+}
+
+String operator+(const String& lhs, const __FlashStringHelper *rhs)
+{
+  String res(lhs);
+
+  res.concat(rhs);
+  return res;
+}
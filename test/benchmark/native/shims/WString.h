@@ -0,0 +1,176 @@
+#ifndef NATIVE_SHIMS_WSTRING_H
+#define NATIVE_SHIMS_WSTRING_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+class __FlashStringHelper;
+
+/*********************************************************************************************\
+* Arduino String for the native host build.
+*
+* Follows the ESP8266 core: strings up to WSTRING_SSO_LENGTH characters are stored inline
+* (small string optimization), longer strings on the heap.
+* So the number of allocations measured on the host is close to the one on the ESP.
+\*********************************************************************************************/
+#ifndef WSTRING_SSO_LENGTH
+# define WSTRING_SSO_LENGTH 11
+#endif // ifndef WSTRING_SSO_LENGTH
+
+class String {
+public:
+
+  String(const char *cstr = "");
+  String(const char *cstr,
+         size_t      length);
+  String(const String& str);
+  String(String&& rval);
+  String(const __FlashStringHelper *str);
+  explicit String(char c);
+  explicit String(unsigned char value,
+                  unsigned char base = 10);
+  explicit String(int value,
+                  unsigned char base = 10);
+  explicit String(unsigned int value,
+                  unsigned char base = 10);
+  explicit String(long value,
+                  unsigned char base = 10);
+  explicit String(unsigned long value,
+                  unsigned char base = 10);
+  explicit String(long long value);
+  explicit String(unsigned long long value);
+  explicit String(float value,
+                  unsigned char decimalPlaces = 2);
+  explicit String(double value,
+                  unsigned char decimalPlaces = 2);
+  ~String();
+
+  // Return false when memory could not be allocated.
+  bool        reserve(size_t size);
+
+  size_t      length() const { return _len; }
+
+  bool        isEmpty() const { return _len == 0; }
+
+  const char* c_str() const { return _sso ? _inline : _buffer; }
+
+  String    & operator=(const String& rhs);
+  String    & operator=(String&& rval);
+  String    & operator=(const char *cstr);
+  String    & operator=(const __FlashStringHelper *str);
+  String    & operator=(char c);
+
+  bool        concat(const String& str);
+  bool        concat(const char *cstr);
+  bool        concat(const char *cstr,
+                     size_t      length);
+  bool        concat(const __FlashStringHelper *str);
+  bool        concat(char c);
+  bool        concat(unsigned char value);
+  bool        concat(int value);
+  bool        concat(unsigned int value);
+  bool        concat(long value);
+  bool        concat(unsigned long value);
+  bool        concat(long long value);
+  bool        concat(unsigned long long value);
+  bool        concat(float value);
+  bool        concat(double value);
+
+  template<class T>
+  String& operator+=(const T& rhs) {
+    concat(rhs);
+    return *this;
+  }
+
+  int         compareTo(const String& s) const;
+  bool        equals(const String& s) const;
+  bool        equals(const char *cstr) const;
+  bool        equalsIgnoreCase(const String& s) const;
+  bool        startsWith(const String& prefix) const;
+  bool        startsWith(const String& prefix,
+                         unsigned int  offset) const;
+  bool        endsWith(const String& suffix) const;
+
+  bool        operator==(const String& rhs) const { return equals(rhs); }
+  bool        operator==(const char *cstr) const { return equals(cstr); }
+  bool        operator!=(const String& rhs) const { return !equals(rhs); }
+  bool        operator!=(const char *cstr) const { return !equals(cstr); }
+  bool        operator<(const String& rhs) const { return compareTo(rhs) < 0; }
+  bool        operator>(const String& rhs) const { return compareTo(rhs) > 0; }
+
+  char        charAt(unsigned int index) const;
+  void        setCharAt(unsigned int index,
+                        char         c);
+  char        operator[](unsigned int index) const;
+  char      & operator[](unsigned int index);
+
+  int         indexOf(char ch) const;
+  int         indexOf(char         ch,
+                      unsigned int fromIndex) const;
+  int         indexOf(const String& str) const;
+  int         indexOf(const String& str,
+                      unsigned int  fromIndex) const;
+  int         lastIndexOf(char ch) const;
+  int         lastIndexOf(char         ch,
+                          unsigned int fromIndex) const;
+  int         lastIndexOf(const String& str) const;
+
+  String      substring(unsigned int beginIndex) const;
+  String      substring(unsigned int beginIndex,
+                        unsigned int endIndex) const;
+
+  void        replace(char find,
+                      char replace);
+  void        replace(const String& find,
+                      const String& replace);
+  void        remove(unsigned int index);
+  void        remove(unsigned int index,
+                     unsigned int count);
+  void        toLowerCase();
+  void        toUpperCase();
+  void        trim();
+
+  void        getBytes(unsigned char *buf,
+                       unsigned int   bufsize,
+                       unsigned int   index = 0) const;
+  void        toCharArray(char        *buf,
+                          unsigned int bufsize,
+                          unsigned int index = 0) const {
+    getBytes(reinterpret_cast<unsigned char *>(buf), bufsize, index);
+  }
+
+  long        toInt() const;
+  float       toFloat() const;
+  double      toDouble() const;
+
+private:
+
+  char* wbuffer() { return _sso ? _inline : _buffer; }
+
+  void  init();
+  void  invalidate();
+  bool  changeBuffer(size_t maxStrLen);
+  void  copy(const char *cstr,
+             size_t      length);
+  void  move(String& rhs);
+  void  setLen(size_t len);
+
+  char *_buffer = nullptr;
+  size_t _capacity = WSTRING_SSO_LENGTH;
+  size_t _len      = 0;
+  bool _sso        = true;
+  char _inline[WSTRING_SSO_LENGTH + 1];
+};
+
+String operator+(const String& lhs,
+                 const String& rhs);
+String operator+(const String& lhs,
+                 const char   *rhs);
+String operator+(const char   *lhs,
+                 const String& rhs);
+String operator+(const String& lhs,
+                 char          rhs);
+String operator+(const String             & lhs,
+                 const __FlashStringHelper *rhs);
+
+#endif // NATIVE_SHIMS_WSTRING_H
@@ -0,0 +1,7 @@
+#ifndef NATIVE_SHIMS_WIFICLIENT_H
+#define NATIVE_SHIMS_WIFICLIENT_H
+
+// Network classes are declared in HostNetwork.h
+#include "HostNetwork.h"
+
+#endif // NATIVE_SHIMS_WIFICLIENT_H
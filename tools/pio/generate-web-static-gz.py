@@ -0,0 +1,121 @@
+# Generate src/src/Static/WebStaticData_gz.h
+#
+# The minified static web files (CSS and JavaScript) are gzip compressed and stored
+# in PROGMEM, to be served by the web server with "Content-Encoding: gzip".
+# A hash of the content is used as ETag and as version in the URL of the file,
+# so browsers only fetch it again when the content has changed.
+#
+# Runs as PlatformIO pre-script, but can also be run standalone:
+#   python tools/pio/generate-web-static-gz.py
+# The header is only written when its content changes, to prevent needless rebuilds.
+
+import gzip
+import hashlib
+import os
+
+
+# Source file in static/, guard define (or None)
+WEB_STATIC_FILES = [
+    ('espeasy_default.min.css',                 None),
+    ('fetch_and_parse_log.min.js',              'WEBSERVER_LOG'),
+    ('github_clipboard.min.js',                 'WEBSERVER_GITHUB_COPY'),
+    ('update_sensor_values_device_page.min.js', 'WEBSERVER_DEVICES'),
+]
+
+CONTENT_TYPES = {
+    '.css': ('WEB_STATIC_CONTENT_TYPE_CSS', 'text/css'),
+    '.js':  ('WEB_STATIC_CONTENT_TYPE_JS',  'application/javascript'),
+}
+
+URL_PREFIX = '/static/'
+BYTES_PER_LINE = 20
+
+
+def const_name(file_name):
+    return file_name.replace('.', '_').replace('-', '_').upper()
+
+
+def hex_array(data):
+    lines = []
+    for i in range(0, len(data), BYTES_PER_LINE):
+        lines.append('  ' + ','.join('0x{:02x}'.format(b) for b in data[i:i + BYTES_PER_LINE]))
+    return ',\n'.join(lines)
+
+
+def generate_header(static_dir):
+    out = []
+    out.append('// Generated by tools/pio/generate-web-static-gz.py from the files in static/')
+    out.append('// Do not edit, changes will be overwritten.')
+    out.append('')
+    out.append('#ifndef STATIC_WEBSTATICDATA_GZ_H')
+    out.append('#define STATIC_WEBSTATICDATA_GZ_H')
+    out.append('')
+    for type_name, content_type in sorted(CONTENT_TYPES.values()):
+        out.append('static const char {}[] PROGMEM = "{}";'.format(type_name, content_type))
+
+    for file_name, guard in WEB_STATIC_FILES:
+        with open(os.path.join(static_dir, file_name), 'rb') as f:
+            content = f.read()
+
+        # mtime=0 makes the output reproducible
+        compressed = gzip.compress(content, compresslevel=9, mtime=0)
+        name = const_name(file_name)
+        type_name = CONTENT_TYPES[os.path.splitext(file_name)[1]][0]
+
+        out.append('')
+        out.append('')
+        out.append('// {}: {} bytes, gzip compressed {} bytes'.format(file_name, len(content), len(compressed)))
+        if guard is not None:
+            out.append('#ifdef {}'.format(guard))
+        out.append('static const char DATA_{}_GZ_URL[] PROGMEM = "{}{}";'.format(name, URL_PREFIX, file_name))
+        out.append('static const char DATA_{}_GZ_HASH[] PROGMEM = "{}";'.format(name, hashlib.sha1(content).hexdigest()[:8]))
+        out.append('static const uint8_t DATA_{}_GZ[] PROGMEM = {{'.format(name))
+        out.append(hex_array(compressed))
+        out.append('};')
+        out.append('static const WebStaticFile WEB_STATIC_{} = {{'.format(name))
+        out.append('  DATA_{0}_GZ_URL, {1}, DATA_{0}_GZ_HASH, DATA_{0}_GZ, sizeof(DATA_{0}_GZ)'.format(name, type_name))
+        out.append('};')
+        if guard is not None:
+            out.append('#endif // ifdef {}'.format(guard))
+
+    out.append('')
+    out.append('')
+    out.append('// All static files, to register their URL with the web server')
+    out.append('static const WebStaticFile *const webStaticFiles[] = {')
+    for file_name, guard in WEB_STATIC_FILES:
+        if guard is not None:
+            out.append('#ifdef {}'.format(guard))
+        out.append('  &WEB_STATIC_{},'.format(const_name(file_name)))
+        if guard is not None:
+            out.append('#endif // ifdef {}'.format(guard))
+    out.append('};')
+    out.append('')
+    out.append('#endif // STATIC_WEBSTATICDATA_GZ_H')
+    out.append('')
+    return '\n'.join(out)
+
+
+def write_if_changed(path, content):
+    if os.path.isfile(path):
+        with open(path, 'r', newline='') as f:
+            if f.read() == content:
+                return False
+    with open(path, 'w', newline='') as f:
+        f.write(content)
+    return True
+
+
+def generate(project_dir):
+    header = os.path.join(project_dir, 'src', 'src', 'Static', 'WebStaticData_gz.h')
+    if write_if_changed(header, generate_header(os.path.join(project_dir, 'static'))):
+        print("\u001b[33m Web static files:\u001b[0m generated {}".format(header))
+
+
+try:
+    Import("env")
+    project_dir = env["PROJECT_DIR"]
+except NameError:
+    # Not run by PlatformIO
+    project_dir = os.path.normpath(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', '..'))
+
+generate(project_dir)